@@ -0,0 +1,93 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "H5Support/H5Support.h"
+
+#if defined (H5Support_NAMESPACE)
+namespace H5Support_NAMESPACE
+{
+#endif
+
+/**
+ * @brief The H5DatasetCompression struct describes the storage layout that newly created
+ * datasets should use. The default constructed value produces the classic contiguous,
+ * uncompressed layout.
+ */
+struct H5DatasetCompression
+{
+  /**
+   * @brief How the chunk dimensions of a dataset are chosen.
+   */
+  enum class ChunkPolicy : int32_t
+  {
+    Contiguous = 0, //!< No chunking. Only valid without compression.
+    Automatic = 1,  //!< Split the slowest varying dimensions until a chunk fits in ChunkTargetBytes
+    Slice = 2       //!< One chunk per entry of the slowest varying dimension (i.e. one Z slice per chunk)
+  };
+
+  /**
+   * @brief The gzip (deflate) level, 0 = no compression through 9 = maximum compression.
+   */
+  int32_t CompressionLevel = 0;
+
+  /**
+   * @brief Apply the byte shuffle filter before deflate. This greatly improves the compression
+   * of multi-byte integer and floating point data.
+   */
+  bool Shuffle = true;
+
+  ChunkPolicy Chunking = ChunkPolicy::Contiguous;
+
+  /**
+   * @brief The upper bound on the size of a chunk when using the Automatic policy.
+   */
+  uint64_t ChunkTargetBytes = 1024 * 1024;
+
+  /**
+   * @brief Returns true if datasets need a non default creation property list
+   */
+  bool isChunked() const
+  {
+    return CompressionLevel > 0 || Chunking != ChunkPolicy::Contiguous;
+  }
+};
+
+#if defined (H5Support_NAMESPACE)
+}
+#endif
@@ -35,7 +35,9 @@
 
 #include <H5Support/H5Lite.h>
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 
 #if defined(H5Support_NAMESPACE)
 using namespace H5Support_NAMESPACE;
@@ -468,61 +470,153 @@ herr_t H5Lite::writeStringDataset(hid_t loc_id, const std::string& dsetName, siz
 //
 // -----------------------------------------------------------------------------
 herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<std::string>& data)
+{
+  std::vector<const char*> strings(data.size());
+  for(size_t i = 0; i < data.size(); i++)
+  {
+    strings[i] = data[i].c_str();
+  }
+  return writeVectorOfStringsDataset(loc_id, dsetName, strings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data)
+{
+  return writeVectorOfStringsDataset(loc_id, dsetName, data, H5DatasetCompression());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::writeVectorOfStringsDataset(hid_t loc_id, const std::string& dsetName, const std::vector<const char*>& data, const H5DatasetCompression& compression)
 {
   H5SUPPORT_MUTEX_LOCK()
 
   hid_t sid = -1;
-  hid_t memspace = -1;
   hid_t datatype = -1;
   hid_t did = -1;
+  hid_t dcpl = H5P_DEFAULT;
   herr_t err = -1;
   herr_t retErr = 0;
 
   hsize_t dims[1] = {data.size()};
   if((sid = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
   {
-    dims[0] = 1;
+    datatype = H5Tcopy(H5T_C_S1);
+    H5Tset_size(datatype, H5T_VARIABLE);
 
-    if((memspace = H5Screate_simple(sizeof(dims) / sizeof(*dims), dims, nullptr)) >= 0)
+    // Each element of a variable length dataset is a reference into the global heap
+    dcpl = createDatasetCreationPropertyList(1, dims, sizeof(hvl_t), compression);
+    if(dcpl < 0)
     {
+      H5Tclose(datatype);
+      H5Sclose(sid);
+      return dcpl;
+    }
 
-      datatype = H5Tcopy(H5T_C_S1);
-      H5Tset_size(datatype, H5T_VARIABLE);
-
-      if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) >= 0)
+    if((did = H5Dcreate(loc_id, dsetName.c_str(), datatype, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) >= 0)
+    {
+      // All of the strings go out in a single variable length write
+      if(!data.empty())
       {
-
-        //
-        // Select the "memory" to be written out - just 1 record.
-        hsize_t offset[] = {0};
-        hsize_t count[] = {1};
-        H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-        hsize_t m_pos = 0;
-        for(auto v : data)
+        err = H5Dwrite(did, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+        if(err < 0)
         {
-          // Select the file position, 1 record at position 'pos'
-          hsize_t count[] = {1};
-          hsize_t offset[] = {m_pos++};
-          H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, nullptr, count, nullptr);
-          const char* s = v.c_str();
-          err = H5Dwrite(did, datatype, memspace, sid, H5P_DEFAULT, &s);
-          if(err < 0)
-          {
-            std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
-            retErr = err;
-          }
+          std::cout << "Error Writing String Data: " __FILE__ << "(" << __LINE__ << ")" << std::endl;
+          retErr = err;
         }
-        CloseH5D(did, err, retErr);
       }
-      H5Tclose(datatype);
-      CloseH5S(memspace, err, retErr);
+      CloseH5D(did, err, retErr);
     }
-
+    if(dcpl != H5P_DEFAULT)
+    {
+      H5Pclose(dcpl);
+    }
+    H5Tclose(datatype);
     CloseH5S(sid, err, retErr);
   }
   return retErr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5Lite::createDatasetCreationPropertyList(int32_t rank, const hsize_t* dims, size_t typeSize, const H5DatasetCompression& compression)
+{
+  if(!compression.isChunked() || rank <= 0 || nullptr == dims)
+  {
+    return H5P_DEFAULT;
+  }
+
+  std::vector<hsize_t> chunkDims(dims, dims + rank);
+  for(const auto& dim : chunkDims)
+  {
+    // Chunk dimensions must be non zero so an empty dataset stays contiguous
+    if(dim == 0)
+    {
+      return H5P_DEFAULT;
+    }
+  }
+
+  uint64_t targetBytes = compression.ChunkTargetBytes > 0 ? compression.ChunkTargetBytes : 1024 * 1024;
+  int32_t startDim = 0;
+  if(compression.Chunking == H5DatasetCompression::ChunkPolicy::Slice && rank > 1)
+  {
+    chunkDims[0] = 1;
+    startDim = 1;
+    // HDF5 does not allow chunks of 4GB or more so only that limit is enforced on a slice
+    targetBytes = std::numeric_limits<uint32_t>::max();
+  }
+
+  // Halve the slowest varying dimensions first so that each chunk stays a contiguous block in memory
+  auto chunkBytes = [&chunkDims, typeSize]() {
+    uint64_t bytes = typeSize;
+    for(const auto& dim : chunkDims)
+    {
+      bytes *= dim;
+    }
+    return bytes;
+  };
+  int32_t dim = startDim;
+  while(chunkBytes() > targetBytes && dim < rank)
+  {
+    if(chunkDims[dim] > 1)
+    {
+      chunkDims[dim] = (chunkDims[dim] + 1) / 2;
+    }
+    else
+    {
+      dim++;
+    }
+  }
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  if(dcpl < 0)
+  {
+    return dcpl;
+  }
+  herr_t err = H5Pset_chunk(dcpl, rank, chunkDims.data());
+  if(err >= 0 && compression.CompressionLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+  {
+    if(compression.Shuffle)
+    {
+      err = H5Pset_shuffle(dcpl);
+    }
+    if(err >= 0)
+    {
+      err = H5Pset_deflate(dcpl, static_cast<unsigned>(std::min(compression.CompressionLevel, 9)));
+    }
+  }
+  if(err < 0)
+  {
+    H5Pclose(dcpl);
+    return err;
+  }
+  return dcpl;
+}
+
 // -----------------------------------------------------------------------------
 //  Writes a string to a HDF5 dataset
 // -----------------------------------------------------------------------------
@@ -881,6 +975,26 @@ herr_t H5Lite::readStringDataset(hid_t loc_id, const std::string& dsetName, char
 //
 // -----------------------------------------------------------------------------
 herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<std::string>& data)
+{
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  herr_t err = readVectorOfStringDataset(loc_id, dsetName, buffer, offsets);
+  if(err < 0)
+  {
+    return err;
+  }
+  data.resize(offsets.size());
+  for(size_t i = 0; i < offsets.size(); i++)
+  {
+    data[i] = std::string(buffer.data() + offsets[i]);
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetName, std::vector<char>& buffer, std::vector<size_t>& offsets)
 {
   H5SUPPORT_MUTEX_LOCK()
 
@@ -889,6 +1003,9 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
   herr_t err = 0;
   herr_t retErr = 0;
 
+  buffer.clear();
+  offsets.clear();
+
   did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
   if(did < 0)
   {
@@ -911,51 +1028,105 @@ herr_t H5Lite::readVectorOfStringDataset(hid_t loc_id, const std::string& dsetNa
     {
       CloseH5S(sid, err, retErr);
       CloseH5T(tid, err, retErr);
+      CloseH5D(did, err, retErr);
       std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Number of dims should be 1 but it was " << ndims << ". Returning early. Is your data file correct?" << std::endl;
       return -2;
     }
-    std::vector<char*> rdata(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
-    {
-      rdata[i] = nullptr;
-    }
+    size_t numStrings = static_cast<size_t>(dims[0]);
+    offsets.resize(numStrings);
 
-    /*
-    * Create the memory datatype.
-    */
     hid_t memtype = H5Tcopy(H5T_C_S1);
-    herr_t status = H5Tset_size(memtype, H5T_VARIABLE);
+    if(H5Tis_variable_str(tid) > 0)
+    {
+      std::vector<char*> rdata(numStrings, nullptr);
+      H5Tset_size(memtype, H5T_VARIABLE);
 
-    /*
-    * Read the data.
-    */
-    status = H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &(rdata.front()));
-    if(status < 0)
+      herr_t status = numStrings > 0 ? H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata.data()) : 0;
+      if(status >= 0)
+      {
+        // Size the packed buffer once and then copy every string, including its terminator
+        size_t total = 0;
+        for(size_t i = 0; i < numStrings; i++)
+        {
+          total += (nullptr == rdata[i] ? 0 : ::strlen(rdata[i])) + 1;
+        }
+        buffer.resize(total);
+        size_t pos = 0;
+        for(size_t i = 0; i < numStrings; i++)
+        {
+          size_t len = (nullptr == rdata[i] ? 0 : ::strlen(rdata[i]));
+          offsets[i] = pos;
+          if(len > 0)
+          {
+            ::memcpy(buffer.data() + pos, rdata[i], len);
+          }
+          buffer[pos + len] = '\0';
+          pos += len + 1;
+        }
+      }
+      /*
+      * Note that H5Dvlen_reclaim works for variable-length strings as well as
+      * variable-length arrays and only frees the data the pointers point to.
+      */
+      if(numStrings > 0)
+      {
+        H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, rdata.data());
+      }
+      if(status < 0)
+      {
+        retErr = -3;
+      }
+    }
+    else
     {
-      status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
-      CloseH5S(sid, err, retErr);
-      CloseH5T(tid, err, retErr);
-      CloseH5T(memtype, err, retErr);
-      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
-      return -3;
+      // Fixed width strings are read in one block and unpacked using the padding
+      // policy stored with the type.
+      size_t width = H5Tget_size(tid);
+      H5T_str_t strpad = H5Tget_strpad(tid);
+      H5Tset_size(memtype, width);
+      H5Tset_strpad(memtype, strpad);
+
+      std::vector<char> rdata(numStrings * width);
+      herr_t status = numStrings > 0 ? H5Dread(did, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata.data()) : 0;
+      if(status >= 0)
+      {
+        buffer.reserve(numStrings * (width + 1));
+        for(size_t i = 0; i < numStrings; i++)
+        {
+          const char* str = rdata.data() + i * width;
+          size_t len = 0;
+          if(strpad == H5T_STR_SPACEPAD)
+          {
+            len = width;
+            while(len > 0 && str[len - 1] == ' ')
+            {
+              len--;
+            }
+          }
+          else
+          {
+            while(len < width && str[len] != '\0')
+            {
+              len++;
+            }
+          }
+          offsets[i] = buffer.size();
+          buffer.insert(buffer.end(), str, str + len);
+          buffer.push_back('\0');
+        }
+      }
+      else
+      {
+        retErr = -3;
+      }
     }
-    /*
-    * copy the data into the vector of strings
-    */
-    data.resize(dims[0]);
-    for(int i = 0; i < dims[0]; i++)
+
+    if(retErr < 0)
     {
-      // printf("%s[%d]: %s\n", "VlenStrings", i, rdata[i].p);
-      std::string str = std::string(rdata[i]);
-      data[i] = str;
+      buffer.clear();
+      offsets.clear();
+      std::cout << "H5Lite.cpp::readVectorOfStringDataset(" << __LINE__ << ") Error reading Dataset at loc_id (" << loc_id << ") with object name (" << dsetName << ")" << std::endl;
     }
-    /*
-    * Close and release resources.  Note that H5Dvlen_reclaim works
-    * for variable-length strings as well as variable-length arrays.
-    * Also note that we must still free the array of pointers stored
-    * in rdata, as H5Tvlen_reclaim only frees the data these point to.
-    */
-    status = H5Dvlen_reclaim(memtype, sid, H5P_DEFAULT, &(rdata.front()));
     CloseH5S(sid, err, retErr);
     CloseH5T(tid, err, retErr);
     CloseH5T(memtype, err, retErr);
@@ -25,6 +25,7 @@
 
 //-- H5Support Headers
 #include "H5Support/H5Support.h"
+#include "H5Support/H5DatasetCompression.h"
 #include "H5Support/H5Macros.h"
 
 #ifdef H5Support_USE_MUTEX
@@ -318,6 +319,19 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Creates the dataset creation property list that implements the given compression
+       * settings for a dataset of the given shape. If the settings call for the default contiguous
+       * layout, or the dataset is empty and therefore can not be chunked, H5P_DEFAULT is returned.
+       * Any other returned value must be closed with H5Pclose by the caller.
+       * @param rank The number of dimensions
+       * @param dims The sizes of each dimension, slowest varying first
+       * @param typeSize The size in bytes of a single element
+       * @param compression The requested chunking and compression settings
+       * @return The property list id, H5P_DEFAULT or a negative value on error
+       */
+      static H5Support_EXPORT hid_t createDatasetCreationPropertyList(int32_t rank, const hsize_t* dims, size_t typeSize, const H5DatasetCompression& compression);
+
       /**
        * @brief Writes the data of a pointer to an HDF5 file
        * @param loc_id The hdf5 object id of the parent
@@ -333,12 +347,35 @@ namespace H5Support_NAMESPACE
                                          int32_t   rank,
                                          hsize_t* dims,
                                          T* data)
+      {
+        return writePointerDataset(loc_id, dsetName, rank, dims, data, H5DatasetCompression());
+      }
+
+      /**
+       * @brief Writes the data of a pointer to an HDF5 file using a chunked and optionally
+       * compressed layout.
+       * @param loc_id The hdf5 object id of the parent
+       * @param dsetName The name of the dataset to write to. This can be a name of Path
+       * @param rank The number of dimensions
+       * @param dims The sizes of each dimension
+       * @param data The data to be written.
+       * @param compression The chunking and compression settings for the new dataset
+       * @return Standard hdf5 error condition.
+       */
+      template <typename T>
+      static herr_t writePointerDataset (hid_t loc_id,
+                                         const std::string& dsetName,
+                                         int32_t   rank,
+                                         hsize_t* dims,
+                                         T* data,
+                                         const H5DatasetCompression& compression)
       {
         H5SUPPORT_MUTEX_LOCK()
 
         herr_t err    = -1;
         hid_t did     = -1;
         hid_t sid     = -1;
+        hid_t dcpl    = H5P_DEFAULT;
         herr_t retErr = 0;
 
         if(nullptr == data) { return -2;}
@@ -361,9 +398,15 @@ namespace H5Support_NAMESPACE
         {
           return sid;
         }
+        dcpl = createDatasetCreationPropertyList(rank, dims, sizeof(T), compression);
+        if(dcpl < 0)
+        {
+          H5Sclose(sid);
+          return dcpl;
+        }
         // Create the Dataset
         // This will fail if dsetName contains a "/"!
-        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
         if ( did >= 0 )
         {
           err = H5Dwrite( did, dataType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data );
@@ -393,6 +436,10 @@ namespace H5Support_NAMESPACE
         {
           retErr = did;
         }
+        if(dcpl != H5P_DEFAULT)
+        {
+          H5Pclose(dcpl);
+        }
         /* Terminate access to the data space. */
         err = H5Sclose( sid );
         if (err < 0)
@@ -418,6 +465,29 @@ namespace H5Support_NAMESPACE
                                            int32_t   rank,
                                            hsize_t* dims,
                                            T* data)
+      {
+        return replacePointerDataset(loc_id, dsetName, rank, dims, data, H5DatasetCompression());
+      }
+
+      /**
+       * @brief replacePointerDataset Writes into an existing dataset or, if it does not exist yet,
+       * creates it using the given chunking and compression settings. An existing dataset keeps
+       * the layout it was created with.
+       * @param loc_id
+       * @param dsetName
+       * @param rank
+       * @param dims
+       * @param data
+       * @param compression
+       * @return
+       */
+      template <typename T>
+      static herr_t replacePointerDataset (hid_t loc_id,
+                                           const std::string& dsetName,
+                                           int32_t   rank,
+                                           hsize_t* dims,
+                                           T* data,
+                                           const H5DatasetCompression& compression)
       {
         H5SUPPORT_MUTEX_LOCK()
 
@@ -451,7 +521,17 @@ namespace H5Support_NAMESPACE
         HDF_ERROR_HANDLER_ON
         if ( did < 0 ) // dataset does not exist so create it
         {
-          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+          hid_t dcpl = createDatasetCreationPropertyList(rank, dims, sizeof(T), compression);
+          if(dcpl < 0)
+          {
+            H5Sclose(sid);
+            return dcpl;
+          }
+          did = H5Dcreate (loc_id, dsetName.c_str(), dataType, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+          if(dcpl != H5P_DEFAULT)
+          {
+            H5Pclose(dcpl);
+          }
         }
         if ( did >= 0 )
         {
@@ -662,6 +742,33 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
                                                                  const std::string& dsetName,
                                                                  const std::vector<std::string>& data);
+
+      /**
+      * @brief Writes a list of NUL terminated strings as a variable length string
+      * dataset using a single H5Dwrite call.
+      * @param loc_id The parent location
+      * @param dsetName The name of the dataset
+      * @param data Pointers to the strings. None of the pointers may be nullptr.
+      * @return Standard HDF error condition
+      */
+      static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
+                                                                 const std::string& dsetName,
+                                                                 const std::vector<const char*>& data);
+
+      /**
+      * @brief Writes a list of NUL terminated strings as a variable length string
+      * dataset that is chunked and compressed as described by @p compression. Only
+      * the references to the strings in the global heap are chunked and filtered.
+      * @param loc_id The parent location
+      * @param dsetName The name of the dataset
+      * @param data Pointers to the strings. None of the pointers may be nullptr.
+      * @param compression The chunking and compression settings for the new dataset
+      * @return Standard HDF error condition
+      */
+      static H5Support_EXPORT herr_t writeVectorOfStringsDataset(hid_t loc_id,
+                                                                 const std::string& dsetName,
+                                                                 const std::vector<const char*>& data,
+                                                                 const H5DatasetCompression& compression);
       /**
        * @brief Writes an Attribute to an HDF5 Object
        * @param loc_id The Parent Location of the HDFobject that is getting the attribute
@@ -1118,6 +1225,105 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Reads a strided box (hyperslab) of a dataset into a preallocated array. Each of the
+       * vectors has one entry per dimension of the dataset, in the order the dimensions are stored
+       * in the file (slowest to fastest). The selected values are packed into data in the same
+       * order, so data must hold the product of all the counts.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param start The index of the first value along each dimension
+       * @param stride The step between selected values along each dimension
+       * @param count The number of values to read along each dimension
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& start,
+                                                const std::vector<hsize_t>& stride,
+                                                const std::vector<hsize_t>& count,
+                                                T* data)
+      {
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t err = 0;
+        herr_t retErr = 0;
+        T test = 0x00;
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (loc_id < 0)
+        {
+          std::cout  << "loc_id was Negative: This is not allowed." << std::endl;
+          return -2;
+        }
+        if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        if (start.size() != count.size() || stride.size() != count.size())
+        {
+          std::cout  << "The start, stride and count of a hyperslab must have the same size." << std::endl;
+          return -4;
+        }
+        hid_t did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+        hid_t fileSpaceId = H5Dget_space(did);
+        if (fileSpaceId < 0)
+        {
+          H5Dclose(did);
+          return -1;
+        }
+        int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+        if (rank < 0 || static_cast<size_t>(rank) != count.size())
+        {
+          std::cout  << "The hyperslab rank does not match the rank of dataset " << dsetName << std::endl;
+          H5Sclose(fileSpaceId);
+          H5Dclose(did);
+          return -5;
+        }
+        err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start.data(), stride.data(), count.data(), nullptr);
+        if (err < 0 || H5Sselect_valid(fileSpaceId) <= 0)
+        {
+          std::cout  << "The hyperslab is outside of the extent of dataset " << dsetName << std::endl;
+          H5Sclose(fileSpaceId);
+          H5Dclose(did);
+          return -6;
+        }
+        hid_t memSpaceId = H5Screate_simple(rank, count.data(), nullptr);
+        if (memSpaceId < 0)
+        {
+          H5Sclose(fileSpaceId);
+          H5Dclose(did);
+          return -1;
+        }
+        err = H5Dread(did, dataType, memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+        if (err < 0)
+        {
+          std::cout  << "Error Reading Data." << std::endl;
+          retErr = err;
+        }
+        H5Sclose(memSpaceId);
+        H5Sclose(fileSpaceId);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
@@ -1302,6 +1508,21 @@ namespace H5Support_NAMESPACE
       static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
                                                                const std::string& dsetName,
                                                                std::vector<std::string>& data);
+
+      /**
+      * @brief Reads a 1D string dataset with a single H5Dread into a packed buffer
+      * of NUL terminated strings. Both variable length and fixed width datasets are
+      * supported; fixed width strings are trimmed according to their padding type.
+      * @param loc_id The parent location
+      * @param dsetName The name of the dataset
+      * @param buffer The packed string data
+      * @param offsets The offset of each string inside the buffer
+      * @return Standard HDF error condition
+      */
+      static H5Support_EXPORT herr_t readVectorOfStringDataset(hid_t loc_id,
+                                                               const std::string& dsetName,
+                                                               std::vector<char>& buffer,
+                                                               std::vector<size_t>& offsets);
       /**
        * @brief Reads an Attribute from an HDF5 Object.
        *
@@ -243,6 +243,50 @@ namespace H5Support_NAMESPACE
         return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data);
       }
 
+      /**
+       * @brief Writes the data of a pointer to an HDF5 file using the chunking and
+       * compression settings in @p compression.
+       * @param loc_id The hdf5 object id of the parent
+       * @param dsetName The name of the dataset to write to. This can be a name of Path
+       * @param rank The number of dimensions
+       * @param dims The sizes of each dimension
+       * @param data The data to be written.
+       * @param compression The dataset layout/filter options
+       * @return Standard hdf5 error condition.
+       */
+      template <typename T>
+      static herr_t writePointerDataset (hid_t loc_id,
+                                         const QString& dsetName,
+                                         int32_t   rank,
+                                         hsize_t* dims,
+                                         T* data,
+                                         const H5DatasetCompression& compression)
+      {
+        return H5Lite::writePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, compression);
+      }
+
+      /**
+       * @brief Replaces (or creates) a dataset using the chunking and compression
+       * settings in @p compression. The settings only apply when the dataset is created.
+       * @param loc_id The hdf5 object id of the parent
+       * @param dsetName The name of the dataset
+       * @param rank The number of dimensions
+       * @param dims The sizes of each dimension
+       * @param data The data to be written.
+       * @param compression The dataset layout/filter options
+       * @return Standard hdf5 error condition.
+       */
+      template <typename T>
+      static herr_t replacePointerDataset (hid_t loc_id,
+                                           const QString& dsetName,
+                                           int32_t   rank,
+                                           hsize_t* dims,
+                                           T* data,
+                                           const H5DatasetCompression& compression)
+      {
+        return H5Lite::replacePointerDataset(loc_id, dsetName.toStdString(), rank, dims, data, compression);
+      }
+
 
       /**
        * @brief Creates a Dataset with the given name at the location defined by loc_id
@@ -460,6 +504,28 @@ namespace H5Support_NAMESPACE
         return H5Lite::readPointerDataset(loc_id, dsetName.toStdString(), data);
       }
 
+      /**
+       * @brief Reads a strided box (hyperslab) of a dataset into a preallocated array.
+       * @see H5Lite::readPointerDatasetHyperslab
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param start The index of the first value along each dimension
+       * @param stride The step between selected values along each dimension
+       * @param count The number of values to read along each dimension
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const QVector<hsize_t>& start,
+                                                const QVector<hsize_t>& stride,
+                                                const QVector<hsize_t>& count,
+                                                T* data)
+      {
+        return H5Lite::readPointerDatasetHyperslab(loc_id, dsetName.toStdString(), start.toStdVector(), stride.toStdVector(), count.toStdVector(), data);
+      }
+
 
       /**
        * @brief Reads data from the HDF5 File into an QVector<T> object. If the dataset
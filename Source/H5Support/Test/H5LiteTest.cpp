@@ -1439,6 +1439,79 @@ public:
 
 #endif
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompressedDatasets()
+  {
+    hid_t file_id = H5Fcreate(UnitTest::H5LiteTest::FileName.toLatin1().data(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    DREAM3D_REQUIRE(file_id > 0)
+
+    const int32_t rank = 3;
+    hsize_t dims[rank] = {8, 64, 64};
+    std::vector<int32_t> data(dims[0] * dims[1] * dims[2]);
+    for(size_t i = 0; i < data.size(); i++)
+    {
+      data[i] = static_cast<int32_t>(i / 1024);
+    }
+
+    H5DatasetCompression compression;
+    compression.CompressionLevel = 6;
+    compression.Chunking = H5DatasetCompression::ChunkPolicy::Slice;
+    herr_t err = H5Lite::writePointerDataset(file_id, "Slice", rank, dims, data.data(), compression);
+    DREAM3D_REQUIRE(err >= 0)
+
+    compression.Chunking = H5DatasetCompression::ChunkPolicy::Automatic;
+    compression.ChunkTargetBytes = 4096;
+    err = QH5Lite::writePointerDataset(file_id, "Automatic", rank, dims, data.data(), compression);
+    DREAM3D_REQUIRE(err >= 0)
+
+    // A default constructed value must keep the contiguous layout
+    err = H5Lite::writePointerDataset(file_id, "Contiguous", rank, dims, data.data(), H5DatasetCompression());
+    DREAM3D_REQUIRE(err >= 0)
+
+    hsize_t chunkDims[rank] = {0, 0, 0};
+    hid_t did = H5Dopen(file_id, "Slice", H5P_DEFAULT);
+    hid_t dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CHUNKED)
+    DREAM3D_REQUIRE_EQUAL(H5Pget_chunk(dcpl, rank, chunkDims), rank)
+    DREAM3D_REQUIRE_EQUAL(chunkDims[0], static_cast<hsize_t>(1))
+    DREAM3D_REQUIRE_EQUAL(chunkDims[1], dims[1])
+    DREAM3D_REQUIRE_EQUAL(chunkDims[2], dims[2])
+    H5Pclose(dcpl);
+    H5Dclose(did);
+
+    did = H5Dopen(file_id, "Automatic", H5P_DEFAULT);
+    dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CHUNKED)
+    H5Pget_chunk(dcpl, rank, chunkDims);
+    DREAM3D_REQUIRED(chunkDims[0] * chunkDims[1] * chunkDims[2] * sizeof(int32_t), <=, compression.ChunkTargetBytes)
+    H5Pclose(dcpl);
+    H5Dclose(did);
+
+    did = H5Dopen(file_id, "Contiguous", H5P_DEFAULT);
+    dcpl = H5Dget_create_plist(did);
+    DREAM3D_REQUIRE_EQUAL(H5Pget_layout(dcpl), H5D_CONTIGUOUS)
+    H5Pclose(dcpl);
+    H5Dclose(did);
+
+    // Read everything back and make sure the filters are transparent
+    std::vector<int32_t> readBack;
+    err = H5Lite::readVectorDataset(file_id, "Slice", readBack);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(readBack == data)
+    err = H5Lite::readVectorDataset(file_id, "Automatic", readBack);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE(readBack == data)
+
+    // Replacing an existing dataset with compression options must still work
+    err = H5Lite::replacePointerDataset(file_id, "Slice", rank, dims, data.data(), compression);
+    DREAM3D_REQUIRE(err >= 0)
+
+    err = H5Fclose(file_id);
+    DREAM3D_REQUIRE(err >= 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1447,6 +1520,7 @@ public:
     int err = EXIT_SUCCESS;
 
     DREAM3D_REGISTER_TEST(TestVLengStringReadWrite())
+    DREAM3D_REGISTER_TEST(TestCompressedDatasets())
 
     DREAM3D_REGISTER_TEST(TestTypeDetection())
     DREAM3D_REGISTER_TEST(QH5LiteTest())
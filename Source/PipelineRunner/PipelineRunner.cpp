@@ -47,6 +47,9 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QSettings>
 #include <QtCore/QString>
 #include <QtCore/QtDebug>
@@ -58,12 +61,43 @@
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "PipelineRunnerService.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RunOnService(const QString& serverName, const QJsonObject& request)
+{
+  QJsonObject response;
+  if(!PipelineRunnerService::SendRequest(serverName, request, response))
+  {
+    return EXIT_FAILURE;
+  }
+
+  for(const QJsonValue& value : response[SIMPL::JSON::PipelineErrors].toArray())
+  {
+    QJsonObject error = value.toObject();
+    std::cout << "Error (" << error[SIMPL::JSON::Code].toInt() << ") " << error[SIMPL::JSON::FilterHumanLabel].toString().toStdString() << ": "
+              << error[SIMPL::JSON::Message].toString().toStdString() << std::endl;
+  }
+  int err = response[SIMPL::JSON::ErrorCode].toInt();
+  if(err < 0)
+  {
+    std::cout << response[SIMPL::JSON::ErrorMessage].toString().toStdString() << std::endl;
+    std::cout << "Error Condition of Pipeline: " << err << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -92,20 +126,75 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption profileFileArg(QStringList() << "profile", "Write the time and memory used by each filter to a JSON file.", "file");
+  parser.addOption(profileFileArg);
+
+  QCommandLineOption traceFileArg(QStringList() << "trace", "Write the time and memory used by each filter as a Chrome trace (chrome://tracing, Perfetto).", "file");
+  parser.addOption(traceFileArg);
+
+  QCommandLineOption serveArg(QStringList() << "serve", "Stay resident and run the pipelines sent to the local socket with this name.", "name");
+  parser.addOption(serveArg);
+
+  QCommandLineOption cacheSizeArg(QStringList() << "cache-size", "The number of parsed pipelines the resident service keeps (default 16).", "count", "16");
+  parser.addOption(cacheSizeArg);
+
+  QCommandLineOption serverArg(QStringList() << "server", "Run the pipeline on the resident service listening on the local socket with this name.", "name");
+  parser.addOption(serverArg);
+
+  QCommandLineOption parametersArg(QStringList() << "parameters",
+                                   "JSON object of filter parameters that replace the ones in the pipeline file, keyed by filter index, i.e. {\"0\": {\"InputFile\": \"a.ang\"}}.",
+                                   "json");
+  parser.addOption(parametersArg);
+
+  QCommandLineOption shutdownArg(QStringList() << "shutdown", "Stop the resident service given with --server.");
+  parser.addOption(shutdownArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
 
+  // Hand the pipeline to a resident service. The plugins are not loaded in this process.
+  if(parser.isSet(serverArg))
+  {
+    QJsonObject request;
+    if(parser.isSet(shutdownArg))
+    {
+      request[SIMPL::JSON::Shutdown] = true;
+      return RunOnService(parser.value(serverArg), request);
+    }
+
+    request[SIMPL::JSON::Pipeline] = QFileInfo(pipelineFile).absoluteFilePath();
+    // Lets the service resolve relative paths in --parameters the way a local run would
+    request[SIMPL::JSON::WorkingDirectory] = QDir::currentPath();
+    if(parser.isSet(parametersArg))
+    {
+      QJsonDocument doc = QJsonDocument::fromJson(parser.value(parametersArg).toUtf8());
+      if(!doc.isObject())
+      {
+        std::cout << "The --parameters value is not a JSON object. Exiting now." << std::endl;
+        return EXIT_FAILURE;
+      }
+      request[SIMPL::JSON::FilterParameters] = doc.object();
+    }
+    return RunOnService(parser.value(serverArg), request);
+  }
+
   std::cout << "PipelineRunner Starting. " << std::endl;
   std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
 
-  // Register all the filters including trying to load those from Plugins
+  // Register all the filters from the plugin manifest. Only the plugins the pipeline references are loaded.
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginFiltersLazily(fm);
 
   QMetaObjectUtilities::RegisterMetaTypes();
 
+  if(parser.isSet(serveArg))
+  {
+    PipelineRunnerService service(parser.value(cacheSizeArg).toInt());
+    return service.exec(parser.value(serveArg));
+  }
+
   int err = 0;
 
   // Sanity Check the filepath to make sure it exists, Report an error and bail if it does not
@@ -155,6 +244,17 @@ int main(int argc, char* argv[])
   // Now actually execute the pipeline
   pipeline->execute();
   err = pipeline->getErrorCondition();
+
+  // The profile is written even if the pipeline failed so the failing filter can be looked at
+  PipelineProfile::Pointer profile = pipeline->getProfile();
+  if(parser.isSet(profileFileArg) && !profile->writeJson(parser.value(profileFileArg)))
+  {
+    std::cout << "Unable to write the profile to '" << parser.value(profileFileArg).toStdString() << "'" << std::endl;
+  }
+  if(parser.isSet(traceFileArg) && !profile->writeChromeTrace(parser.value(traceFileArg)))
+  {
+    std::cout << "Unable to write the trace to '" << parser.value(traceFileArg).toStdString() << "'" << std::endl;
+  }
   if(err < 0)
   {
     std::cout << "Error Condition of Pipeline: " << err << std::endl;
@@ -0,0 +1,494 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineRunnerService.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/InputPathFilterParameter.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/OutputPathFilterParameter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+const int k_ConnectTimeout = 5000;
+
+/**
+ * @brief The ServiceObserver class prints the pipeline messages like the Observer does and keeps the
+ * errors and warnings of the current run so they can be sent back to the client.
+ */
+class ServiceObserver : public Observer
+{
+public:
+  ServiceObserver() = default;
+  ~ServiceObserver() override = default;
+
+  void processPipelineMessage(const PipelineMessage& pm) override
+  {
+    if(pm.getType() == PipelineMessage::MessageType::Error || pm.getType() == PipelineMessage::MessageType::Warning)
+    {
+      QJsonObject message;
+      message[SIMPL::JSON::Code] = pm.getCode();
+      message[SIMPL::JSON::Message] = pm.getText();
+      message[SIMPL::JSON::FilterHumanLabel] = pm.getFilterHumanLabel();
+      message[SIMPL::JSON::FilterIndex] = pm.getPipelineIndex();
+      if(pm.getType() == PipelineMessage::MessageType::Error)
+      {
+        Errors.push_back(message);
+      }
+      else
+      {
+        Warnings.push_back(message);
+      }
+    }
+    Observer::processPipelineMessage(pm);
+  }
+
+  void clear()
+  {
+    Errors = QJsonArray();
+    Warnings = QJsonArray();
+  }
+
+  QJsonArray Errors;
+  QJsonArray Warnings;
+
+public:
+  ServiceObserver(const ServiceObserver&) = delete; // Copy Constructor Not Implemented
+  ServiceObserver(ServiceObserver&&) = delete;      // Move Constructor Not Implemented
+  ServiceObserver& operator=(const ServiceObserver&) = delete; // Copy Assignment Not Implemented
+  ServiceObserver& operator=(ServiceObserver&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief CreateErrorResponse
+ * @param code
+ * @param message
+ * @return
+ */
+QJsonObject CreateErrorResponse(int code, const QString& message)
+{
+  QJsonObject response;
+  response[SIMPL::JSON::ErrorCode] = code;
+  response[SIMPL::JSON::ErrorMessage] = message;
+  response[SIMPL::JSON::Completed] = false;
+  return response;
+}
+
+/**
+ * @brief ResolvePath Makes a relative path absolute against the working directory of the client
+ * @param value
+ * @param workingDir
+ * @return
+ */
+QJsonValue ResolvePath(const QJsonValue& value, const QDir& workingDir)
+{
+  QString path = value.toString();
+  if(!value.isString() || path.isEmpty() || QDir::isAbsolutePath(path))
+  {
+    return value;
+  }
+  return QDir::cleanPath(workingDir.absoluteFilePath(path));
+}
+
+/**
+ * @brief ResolveRelativePaths Returns the values with the file and directory parameter of the filter
+ * resolved against the working directory of the client. The service usually runs in another directory.
+ * @param parameter
+ * @param values
+ * @param workingDir
+ * @return
+ */
+QJsonObject ResolveRelativePaths(const FilterParameter::Pointer& parameter, QJsonObject values, const QDir& workingDir)
+{
+  const QString propertyName = parameter->getPropertyName();
+  FilterParameter* fp = parameter.get();
+  if(nullptr != dynamic_cast<InputFileFilterParameter*>(fp) || nullptr != dynamic_cast<OutputFileFilterParameter*>(fp) || nullptr != dynamic_cast<InputPathFilterParameter*>(fp) ||
+     nullptr != dynamic_cast<OutputPathFilterParameter*>(fp))
+  {
+    values[propertyName] = ResolvePath(values[propertyName], workingDir);
+  }
+  else if(nullptr != dynamic_cast<FileListInfoFilterParameter*>(fp) && values[propertyName].isObject())
+  {
+    QJsonObject fileListInfo = values[propertyName].toObject();
+    fileListInfo["InputPath"] = ResolvePath(fileListInfo["InputPath"], workingDir);
+    values[propertyName] = fileListInfo;
+  }
+  return values;
+}
+} // namespace
+
+/**
+ * @brief The CachedPipeline struct is one entry of the pipeline cache. The observer is declared first
+ * so that it outlives the pipeline that holds a pointer to it.
+ */
+struct PipelineRunnerService::CachedPipeline
+{
+  ServiceObserver Messages;
+  FilterPipeline::Pointer Pipeline;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRunnerService::PipelineRunnerService(int cacheSize)
+: m_Cache(cacheSize > 0 ? cacheSize : 1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRunnerService::~PipelineRunnerService() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineRunnerService::exec(const QString& serverName)
+{
+  QLocalServer server;
+  server.setSocketOptions(QLocalServer::UserAccessOption);
+  if(!server.listen(serverName))
+  {
+    // A socket file left behind by a service that did not shut down cleanly blocks the name. Only
+    // remove it if nobody answers on it.
+    QLocalSocket probe;
+    probe.connectToServer(serverName);
+    if(probe.waitForConnected(k_ConnectTimeout))
+    {
+      std::cout << "A PipelineRunner service is already listening on '" << serverName.toStdString() << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    QLocalServer::removeServer(serverName);
+    if(!server.listen(serverName))
+    {
+      std::cout << "Unable to listen on '" << serverName.toStdString() << "': " << server.errorString().toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "PipelineRunner service listening on '" << server.fullServerName().toStdString() << "'" << std::endl;
+
+  m_ShutdownRequested = false;
+  while(!m_ShutdownRequested && server.waitForNewConnection(-1))
+  {
+    QLocalSocket* socket = server.nextPendingConnection();
+    if(nullptr != socket)
+    {
+      serveConnection(socket);
+      delete socket;
+    }
+  }
+
+  server.close();
+  m_Cache.clear();
+  std::cout << "PipelineRunner service stopped." << std::endl;
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRunnerService::serveConnection(QLocalSocket* socket)
+{
+  while(!m_ShutdownRequested)
+  {
+    if(!socket->canReadLine())
+    {
+      if(socket->state() != QLocalSocket::ConnectedState || !socket->waitForReadyRead(-1))
+      {
+        break;
+      }
+      continue;
+    }
+
+    QByteArray line = socket->readLine().trimmed();
+    if(line.isEmpty())
+    {
+      continue;
+    }
+
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(line, &parseError);
+    QJsonObject response;
+    if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+    {
+      response = CreateErrorResponse(-80, QObject::tr("The request is not a JSON object: %1").arg(parseError.errorString()));
+    }
+    else
+    {
+      response = handleRequest(doc.object());
+    }
+
+    socket->write(QJsonDocument(response).toJson(QJsonDocument::Compact));
+    socket->write("\n");
+    socket->waitForBytesWritten(-1);
+  }
+
+  if(socket->state() == QLocalSocket::ConnectedState)
+  {
+    socket->disconnectFromServer();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineRunnerService::handleRequest(const QJsonObject& request)
+{
+  if(request[SIMPL::JSON::Shutdown].toBool(false))
+  {
+    m_ShutdownRequested = true;
+    QJsonObject response;
+    response[SIMPL::JSON::ErrorCode] = 0;
+    response[SIMPL::JSON::ErrorMessage] = QString("");
+    return response;
+  }
+
+  // Relative paths in the request are relative to the client, not to this process
+  QDir workingDir(request[SIMPL::JSON::WorkingDirectory].toString(QDir::currentPath()));
+  QString pipelineFile = ResolvePath(request[SIMPL::JSON::Pipeline], workingDir).toString();
+  bool cacheHit = false;
+  QString errorMessage;
+  CachedPipeline* cached = findOrLoadPipeline(pipelineFile, cacheHit, errorMessage);
+  if(nullptr == cached)
+  {
+    return CreateErrorResponse(-81, errorMessage);
+  }
+
+  FilterPipeline::Pointer pipeline = cached->Pipeline;
+  FilterPipeline::FilterContainerType& filters = pipeline->getFilterContainer();
+
+  // Re-bind the requested parameters and remember their values from the pipeline file
+  std::vector<std::pair<FilterParameter::Pointer, QJsonObject>> originalValues;
+  QJsonObject overrides = request[SIMPL::JSON::FilterParameters].toObject();
+  int err = 0;
+  for(auto iter = overrides.constBegin(); iter != overrides.constEnd() && err >= 0; ++iter)
+  {
+    bool ok = false;
+    int index = iter.key().toInt(&ok);
+    if(!ok || index < 0 || index >= filters.size())
+    {
+      errorMessage = QObject::tr("The pipeline has no filter at index '%1'").arg(iter.key());
+      err = -82;
+      break;
+    }
+
+    AbstractFilter::Pointer filter = filters[index];
+    QJsonObject values = iter.value().toObject();
+    QVector<FilterParameter::Pointer> parameters = filter->getFilterParameters();
+    for(const QString& propertyName : values.keys())
+    {
+      auto parameter = std::find_if(parameters.begin(), parameters.end(), [&propertyName](const FilterParameter::Pointer& fp) { return fp->getPropertyName() == propertyName; });
+      if(parameter == parameters.end())
+      {
+        errorMessage = QObject::tr("Filter %1 (%2) has no parameter '%3'").arg(index).arg(filter->getHumanLabel()).arg(propertyName);
+        err = -83;
+        break;
+      }
+      QJsonObject original;
+      (*parameter)->writeJson(original);
+      originalValues.emplace_back(*parameter, original);
+      (*parameter)->readJson(ResolveRelativePaths(*parameter, values, workingDir));
+    }
+  }
+
+  cached->Messages.clear();
+  if(err >= 0)
+  {
+    err = pipeline->preflightPipeline();
+    if(err < 0)
+    {
+      errorMessage = QObject::tr("Errors preflighting the pipeline");
+    }
+    else
+    {
+      pipeline->execute();
+      err = pipeline->getErrorCondition();
+      if(err < 0)
+      {
+        errorMessage = QObject::tr("Errors executing the pipeline");
+      }
+    }
+    // The data of this run must not stay alive while the pipeline sits in the cache
+    pipeline->releaseDataContainerArray();
+  }
+
+  // Put the parameters back in reverse order so a parameter that was given twice ends up at its original value
+  for(auto iter = originalValues.rbegin(); iter != originalValues.rend(); ++iter)
+  {
+    iter->first->readJson(iter->second);
+  }
+
+  QJsonObject response;
+  response[SIMPL::JSON::ErrorCode] = err;
+  response[SIMPL::JSON::ErrorMessage] = errorMessage;
+  response[SIMPL::JSON::PipelineErrors] = cached->Messages.Errors;
+  response[SIMPL::JSON::PipelineWarnings] = cached->Messages.Warnings;
+  response[SIMPL::JSON::Completed] = (err >= 0);
+  response[SIMPL::JSON::CacheHit] = cacheHit;
+  cached->Messages.clear();
+  return response;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRunnerService::CachedPipeline* PipelineRunnerService::findOrLoadPipeline(const QString& filePath, bool& cacheHit, QString& errorMessage)
+{
+  cacheHit = false;
+  QFileInfo fi(filePath);
+  if(!fi.exists())
+  {
+    errorMessage = QObject::tr("The input file '%1' does not exist").arg(filePath);
+    return nullptr;
+  }
+
+  QString ext = fi.suffix();
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  QByteArray contents;
+  if(ext == "json")
+  {
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+      errorMessage = QObject::tr("Unable to read the pipeline file '%1'").arg(filePath);
+      return nullptr;
+    }
+    contents = file.readAll();
+    hash.addData(contents);
+  }
+  else if(ext == "dream3d")
+  {
+    // Hashing the whole data file would cost more than reading the pipeline out of it
+    hash.addData(fi.absoluteFilePath().toUtf8());
+    hash.addData(QByteArray::number(fi.size()));
+    hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+  }
+  else
+  {
+    errorMessage = QObject::tr("Unsupported pipeline file type '%1'").arg(ext);
+    return nullptr;
+  }
+
+  QByteArray key = hash.result();
+  CachedPipeline* cached = m_Cache.object(key);
+  if(nullptr != cached)
+  {
+    cacheHit = true;
+    return cached;
+  }
+
+  cached = new CachedPipeline;
+  if(ext == "json")
+  {
+    JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+    cached->Pipeline = jsonReader->readPipelineFromString(QString::fromUtf8(contents), &cached->Messages);
+  }
+  else
+  {
+    H5FilterParametersReader::Pointer dream3dReader = H5FilterParametersReader::New();
+    cached->Pipeline = dream3dReader->readPipelineFromFile(filePath, &cached->Messages);
+  }
+
+  if(nullptr == cached->Pipeline.get())
+  {
+    errorMessage = QObject::tr("An error occurred trying to read the pipeline file '%1'").arg(filePath);
+    delete cached;
+    return nullptr;
+  }
+
+  cached->Pipeline->addMessageReceiver(&cached->Messages);
+  m_Cache.insert(key, cached);
+  return cached;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineRunnerService::SendRequest(const QString& serverName, const QJsonObject& request, QJsonObject& response)
+{
+  QLocalSocket socket;
+  socket.connectToServer(serverName);
+  if(!socket.waitForConnected(k_ConnectTimeout))
+  {
+    std::cout << "Unable to connect to the PipelineRunner service '" << serverName.toStdString() << "': " << socket.errorString().toStdString() << std::endl;
+    return false;
+  }
+
+  socket.write(QJsonDocument(request).toJson(QJsonDocument::Compact));
+  socket.write("\n");
+  if(!socket.waitForBytesWritten(k_ConnectTimeout))
+  {
+    std::cout << "Unable to send the request to the PipelineRunner service: " << socket.errorString().toStdString() << std::endl;
+    return false;
+  }
+
+  // The pipeline runs before the answer comes back so there is no timeout here
+  while(!socket.canReadLine())
+  {
+    if(!socket.waitForReadyRead(-1))
+    {
+      std::cout << "The PipelineRunner service closed the connection without answering." << std::endl;
+      return false;
+    }
+  }
+
+  QJsonDocument doc = QJsonDocument::fromJson(socket.readLine());
+  response = doc.object();
+  socket.disconnectFromServer();
+  return doc.isObject();
+}
@@ -0,0 +1,123 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+class QLocalSocket;
+
+/**
+ * @brief The PipelineRunnerService class keeps a PipelineRunner process resident so that many short
+ * pipelines can be run without paying for process startup, plugin loading and pipeline parsing on every
+ * run. Clients connect to a local socket (a Unix domain socket or a named pipe on Windows) and send one
+ * JSON request per line:
+ *
+ *   {"Pipeline": "/path/to/Pipeline.json", "FilterParameters": {"0": {"InputFile": "/data/scan_0001.ang"}}}
+ *
+ * "FilterParameters" is optional and maps the index of a filter in the pipeline to the values of the
+ * filter parameters that are re-bound for this run only; the values use the same JSON layout as the
+ * pipeline file. The optional "WorkingDirectory" is the directory that a relative pipeline path and
+ * relative values of file and directory parameters are resolved against; it defaults to the working
+ * directory of the service. Parsed pipelines are cached by the SHA-1 hash of the pipeline file (of the
+ * path, size and modification time for .dream3d files) so a file that is edited between runs is parsed
+ * again. Each
+ * request is answered with one JSON line that holds the ErrorCode, ErrorMessage, PipelineErrors,
+ * PipelineWarnings, Completed and CacheHit values. A request of {"Shutdown": true} stops the service.
+ * Requests are run one after the other.
+ */
+class PipelineRunnerService
+{
+public:
+  /**
+   * @brief PipelineRunnerService The filters must already be registered with the FilterManager.
+   * @param cacheSize The maximum number of parsed pipelines that are kept
+   */
+  explicit PipelineRunnerService(int cacheSize);
+  ~PipelineRunnerService();
+
+  /**
+   * @brief exec Listens on serverName and answers requests until a shutdown request arrives.
+   * @param serverName
+   * @return EXIT_SUCCESS or EXIT_FAILURE if the server could not listen on serverName
+   */
+  int exec(const QString& serverName);
+
+  /**
+   * @brief handleRequest Runs a single request and returns the response.
+   * @param request
+   * @return
+   */
+  QJsonObject handleRequest(const QJsonObject& request);
+
+  /**
+   * @brief SendRequest Connects to a running service, sends the request and waits for the response.
+   * @param serverName
+   * @param request
+   * @param response
+   * @return False if the service could not be reached or did not answer.
+   */
+  static bool SendRequest(const QString& serverName, const QJsonObject& request, QJsonObject& response);
+
+private:
+  struct CachedPipeline;
+
+  QCache<QByteArray, CachedPipeline> m_Cache;
+  bool m_ShutdownRequested = false;
+
+  /**
+   * @brief findOrLoadPipeline Returns the cached pipeline for the file or reads and caches it.
+   * @param filePath
+   * @param cacheHit Set to true if the pipeline came from the cache
+   * @param errorMessage Set if the pipeline could not be read
+   * @return The pipeline or nullptr. The pointer is owned by the cache.
+   */
+  CachedPipeline* findOrLoadPipeline(const QString& filePath, bool& cacheHit, QString& errorMessage);
+
+  /**
+   * @brief serveConnection Answers the requests of one client until it disconnects.
+   * @param socket
+   */
+  void serveConnection(QLocalSocket* socket);
+
+public:
+  PipelineRunnerService(const PipelineRunnerService&) = delete; // Copy Constructor Not Implemented
+  PipelineRunnerService(PipelineRunnerService&&) = delete;      // Move Constructor Not Implemented
+  PipelineRunnerService& operator=(const PipelineRunnerService&) = delete; // Copy Assignment Not Implemented
+  PipelineRunnerService& operator=(PipelineRunnerService&&) = delete;      // Move Assignment Not Implemented
+};
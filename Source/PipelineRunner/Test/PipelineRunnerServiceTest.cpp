@@ -0,0 +1,267 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+#include "PipelineRunnerService.h"
+
+#include "PipelineRunnerTestFileLocations.h"
+#include "UnitTestSupport.hpp"
+
+class PipelineRunnerServiceTest
+{
+public:
+  PipelineRunnerServiceTest() = default;
+  virtual ~PipelineRunnerServiceTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::PipelineRunnerServiceTest::PipelineFile);
+    QFile::remove(UnitTest::PipelineRunnerServiceTest::OutputFile);
+    QFile::remove(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // Writes a pipeline that creates a DataContainer and writes it to the given file
+  // -----------------------------------------------------------------------------
+  void writePipelineFile(const QString& dataContainerName)
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDataContainer = CreateDataContainer::New();
+    createDataContainer->setDataContainerName(dataContainerName);
+    pipeline->pushBack(createDataContainer);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setOutputFile(UnitTest::PipelineRunnerServiceTest::OutputFile);
+    writer->setWriteXdmfFile(false);
+    pipeline->pushBack(writer);
+
+    JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
+    int err = jsonWriter->writePipelineToFile(pipeline, UnitTest::PipelineRunnerServiceTest::PipelineFile, "PipelineRunnerServiceTest");
+    DREAM3D_REQUIRED(err, >=, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject createRequest()
+  {
+    QJsonObject request;
+    request[SIMPL::JSON::Pipeline] = UnitTest::PipelineRunnerServiceTest::PipelineFile;
+    return request;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineCache()
+  {
+    writePipelineFile("DataContainer");
+    PipelineRunnerService service(4);
+
+    QJsonObject response = service.handleRequest(createRequest());
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(response[SIMPL::JSON::Completed].toBool())
+    DREAM3D_REQUIRE(!response[SIMPL::JSON::CacheHit].toBool())
+    DREAM3D_REQUIRE(QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::OutputFile))
+
+    response = service.handleRequest(createRequest());
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(response[SIMPL::JSON::CacheHit].toBool())
+
+    // An edited pipeline file must be parsed again
+    writePipelineFile("EditedDataContainer");
+    response = service.handleRequest(createRequest());
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(!response[SIMPL::JSON::CacheHit].toBool())
+
+    // A relative pipeline path is resolved against the working directory of the request
+    QJsonObject request;
+    request[SIMPL::JSON::Pipeline] = QFileInfo(UnitTest::PipelineRunnerServiceTest::PipelineFile).fileName();
+    request[SIMPL::JSON::WorkingDirectory] = UnitTest::TestTempDir;
+    response = service.handleRequest(request);
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(response[SIMPL::JSON::CacheHit].toBool())
+
+    RemoveTestFiles();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestParameterBinding()
+  {
+    writePipelineFile("DataContainer");
+    PipelineRunnerService service(4);
+
+    // A relative path is resolved against the working directory of the client
+    QJsonObject values;
+    values["OutputFile"] = QFileInfo(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile).fileName();
+    QJsonObject overrides;
+    overrides["1"] = values;
+    QJsonObject request = createRequest();
+    request[SIMPL::JSON::FilterParameters] = overrides;
+    request[SIMPL::JSON::WorkingDirectory] = UnitTest::TestTempDir;
+
+    QJsonObject response = service.handleRequest(request);
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile))
+    DREAM3D_REQUIRE(!QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::OutputFile))
+
+    // The next run without overrides uses the values from the pipeline file again
+    response = service.handleRequest(createRequest());
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(response[SIMPL::JSON::CacheHit].toBool())
+    DREAM3D_REQUIRE(QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::OutputFile))
+
+    // A filter index that is not in the pipeline
+    QFile::remove(UnitTest::PipelineRunnerServiceTest::OutputFile);
+    QFile::remove(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile);
+    overrides = QJsonObject();
+    overrides["1"] = values;
+    overrides["5"] = values;
+    request[SIMPL::JSON::FilterParameters] = overrides;
+    response = service.handleRequest(request);
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), -82)
+    DREAM3D_REQUIRE(!response[SIMPL::JSON::Completed].toBool())
+    DREAM3D_REQUIRE(!QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile))
+
+    // A property the filter does not have; OutputFile was re-bound before the error
+    QJsonObject badValues = values;
+    badValues["NoSuchProperty"] = 1;
+    overrides = QJsonObject();
+    overrides["1"] = badValues;
+    request[SIMPL::JSON::FilterParameters] = overrides;
+    response = service.handleRequest(request);
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), -83)
+    DREAM3D_REQUIRE(!QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile))
+
+    // Both failed requests must have put the original values back
+    response = service.handleRequest(createRequest());
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::OutputFile))
+    DREAM3D_REQUIRE(!QFileInfo::exists(UnitTest::PipelineRunnerServiceTest::ReboundOutputFile))
+
+    RemoveTestFiles();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestShutdown()
+  {
+    {
+      PipelineRunnerService service(4);
+      QJsonObject request;
+      request[SIMPL::JSON::Shutdown] = true;
+      QJsonObject response = service.handleRequest(request);
+      DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    }
+
+    writePipelineFile("DataContainer");
+    QString serverName = QString("PipelineRunnerServiceTest_%1").arg(QCoreApplication::applicationPid());
+    PipelineRunnerService service(4);
+    int exitCode = EXIT_FAILURE;
+    std::thread serviceThread([&service, &serverName, &exitCode] { exitCode = service.exec(serverName); });
+
+    // The server may take a moment before it listens
+    QJsonObject response;
+    bool sent = false;
+    for(int i = 0; i < 100 && !sent; i++)
+    {
+      sent = PipelineRunnerService::SendRequest(serverName, createRequest(), response);
+      if(!sent)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      }
+    }
+    DREAM3D_REQUIRE(sent)
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE(response[SIMPL::JSON::Completed].toBool())
+
+    QJsonObject shutdown;
+    shutdown[SIMPL::JSON::Shutdown] = true;
+    sent = PipelineRunnerService::SendRequest(serverName, shutdown, response);
+    serviceThread.join();
+    DREAM3D_REQUIRE(sent)
+    DREAM3D_REQUIRE_EQUAL(response[SIMPL::JSON::ErrorCode].toInt(), 0)
+    DREAM3D_REQUIRE_EQUAL(exitCode, EXIT_SUCCESS)
+
+    // Nobody is listening anymore
+    DREAM3D_REQUIRE(!PipelineRunnerService::SendRequest(serverName, createRequest(), response))
+
+    RemoveTestFiles();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### PipelineRunnerServiceTest Starting ####" << std::endl;
+
+    QDir().mkpath(UnitTest::TestTempDir);
+
+    DREAM3D_REGISTER_TEST(TestPipelineCache());
+    DREAM3D_REGISTER_TEST(TestParameterBinding());
+    DREAM3D_REGISTER_TEST(TestShutdown());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+public:
+  PipelineRunnerServiceTest(const PipelineRunnerServiceTest&) = delete; // Copy Constructor Not Implemented
+  PipelineRunnerServiceTest(PipelineRunnerServiceTest&&) = delete;      // Move Constructor Not Implemented
+  PipelineRunnerServiceTest& operator=(const PipelineRunnerServiceTest&) = delete; // Copy Assignment Not Implemented
+  PipelineRunnerServiceTest& operator=(PipelineRunnerServiceTest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -62,6 +62,7 @@
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
 #include "SIMPLib/SIMPLib.h"
@@ -146,6 +147,9 @@ int main(int argc, char* argv[])
   // Configure static file controller
   SIMPLStaticFileController::CreateInstance(&serverSettings, &app);
 
+  // Configure the worker pool that executes submitted pipelines
+  PipelineJobQueue::CreateInstance(&serverSettings);
+
   // Configure and start the TCP listener
   QSharedPointer<HttpListener> httpListener = QSharedPointer<HttpListener>(new HttpListener(&serverSettings, new SIMPLRequestMapper(&app), &app));
 
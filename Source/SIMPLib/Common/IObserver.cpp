@@ -79,5 +79,9 @@ void IObserver::processPipelineMessage(const PipelineMessage& pm)
   {
     ss << msg.getProgressValue() << msg.generateStatusString();
   }
+  else if(msg.getType() == PipelineMessage::MessageType::FilterProfile)
+  {
+    ss << msg.generateProfileString();
+  }
   std::cout << msg.getFilterHumanLabel().toStdString() << ": " << str.toStdString() << std::endl;
 }
@@ -55,6 +55,7 @@ PipelineMessage::PipelineMessage(const PipelineMessage& rhs)
   m_Type = rhs.m_Type;
   m_ProgressValue = rhs.m_ProgressValue;
   m_PipelineIndex = rhs.m_PipelineIndex;
+  m_ProfileData = rhs.m_ProfileData;
 }
 
 // -----------------------------------------------------------------------------
@@ -142,6 +143,18 @@ PipelineMessage PipelineMessage::CreateStandardOutputMessage(const QString human
   return em;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessage PipelineMessage::CreateProfileMessage(const QString className, const QString humanLabel, int pipelineIndex, const QJsonObject& profileData)
+{
+  PipelineMessage em(className, humanLabel, QString(), 0, MessageType::FilterProfile, -1);
+  em.setPipelineIndex(pipelineIndex);
+  em.setProfileData(profileData);
+  em.setText(em.generateProfileString());
+  return em;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -153,7 +166,8 @@ PipelineMessage::~PipelineMessage() = default;
 bool PipelineMessage::operator==(const PipelineMessage& rhs)
 {
   return (m_FilterClassName == rhs.m_FilterClassName && m_Prefix == rhs.m_Prefix && m_FilterHumanLabel == rhs.m_FilterHumanLabel && m_Text == rhs.m_Text && m_Code == rhs.m_Code &&
-          m_Type == rhs.m_Type && m_ProgressValue == rhs.m_ProgressValue && m_PipelineIndex == rhs.m_PipelineIndex);
+          m_Type == rhs.m_Type && m_ProgressValue == rhs.m_ProgressValue && m_PipelineIndex == rhs.m_PipelineIndex &&
+          m_ProfileData == rhs.m_ProfileData);
 }
 
 // -----------------------------------------------------------------------------
@@ -169,6 +183,7 @@ void PipelineMessage::operator=(const PipelineMessage& rhs)
   m_Type = rhs.m_Type;
   m_ProgressValue = rhs.m_ProgressValue;
   m_PipelineIndex = rhs.m_PipelineIndex;
+  m_ProfileData = rhs.m_ProfileData;
 }
 
 // -----------------------------------------------------------------------------
@@ -226,3 +241,17 @@ QString PipelineMessage::generateStandardOutputString() const
 {
   return m_Text;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineMessage::generateProfileString() const
+{
+  const double k_MiB = 1024.0 * 1024.0;
+  QString ss = QObject::tr("%1 s wall, %2 s CPU, %3 MiB allocated, %4 MiB peak memory")
+                   .arg(m_ProfileData["WallTime"].toDouble() / 1.0E6, 0, 'f', 3)
+                   .arg(m_ProfileData["CPUTime"].toDouble() / 1.0E6, 0, 'f', 3)
+                   .arg(m_ProfileData["AllocatedBytes"].toDouble() / k_MiB, 0, 'f', 1)
+                   .arg(m_ProfileData["PeakMemory"].toDouble() / k_MiB, 0, 'f', 1);
+  return ss;
+}
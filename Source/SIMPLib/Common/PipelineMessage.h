@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <QtCore/QJsonObject>
 #include <QtCore/QString>
 #include <QtCore/QMetaType>
 
@@ -60,7 +61,8 @@ class SIMPLib_EXPORT PipelineMessage
       StandardOutputMessage = 3,
       ProgressValue = 4,
       StatusMessageAndProgressValue = 5,
-      UnknownMessageType = 6
+      UnknownMessageType = 6,
+      FilterProfile = 7
     };
 
     PipelineMessage();
@@ -82,6 +84,12 @@ class SIMPLib_EXPORT PipelineMessage
 
     static PipelineMessage CreateStandardOutputMessage(const QString humanLabel, int pipelineIndex, const QString msg);
 
+    /**
+     * @brief CreateProfileMessage Creates the message a FilterPipeline sends after a filter finished
+     * executing. The measurements are in ProfileData, see PipelineProfile::FilterRecord::toJson().
+     */
+    static PipelineMessage CreateProfileMessage(const QString className, const QString humanLabel, int pipelineIndex, const QJsonObject& profileData);
+
 
     SIMPL_TYPE_MACRO(PipelineMessage)
 
@@ -107,6 +115,8 @@ class SIMPLib_EXPORT PipelineMessage
 
     SIMPL_INSTANCE_PROPERTY(int, ProgressValue)
 
+    SIMPL_INSTANCE_PROPERTY(QJsonObject, ProfileData)
+
     /**
      * @brief This method creates and returns a string for error messages
      */
@@ -133,6 +143,11 @@ class SIMPLib_EXPORT PipelineMessage
      */
     QString generateProgressString() const;
 
+    /**
+     * @brief This method creates and returns a one line summary of a filter profile message
+     */
+    QString generateProfileString() const;
+
 
   private:
 
@@ -54,6 +54,7 @@
 #include "util/ATanOperator.h"
 #include "util/AdditionOperator.h"
 #include "util/CalculatorArray.hpp"
+#include "util/CalculatorKernel.h"
 #include "util/CeilOperator.h"
 #include "util/CommaSeparator.h"
 #include "util/CosOperator.h"
@@ -278,7 +279,7 @@ void ArrayCalculator::dataCheck()
       ICalculatorArray::Pointer array1 = std::dynamic_pointer_cast<ICalculatorArray>(item1);
       if (item1->isArray())
       {
-        if(!cDims.isEmpty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getArray()->getComponentDimensions())
+        if(!cDims.isEmpty() && resultType == ICalculatorArray::ValueType::Array && cDims != array1->getComponentDimensions())
         {
           QString ss = QObject::tr("Attribute Array symbols in the infix expression have mismatching component dimensions");
           setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INCONSISTENT_COMP_DIMS));
@@ -287,12 +288,12 @@ void ArrayCalculator::dataCheck()
         }
 
         resultType = ICalculatorArray::ValueType::Array;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
       else if (resultType == ICalculatorArray::ValueType::Unknown)
       {
         resultType = ICalculatorArray::ValueType::Number;
-        cDims = array1->getArray()->getComponentDimensions();
+        cDims = array1->getComponentDimensions();
       }
     }
   }
@@ -425,6 +426,57 @@ void ArrayCalculator::execute()
   // Convert the parsed infix expression into RPN
   QVector<CalculatorItem::Pointer> rpn = toRPN(parsedInfix);
 
+  // Evaluate the whole expression in one fused pass when every operator in it is known to the kernel,
+  // otherwise fall back to evaluating the RPN one operator at a time
+  IDataArray::Pointer resultArray = IDataArray::NullPointer();
+  CalculatorKernel::Pointer kernel = CalculatorKernel::New();
+  if(kernel->compile(rpn, getUnits() == ArrayCalculator::Degrees))
+  {
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Computing Expression");
+    resultArray = kernel->execute(m_CalculatedArray.getDataArrayName(), this);
+    if(getCancel())
+    {
+      return;
+    }
+  }
+  else
+  {
+    resultArray = executeRPN(rpn);
+    if(getErrorCondition() < 0 || getCancel())
+    {
+      return;
+    }
+  }
+
+  if(resultArray != IDataArray::NullPointer())
+  {
+    IDataArray::Pointer resultTypeArray = IDataArray::NullPointer();
+    resultTypeArray = convertArrayType(resultArray, m_ScalarType);
+
+    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
+    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
+    if(nullptr != createdAM)
+    {
+      resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
+      createdAM->addAttributeArray(resultTypeArray->getName(), resultTypeArray);
+    }
+  }
+  else
+  {
+    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
+                             "Please contact the DREAM.3D developers for more information");
+    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT));
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ArrayCalculator::executeRPN(const QVector<CalculatorItem::Pointer>& rpn)
+{
   // Execute the RPN expression
   int totalItems = rpn.size();
   for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
@@ -446,55 +498,31 @@ void ArrayCalculator::execute()
       rpnOperator->calculate(this, m_CalculatedArray, m_ExecutionStack);
       if(getErrorCondition() < 0)
       {
-        return;
+        return IDataArray::NullPointer();
       }
     }
 
     if(getCancel())
     {
-      return;
+      return IDataArray::NullPointer();
     }
   }
 
   // Grab the result from the stack
-  ICalculatorArray::Pointer arrayItem = ICalculatorArray::NullPointer();
   if(m_ExecutionStack.size() != 1)
   {
     QString ss = QObject::tr("The chosen infix equation is not a valid equation.");
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::INVALID_EQUATION));
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  if(!m_ExecutionStack.isEmpty())
-  {
-    arrayItem = m_ExecutionStack.pop();
+    return IDataArray::NullPointer();
   }
 
-  if(arrayItem != ICalculatorArray::NullPointer())
-  {
-    IDataArray::Pointer resultArray = IDataArray::NullPointer();
-    resultArray = arrayItem->getArray();
-
-    IDataArray::Pointer resultTypeArray = IDataArray::NullPointer();
-    resultTypeArray = convertArrayType(resultArray, m_ScalarType);
-
-    DataArrayPath createdAMPath(m_CalculatedArray.getDataContainerName(), m_CalculatedArray.getAttributeMatrixName(), "");
-    AttributeMatrix::Pointer createdAM = getDataContainerArray()->getAttributeMatrix(createdAMPath);
-    if(nullptr != createdAM)
-    {
-      resultTypeArray->setName(m_CalculatedArray.getDataArrayName());
-      createdAM->addAttributeArray(resultTypeArray->getName(), resultTypeArray);
-    }
-  }
-  else
+  ICalculatorArray::Pointer arrayItem = m_ExecutionStack.pop();
+  if(arrayItem == ICalculatorArray::NullPointer())
   {
-    QString ss = QObject::tr("Unexpected output item from chosen infix expression; the output item must be an array\n"
-                             "Please contact the DREAM.3D developers for more information");
-    setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::UNEXPECTED_OUTPUT));
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    return IDataArray::NullPointer();
   }
-
+  return arrayItem->getArray();
 }
 
 // -----------------------------------------------------------------------------
@@ -512,8 +540,8 @@ template<typename T> IDataArray::Pointer convertArray(const DoubleArrayType::Poi
   typename DataArray<T>::Pointer convertedArrayPtr = DataArray<T>::CreateArray(inputArray->getNumberOfTuples(), inputArray->getComponentDimensions(), inputArray->getName());
   T* rawOutputArray = convertedArrayPtr->getPointer(0);
 
-  int count = inputArray->getSize();
-  for(int i = 0; i < count; i++)
+  size_t count = inputArray->getSize();
+  for(size_t i = 0; i < count; i++)
   {
     double val = rawInputarray[i];
     rawOutputArray[i] = val;
@@ -565,7 +593,8 @@ IDataArray::Pointer ArrayCalculator::convertArrayType(const IDataArray::Pointer&
     castArray = convertArray<float>(inputDblArray);
     break;
   case SIMPL::ScalarTypes::Type::Double:
-    castArray = convertArray<double>(inputDblArray);
+    // The result is already a new double array, so it can be used as is
+    castArray = inputDblArray;
     break;
   case SIMPL::ScalarTypes::Type::Bool:
     castArray = convertArray<bool>(inputDblArray);
@@ -863,7 +892,7 @@ bool ArrayCalculator::parseIndexOperator(QString token, QVector<CalculatorItem::
   }
 
   ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(parsedInfix.back());
-  if(nullptr != calcArray && index >= calcArray->getArray()->getNumberOfComponents())
+  if(nullptr != calcArray && index >= calcArray->getNumberOfComponents())
   {
     QString ss = QObject::tr("'%1' has an component index that is out of range").arg(calcArray->getArray()->getName());
     setErrorCondition(static_cast<int>(CalculatorItem::ErrorCode::COMPONENT_OUT_OF_RANGE));
@@ -218,6 +218,13 @@ class SIMPLib_EXPORT ArrayCalculator : public AbstractFilter
     QVector<CalculatorItem::Pointer> parseInfixEquation();
     QVector<CalculatorItem::Pointer> toRPN(QVector<CalculatorItem::Pointer> infixEquation);
 
+    /**
+     * @brief executeRPN Evaluates the RPN expression one operator at a time through the execution stack
+     * @param rpn
+     * @return The resulting array, or a null pointer on error
+     */
+    IDataArray::Pointer executeRPN(const QVector<CalculatorItem::Pointer>& rpn);
+
     void checkForAmbiguousArrayName(QString itemStr, QString warningMsg);
 
     /**
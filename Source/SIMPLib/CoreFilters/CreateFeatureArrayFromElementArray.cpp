@@ -35,10 +35,25 @@
 
 #include "CreateFeatureArrayFromElementArray.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -52,6 +67,7 @@ CreateFeatureArrayFromElementArray::CreateFeatureArrayFromElementArray()
 , m_SelectedCellArrayPath("", "", "")
 , m_CreatedArrayName("")
 , m_FeatureIdsArrayPath("", "", "")
+, m_AggregationMode(Last)
 {
 }
 
@@ -76,6 +92,10 @@ void CreateFeatureArrayFromElementArray::setupFilterParameters()
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Int32, 1, AttributeMatrix::Category::Element);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Feature Ids", FeatureIdsArrayPath, FilterParameter::RequiredArray, CreateFeatureArrayFromElementArray, req));
   }
+  {
+    QVector<QString> choices = {"Last Value", "First Value", "Minimum", "Maximum", "Mean", "Mode"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Feature Value", AggregationMode, FilterParameter::Parameter, CreateFeatureArrayFromElementArray, choices, false));
+  }
   parameters.push_back(SeparatorFilterParameter::New("Feature Data", FilterParameter::CreatedArray));
   {
     AttributeMatrixSelectionFilterParameter::RequirementType req = AttributeMatrixSelectionFilterParameter::CreateRequirement(AttributeMatrix::Type::CellFeature, IGeometry::Type::Any);
@@ -95,6 +115,7 @@ void CreateFeatureArrayFromElementArray::readFilterParameters(AbstractFilterPara
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath()));
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setCreatedArrayName(reader->readString("CreatedArrayName", getCreatedArrayName()));
+  setAggregationMode(reader->readValue("AggregationMode", getAggregationMode()));
   reader->closeFilterGroup();
 }
 
@@ -120,6 +141,13 @@ void CreateFeatureArrayFromElementArray::dataCheck()
     return;
   }
 
+  if(getAggregationMode() < Last || getAggregationMode() > Mode)
+  {
+    setErrorCondition(-11003);
+    notifyErrorMessage(getHumanLabel(), QObject::tr("The Feature value selection %1 is not valid").arg(getAggregationMode()), getErrorCondition());
+    return;
+  }
+
   QVector<size_t> cDims(1, 1);
   m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeatureIdsArrayPath(),
                                                                                                         cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
@@ -154,13 +182,308 @@ void CreateFeatureArrayFromElementArray::preflight()
   setInPreflight(false);
 }
 
+namespace
+{
+/**
+ * @brief LowerFeatureId Lowers value to featureId if featureId is smaller. Used to report the same
+ * inconsistent Feature no matter how the work was split between threads.
+ */
+void LowerFeatureId(std::atomic<int32_t>& value, int32_t featureId)
+{
+  int32_t current = value.load();
+  while(featureId < current && !value.compare_exchange_weak(current, featureId))
+  {
+  }
+}
+
+/**
+ * @brief ConvertMean Converts the mean of a set of values back to the type of the values. Integer
+ * types are rounded to the nearest value and booleans are true if at least half of the values are.
+ */
+template <typename T> T ConvertMean(double mean)
+{
+  if(std::is_same<T, bool>::value)
+  {
+    return static_cast<T>(mean >= 0.5);
+  }
+  if(std::is_integral<T>::value)
+  {
+    return static_cast<T>(std::round(mean));
+  }
+  return static_cast<T>(mean);
+}
+
+/**
+ * @brief The CopyRepresentativeTuplesImpl class copies the tuple of one representative element (the
+ * first or the last one) into each Feature of a range of Features.
+ */
+template <typename T> class CopyRepresentativeTuplesImpl
+{
+public:
+  CopyRepresentativeTuplesImpl(const T* cellData, T* featureData, const std::vector<int64_t>& representatives, size_t numComp)
+  : m_CellData(cellData)
+  , m_FeatureData(featureData)
+  , m_Representatives(representatives)
+  , m_NumComp(numComp)
+  {
+  }
+  virtual ~CopyRepresentativeTuplesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t f = start; f < end; f++)
+    {
+      int64_t element = m_Representatives[f];
+      if(element >= 0)
+      {
+        std::copy(m_CellData + element * m_NumComp, m_CellData + (element + 1) * m_NumComp, m_FeatureData + f * m_NumComp);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_CellData;
+  T* m_FeatureData;
+  const std::vector<int64_t>& m_Representatives;
+  size_t m_NumComp;
+};
+
+/**
+ * @brief The CheckRepresentativeTuplesImpl class compares each element of a range of elements with the
+ * representative element of its Feature and records the lowest Feature whose elements differ.
+ */
+template <typename T> class CheckRepresentativeTuplesImpl
+{
+public:
+  CheckRepresentativeTuplesImpl(const T* cellData, const int32_t* featureIds, const std::vector<int64_t>& representatives, size_t numComp, std::atomic<int32_t>& inconsistentFeature)
+  : m_CellData(cellData)
+  , m_FeatureIds(featureIds)
+  , m_Representatives(representatives)
+  , m_NumComp(numComp)
+  , m_InconsistentFeature(inconsistentFeature)
+  {
+  }
+  virtual ~CheckRepresentativeTuplesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const int32_t numFeatures = static_cast<int32_t>(m_Representatives.size());
+    for(size_t i = start; i < end; i++)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      if(featureId < 0 || featureId >= numFeatures || featureId >= m_InconsistentFeature.load(std::memory_order_relaxed))
+      {
+        continue;
+      }
+      const T* representative = m_CellData + m_Representatives[featureId] * m_NumComp;
+      if(!std::equal(representative, representative + m_NumComp, m_CellData + i * m_NumComp))
+      {
+        LowerFeatureId(m_InconsistentFeature, featureId);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_CellData;
+  const int32_t* m_FeatureIds;
+  const std::vector<int64_t>& m_Representatives;
+  size_t m_NumComp;
+  std::atomic<int32_t>& m_InconsistentFeature;
+};
+
+/**
+ * @brief The ReduceFeatureSegmentsImpl class reduces the values of the elements of each Feature in a
+ * range of Features to a single tuple. The elements have been sorted by Feature beforehand, so the
+ * elements of Feature f are elements[offsets[f]] ... elements[offsets[f + 1] - 1].
+ */
+template <typename T, typename IndexType> class ReduceFeatureSegmentsImpl
+{
+public:
+  ReduceFeatureSegmentsImpl(const T* cellData, T* featureData, const std::vector<IndexType>& elements, const std::vector<IndexType>& offsets, size_t numComp,
+                            CreateFeatureArrayFromElementArray::AggregationMode mode, std::atomic<int32_t>& inconsistentFeature)
+  : m_CellData(cellData)
+  , m_FeatureData(featureData)
+  , m_Elements(elements)
+  , m_Offsets(offsets)
+  , m_NumComp(numComp)
+  , m_Mode(mode)
+  , m_InconsistentFeature(inconsistentFeature)
+  {
+  }
+  virtual ~ReduceFeatureSegmentsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    // std::vector<bool> can not be sorted reliably, so booleans are sorted as bytes
+    using SortType = typename std::conditional<std::is_same<T, bool>::value, uint8_t, T>::type;
+    std::vector<SortType> values;
+
+    for(size_t f = start; f < end; f++)
+    {
+      const IndexType first = m_Offsets[f];
+      const IndexType last = m_Offsets[f + 1];
+      if(first == last)
+      {
+        continue;
+      }
+      bool consistent = true;
+      for(size_t c = 0; c < m_NumComp; c++)
+      {
+        const T firstValue = m_CellData[m_Elements[first] * m_NumComp + c];
+        T result = firstValue;
+        double sum = 0.0;
+        if(m_Mode == CreateFeatureArrayFromElementArray::Mode)
+        {
+          values.clear();
+        }
+        for(IndexType e = first; e < last; e++)
+        {
+          const T value = m_CellData[m_Elements[e] * m_NumComp + c];
+          consistent = consistent && (value == firstValue);
+          switch(m_Mode)
+          {
+          case CreateFeatureArrayFromElementArray::Minimum:
+            result = std::min(result, value);
+            break;
+          case CreateFeatureArrayFromElementArray::Maximum:
+            result = std::max(result, value);
+            break;
+          case CreateFeatureArrayFromElementArray::Mean:
+            sum += static_cast<double>(value);
+            break;
+          case CreateFeatureArrayFromElementArray::Mode:
+            values.push_back(static_cast<SortType>(value));
+            break;
+          default:
+            break;
+          }
+        }
+
+        if(m_Mode == CreateFeatureArrayFromElementArray::Mean)
+        {
+          result = ConvertMean<T>(sum / static_cast<double>(last - first));
+        }
+        else if(m_Mode == CreateFeatureArrayFromElementArray::Mode)
+        {
+          // The most frequent value; ties go to the smallest value
+          std::sort(values.begin(), values.end());
+          size_t bestCount = 0;
+          for(size_t runStart = 0; runStart < values.size();)
+          {
+            size_t runEnd = runStart + 1;
+            while(runEnd < values.size() && values[runEnd] == values[runStart])
+            {
+              runEnd++;
+            }
+            if(runEnd - runStart > bestCount)
+            {
+              bestCount = runEnd - runStart;
+              result = static_cast<T>(values[runStart]);
+            }
+            runStart = runEnd;
+          }
+        }
+        m_FeatureData[f * m_NumComp + c] = result;
+      }
+      if(!consistent)
+      {
+        LowerFeatureId(m_InconsistentFeature, static_cast<int32_t>(f));
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_CellData;
+  T* m_FeatureData;
+  const std::vector<IndexType>& m_Elements;
+  const std::vector<IndexType>& m_Offsets;
+  size_t m_NumComp;
+  CreateFeatureArrayFromElementArray::AggregationMode m_Mode;
+  std::atomic<int32_t>& m_InconsistentFeature;
+};
+
+/**
+ * @brief ReduceFeatureSegments Sorts the elements by Feature with a counting sort and reduces the
+ * values of each Feature in parallel. IndexType is the smallest type that can address every element.
+ * @return The lowest Feature whose elements do not all have the same value, or numFeatures
+ */
+template <typename T, typename IndexType>
+int32_t ReduceFeatureSegments(const T* cellData, size_t numCells, const int32_t* featureIds, T* featureData, size_t numFeatures, size_t numComp, CreateFeatureArrayFromElementArray::AggregationMode mode)
+{
+  std::vector<IndexType> offsets(numFeatures + 1, 0);
+  for(size_t i = 0; i < numCells; i++)
+  {
+    int32_t featureId = featureIds[i];
+    if(featureId >= 0 && static_cast<size_t>(featureId) < numFeatures)
+    {
+      offsets[featureId + 1]++;
+    }
+  }
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    offsets[f + 1] += offsets[f];
+  }
+
+  std::vector<IndexType> elements(offsets[numFeatures]);
+  {
+    std::vector<IndexType> next(offsets.begin(), offsets.end() - 1);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      int32_t featureId = featureIds[i];
+      if(featureId >= 0 && static_cast<size_t>(featureId) < numFeatures)
+      {
+        elements[next[featureId]++] = static_cast<IndexType>(i);
+      }
+    }
+  }
+
+  std::atomic<int32_t> inconsistentFeature(static_cast<int32_t>(numFeatures));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures), ReduceFeatureSegmentsImpl<T, IndexType>(cellData, featureData, elements, offsets, numComp, mode, inconsistentFeature),
+                      tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ReduceFeatureSegmentsImpl<T, IndexType> serial(cellData, featureData, elements, offsets, numComp, mode, inconsistentFeature);
+    serial.compute(0, numFeatures);
+  }
+  return inconsistentFeature.load();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName)
+template <typename T>
+IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inputData, int32_t features, int32_t* featureIds, const QString& createdArrayName,
+                                 CreateFeatureArrayFromElementArray::AggregationMode mode)
 {
-  QString featureArrayName = inputData->getName();
-
   typename DataArray<T>::Pointer cell = std::dynamic_pointer_cast<DataArray<T>>(inputData);
   if(nullptr == cell)
   {
@@ -169,51 +492,65 @@ template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, I
 
   QVector<size_t> dims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName);
+  feature->initializeWithZeros();
 
   T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
-  int32_t numComp = cell->getNumberOfComponents();
-  int32_t featureIdx = 0;
+  const T* cPtr = cell->getConstPointer(0);
 
+  size_t numComp = static_cast<size_t>(cell->getNumberOfComponents());
   size_t cells = inputData->getNumberOfTuples();
+  size_t numFeatures = static_cast<size_t>(features);
+  int32_t inconsistentFeature = features;
 
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
 
-  for(size_t i = 0; i < cells; ++i)
+  if(mode == CreateFeatureArrayFromElementArray::First || mode == CreateFeatureArrayFromElementArray::Last)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
-
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
-    {
-      featureMap.insert(featureIdx, cSourcePtr);
-    }
-
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
+    // Find the element that supplies the value of each Feature, then copy the tuples and check the
+    // other elements against them in parallel
+    std::vector<int64_t> representatives(numFeatures, -1);
+    for(size_t i = 0; i < cells; ++i)
     {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
+      int32_t featureIdx = featureIds[i];
+      if(featureIdx >= 0 && featureIdx < features && (mode == CreateFeatureArrayFromElementArray::Last || representatives[featureIdx] < 0))
       {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        filter->setWarningCondition(-1000);
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
-        warningThrown = true;
+        representatives[featureIdx] = static_cast<int64_t>(i);
       }
     }
 
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
+    std::atomic<int32_t> inconsistent(features);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numFeatures), CopyRepresentativeTuplesImpl<T>(cPtr, fPtr, representatives, numComp), tbb::auto_partitioner());
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, cells), CheckRepresentativeTuplesImpl<T>(cPtr, featureIds, representatives, numComp, inconsistent), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      CopyRepresentativeTuplesImpl<T>(cPtr, fPtr, representatives, numComp).compute(0, numFeatures);
+      CheckRepresentativeTuplesImpl<T>(cPtr, featureIds, representatives, numComp, inconsistent).compute(0, cells);
+    }
+    inconsistentFeature = inconsistent.load();
+  }
+  else if(cells <= static_cast<size_t>(std::numeric_limits<uint32_t>::max()))
+  {
+    inconsistentFeature = ReduceFeatureSegments<T, uint32_t>(cPtr, cells, featureIds, fPtr, numFeatures, numComp, mode);
+  }
+  else
+  {
+    inconsistentFeature = ReduceFeatureSegments<T, size_t>(cPtr, cells, featureIds, fPtr, numFeatures, numComp, mode);
+  }
 
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
+  if(inconsistentFeature < features)
+  {
+    static const QStringList k_UsedValue = {"last value copied", "first value copied", "minimum value", "maximum value", "mean value", "most frequent value"};
+    filter->setWarningCondition(-1000);
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The %2 will be used").arg(inconsistentFeature).arg(k_UsedValue.value(static_cast<int>(mode)));
+    filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
   }
   return feature;
 }
@@ -269,50 +606,51 @@ void CreateFeatureArrayFromElementArray::execute()
   }
 
   IDataArray::Pointer p = IDataArray::NullPointer();
+  AggregationMode mode = static_cast<AggregationMode>(getAggregationMode());
 
   if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint8_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint16_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint32_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<int64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<uint64_t>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<float>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<float>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<double>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<double>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else if(TemplateHelpers::CanDynamicCast<BoolArrayType>()(m_InArrayPtr.lock()))
   {
-    p = copyCellData<bool>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName());
+    p = copyCellData<bool>(this, m_InArrayPtr.lock(), totalFeatures, m_FeatureIds, getCreatedArrayName(), mode);
   }
   else
   {
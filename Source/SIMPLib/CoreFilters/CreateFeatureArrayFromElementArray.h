@@ -51,8 +51,23 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
     PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
     PYB11_PROPERTY(QString CreatedArrayName READ getCreatedArrayName WRITE setCreatedArrayName)
     PYB11_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+    PYB11_PROPERTY(int AggregationMode READ getAggregationMode WRITE setAggregationMode)
 
   public:
+    /**
+     * @brief The AggregationMode enum selects how the values of the elements of a Feature are
+     * combined into the value of the Feature.
+     */
+    enum AggregationMode : int
+    {
+      Last = 0,
+      First = 1,
+      Minimum = 2,
+      Maximum = 3,
+      Mean = 4,
+      Mode = 5
+    };
+
     SIMPL_SHARED_POINTERS(CreateFeatureArrayFromElementArray)
     SIMPL_FILTER_NEW_MACRO(CreateFeatureArrayFromElementArray)
     SIMPL_TYPE_MACRO_SUPER_OVERRIDE(CreateFeatureArrayFromElementArray, AbstractFilter)
@@ -71,6 +86,9 @@ class SIMPLib_EXPORT CreateFeatureArrayFromElementArray : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, FeatureIdsArrayPath)
     Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
 
+    SIMPL_FILTER_PARAMETER(int, AggregationMode)
+    Q_PROPERTY(int AggregationMode READ getAggregationMode WRITE setAggregationMode)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
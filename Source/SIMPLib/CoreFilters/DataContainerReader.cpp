@@ -43,10 +43,12 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerBundle.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
@@ -58,10 +60,12 @@
 DataContainerReader::DataContainerReader()
 : m_InputFile("")
 , m_OverwriteExistingDataContainers(false)
+, m_LazyLoad(false)
 , m_LastFileRead("")
 , m_LastRead(QDateTime::currentDateTime())
 {
   m_PipelineFromFile = FilterPipeline::New();
+  m_LazyLoadStatistics = LazyLoadStatistics::New();
 }
 
 // -----------------------------------------------------------------------------
@@ -77,6 +81,7 @@ void DataContainerReader::setupFilterParameters()
   FilterParameterVector parameters;
 
   parameters.push_back(SIMPL_NEW_BOOL_FP("Overwrite Existing Data Containers", OverwriteExistingDataContainers, FilterParameter::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Load Arrays On Demand", LazyLoad, FilterParameter::Parameter, DataContainerReader));
   {
     DataContainerReaderFilterParameter::Pointer parameter = DataContainerReaderFilterParameter::New();
     parameter->setHumanLabel("Select Arrays from Input File");
@@ -101,6 +106,7 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setLazyLoad(reader->readValue("LazyLoad", getLazyLoad()));
   reader->closeFilterGroup();
 }
 
@@ -180,7 +186,7 @@ void DataContainerReader::dataCheck()
     return;
   }
 
-  QList<DataContainer::Pointer>& tempContainers = tempDCA->getDataContainers();
+  const QList<DataContainer::Pointer>& tempContainers = tempDCA->getDataContainers();
 
   QListIterator<DataContainer::Pointer> iter(tempContainers);
   while(iter.hasNext())
@@ -241,6 +247,8 @@ void DataContainerReader::execute()
    * file and move those DataContainer objects into the existing DataContainerArray. Error messages
    * will be passed up the chain if something goes wrong.
    */
+  // Never read a file that an earlier writer is still flushing in the background
+  DataContainerWriter::WaitForBackgroundWrites();
   dataCheck();
 
 }
@@ -264,7 +272,10 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
-  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
+  // Numeric arrays are registered separately when loading on demand so their data is only read once touched
+  bool lazyLoad = getLazyLoad() && !getInPreflight();
+  QVector<DataArrayPath> lazyArrays;
+  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(lazyLoad ? splitLazyArrays(proxy, lazyArrays) : proxy, getInPreflight());
   if(dca == DataContainerArray::NullPointer())
   {
     return DataContainerArray::New();
@@ -280,6 +291,18 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   }
   H5ScopedFileSentinel sentinel(&fileId, true);
 
+  if(lazyLoad)
+  {
+    int32_t err = registerLazyArrays(fileId, dca, lazyArrays);
+    if(err < 0)
+    {
+      setErrorCondition(err);
+      QString ss = QObject::tr("Error preparing the arrays in '%1' for loading on demand").arg(getInputFile());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return DataContainerArray::New();
+    }
+  }
+
   if(!getInPreflight())
   {
     int32_t err = readExistingPipelineFromFile(fileId);
@@ -295,11 +318,104 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   return dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerReader::setRegionOfInterest(const QString& dcName, const QVector<size_t>& min, const QVector<size_t>& max, const QVector<size_t>& stride)
+{
+  if(!m_InputFileDataContainerArrayProxy.dataContainers.contains(dcName))
+  {
+    return false;
+  }
+  DataContainerProxy& dcProxy = m_InputFileDataContainerArrayProxy.dataContainers[dcName];
+  dcProxy.setRegionOfInterest(min, max, stride);
+  return dcProxy.hasRegionOfInterest();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArrayProxy DataContainerReader::splitLazyArrays(const DataContainerArrayProxy& proxy, QVector<DataArrayPath>& lazyArrays) const
+{
+  DataContainerArrayProxy eagerProxy = proxy;
+  for(DataContainerProxy& dcProxy : eagerProxy.dataContainers)
+  {
+    // A region of interest is read through a hyperslab, which the on demand loader does not support
+    if(dcProxy.flag == Qt::Unchecked || dcProxy.hasRegionOfInterest())
+    {
+      continue;
+    }
+    for(AttributeMatrixProxy& amProxy : dcProxy.attributeMatricies)
+    {
+      if(amProxy.flag == Qt::Unchecked)
+      {
+        continue;
+      }
+      for(DataArrayProxy& daProxy : amProxy.dataArrays)
+      {
+        // Neighbor lists, string and statistics arrays do not have a flat payload and are always read
+        if(daProxy.flag == SIMPL::Unchecked || !daProxy.objectType.startsWith("DataArray"))
+        {
+          continue;
+        }
+        lazyArrays.push_back(DataArrayPath(dcProxy.name, amProxy.name, daProxy.name));
+        daProxy.flag = SIMPL::Unchecked;
+      }
+    }
+  }
+  return eagerProxy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DataContainerReader::registerLazyArrays(hid_t fileId, const DataContainerArray::Pointer& dca, const QVector<DataArrayPath>& lazyArrays)
+{
+  // Arrays from an earlier execution keep reporting into their own statistics object
+  m_LazyLoadStatistics = LazyLoadStatistics::New();
+  // The loaders share one read-only handle that is closed once the last of them has run
+  H5DataArrayReader::LazyLoadFilePointer sourceFile = H5DataArrayReader::CreateLazyLoadFile(getInputFile());
+
+  for(const DataArrayPath& path : lazyArrays)
+  {
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(path);
+    if(nullptr == am)
+    {
+      continue;
+    }
+    QString groupPath = QString("/%1/%2/%3").arg(SIMPL::StringConstants::DataContainerGroupName, path.getDataContainerName(), path.getAttributeMatrixName());
+    hid_t amGid = H5Gopen(fileId, groupPath.toLatin1().data(), H5P_DEFAULT);
+    if(amGid < 0)
+    {
+      return -151;
+    }
+    H5ScopedGroupSentinel groupSentinel(&amGid, false);
+
+    IDataArray::Pointer array = H5DataArrayReader::ReadIDataArray(amGid, path.getDataArrayName(), true);
+    if(nullptr == array)
+    {
+      return -152;
+    }
+    if(!array->setLazyLoader(H5DataArrayReader::CreateLazyLoader(sourceFile, groupPath, path.getDataArrayName()), m_LazyLoadStatistics, getInputFile()))
+    {
+      // Empty arrays have nothing to defer
+      array = H5DataArrayReader::ReadIDataArray(amGid, path.getDataArrayName(), false);
+      if(nullptr == array)
+      {
+        return -152;
+      }
+    }
+    am->addAttributeArray(array->getName(), array);
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 DataContainerArrayProxy DataContainerReader::readDataContainerArrayStructure(const QString& path)
 {
+  DataContainerWriter::WaitForBackgroundWrites();
   SIMPLH5DataReader::Pointer h5Reader = SIMPLH5DataReader::New();
   if(!h5Reader->openFile(path))
   {
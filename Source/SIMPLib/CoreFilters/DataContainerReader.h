@@ -39,6 +39,7 @@
 #include <QtCore/QDateTime>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/LazyLoadStatistics.h"
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -58,6 +59,7 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     PYB11_CREATE_BINDINGS(DataContainerReader SUPERCLASS AbstractFilter)
     PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
     PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
+    PYB11_PROPERTY(bool LazyLoad READ getLazyLoad WRITE setLazyLoad)
     PYB11_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
     PYB11_PROPERTY(QDateTime LastRead READ getLastRead WRITE setLastRead)
     PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
@@ -77,6 +79,9 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, OverwriteExistingDataContainers)
     Q_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
 
+    SIMPL_FILTER_PARAMETER(bool, LazyLoad)
+    Q_PROPERTY(bool LazyLoad READ getLazyLoad WRITE setLazyLoad)
+
     SIMPL_FILTER_PARAMETER(QString, LastFileRead)
     Q_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
 
@@ -91,6 +96,25 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
      */
     const QString getCompiledLibraryName() const override;
 
+    /**
+     * @brief getLazyLoadStatistics Returns the hit/miss counters of the arrays that the last
+     * execution registered for on-demand loading. The counters keep updating while those arrays
+     * are used by later filters.
+     */
+    SIMPL_GET_PROPERTY(LazyLoadStatistics::Pointer, LazyLoadStatistics)
+
+    /**
+     * @brief setRegionOfInterest Reads only the voxels from min to max (inclusive, X Y Z) of the cell
+     * data of an Image or RectGrid Data Container, keeping every stride'th voxel.
+     * @see DataContainerProxy::setRegionOfInterest
+     * @param dcName
+     * @param min
+     * @param max
+     * @param stride
+     * @return false if the input file proxy does not contain the Data Container
+     */
+    bool setRegionOfInterest(const QString& dcName, const QVector<size_t>& min, const QVector<size_t>& max, const QVector<size_t>& stride = QVector<size_t>(3, 1));
+
     /**
      * @brief getBrandingString Returns the branding string for the filter, which is a tag
      * used to denote the filter's association with specific plugins
@@ -241,6 +265,25 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
      */
     DataContainerArray::Pointer readData(DataContainerArrayProxy& proxy);
 
+    /**
+     * @brief splitLazyArrays Returns a copy of the proxy where every selected DataArray<T> is
+     * unchecked. The paths of those arrays are appended to lazyArrays.
+     * @param proxy
+     * @param lazyArrays
+     * @return
+     */
+    DataContainerArrayProxy splitLazyArrays(const DataContainerArrayProxy& proxy, QVector<DataArrayPath>& lazyArrays) const;
+
+    /**
+     * @brief registerLazyArrays Adds the arrays in lazyArrays to the DataContainerArray with their
+     * dimensions read from the file and their data deferred until first access.
+     * @param fileId
+     * @param dca
+     * @param lazyArrays
+     * @return Integer error value
+     */
+    int32_t registerLazyArrays(hid_t fileId, const DataContainerArray::Pointer& dca, const QVector<DataArrayPath>& lazyArrays);
+
   protected slots:
     /**
     * @brief Cleans up the filter after execution
@@ -249,6 +292,7 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
 
   private:
     FilterPipeline::Pointer                     m_PipelineFromFile;
+    LazyLoadStatistics::Pointer                 m_LazyLoadStatistics;
 
   public:
     DataContainerReader(const DataContainerReader&) = delete; // Copy Constructor Not Implemented
@@ -35,17 +35,24 @@
 
 #include "DataContainerWriter.h"
 
+#include <condition_variable>
+#include <mutex>
+
 #include <QtCore/QDir>
 
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Utilities.h"
+#include "H5Support/H5DatasetCompression.h"
 #include "H5Support/H5ScopedSentinel.h"
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
@@ -57,6 +64,28 @@ extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
 #define APPEND_DATA_TRUE 1
 #define APPEND_DATA_FALSE 0
 
+namespace
+{
+// Counts the background writes that are still running across every DataContainerWriter instance
+std::mutex s_BackgroundWriteMutex;
+std::condition_variable s_BackgroundWriteFinished;
+int s_BackgroundWriteCount = 0;
+
+/**
+ * @brief Returns true if the HDF5 library was built with its thread safety option, which is
+ * required before HDF5 may be called from more than one thread.
+ */
+bool IsHDF5ThreadSafe()
+{
+  hbool_t threadSafe = 0;
+  if(H5is_library_threadsafe(&threadSafe) < 0)
+  {
+    return false;
+  }
+  return threadSafe > 0;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -66,6 +95,9 @@ DataContainerWriter::DataContainerWriter()
 , m_WriteXdmfFile(true)
 , m_WriteTimeSeries(false)
 , m_AppendToExisting(false)
+, m_CompressionLevel(0)
+, m_ChunkPolicy(static_cast<int>(H5DatasetCompression::ChunkPolicy::Contiguous))
+, m_WriteInBackground(false)
 , m_FileId(-1)
 {
 }
@@ -75,6 +107,10 @@ DataContainerWriter::DataContainerWriter()
 // -----------------------------------------------------------------------------
 DataContainerWriter::~DataContainerWriter()
 {
+  if(m_BackgroundWrite.valid())
+  {
+    m_BackgroundWrite.wait();
+  }
   closeFile();
 }
 
@@ -88,6 +124,15 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Compression Level (0-9)", CompressionLevel, FilterParameter::Parameter, DataContainerWriter));
+  {
+    QVector<QString> choices;
+    choices.push_back("Contiguous");
+    choices.push_back("Automatic");
+    choices.push_back("Slice");
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Chunking", ChunkPolicy, FilterParameter::Parameter, DataContainerWriter, choices, false));
+  }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write In Background", WriteInBackground, FilterParameter::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -100,6 +145,9 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setCompressionLevel(reader->readValue("CompressionLevel", getCompressionLevel()));
+  setChunkPolicy(reader->readValue("ChunkPolicy", getChunkPolicy()));
+  setWriteInBackground(reader->readValue("WriteInBackground", getWriteInBackground()));
   reader->closeFilterGroup();
 }
 
@@ -127,6 +175,19 @@ void DataContainerWriter::dataCheck()
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
 
+  if(getCompressionLevel() < 0 || getCompressionLevel() > 9)
+  {
+    ss = QObject::tr("The compression level must be between 0 and 9. The current value is %1").arg(getCompressionLevel());
+    setErrorCondition(-11114);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  if(getChunkPolicy() < static_cast<int>(H5DatasetCompression::ChunkPolicy::Contiguous) || getChunkPolicy() > static_cast<int>(H5DatasetCompression::ChunkPolicy::Slice))
+  {
+    ss = QObject::tr("The selected chunking policy (%1) is not valid").arg(getChunkPolicy());
+    setErrorCondition(-11115);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+
 }
 
 // -----------------------------------------------------------------------------
@@ -147,6 +208,10 @@ void DataContainerWriter::preflight()
 // -----------------------------------------------------------------------------
 void DataContainerWriter::execute()
 {
+  // A previous execution of this filter, or of any other writer, may still be flushing the file
+  waitForBackgroundWrite();
+  WaitForBackgroundWrites();
+
   setErrorCondition(0);
   setWarningCondition(0);
   dataCheck();
@@ -170,6 +235,13 @@ void DataContainerWriter::execute()
     return;
   }
 
+  // Arrays that were read lazily from the file we are about to overwrite must be loaded first
+  err = resolveLazyLoadsFromOutputFile();
+  if(err < 0)
+  {
+    return;
+  }
+
   err = openFile(m_AppendToExisting); // Do NOT append to any existing file
   if(err < 0)
   {
@@ -186,11 +258,93 @@ void DataContainerWriter::execute()
   // Write our File Version string to the Root "/" group
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
+
+  // Write the Pipeline to the File
+  err = writePipeline();
+
+  // Write the Data ContainerBundles. They only hold names so they are written up front
+  err = writeDataContainerBundles(m_FileId);
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error writing DataContainerBundles");
+    setErrorCondition(-11113);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  // Compressed datasets must be chunked so fall back to automatic chunking if the user asked for both
+  H5DatasetCompression compression;
+  compression.CompressionLevel = getCompressionLevel();
+  compression.Chunking = static_cast<H5DatasetCompression::ChunkPolicy>(getChunkPolicy());
+  if(compression.CompressionLevel > 0 && compression.Chunking == H5DatasetCompression::ChunkPolicy::Contiguous)
+  {
+    compression.Chunking = H5DatasetCompression::ChunkPolicy::Automatic;
+  }
+
+  if(m_WriteInBackground && !IsHDF5ThreadSafe())
+  {
+    QString ss = QObject::tr("The HDF5 library is not thread safe so the file is written before the pipeline continues");
+    setWarningCondition(-11116);
+    notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+  }
+  else if(m_WriteInBackground)
+  {
+    // The following filters are free to modify or delete anything in the data structure so
+    // the background thread writes from its own copy. The thread takes over the open file.
+    DataContainerArray::Pointer snapshot = getDataContainerArray()->deepCopy(false);
+    hid_t fileId = m_FileId;
+    m_FileId = -1;
+    {
+      std::lock_guard<std::mutex> lock(s_BackgroundWriteMutex);
+      s_BackgroundWriteCount++;
+    }
+    m_BackgroundWrite = std::async(std::launch::async, [this, fileId, snapshot, compression] {
+      hid_t backgroundFileId = fileId;
+      int backgroundErr = 0;
+      {
+        H5ScopedFileSentinel backgroundSentinel(&backgroundFileId, true);
+        backgroundErr = writeDataContainers(backgroundFileId, snapshot, compression, m_BackgroundErrorMessage);
+      }
+      {
+        std::lock_guard<std::mutex> lock(s_BackgroundWriteMutex);
+        s_BackgroundWriteCount--;
+      }
+      s_BackgroundWriteFinished.notify_all();
+      return backgroundErr;
+    });
+    return;
+  }
+
+  QString errorMessage;
+  err = writeDataContainers(m_FileId, getDataContainerArray(), compression, errorMessage);
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
+    return;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::writeDataContainers(hid_t fileId, const DataContainerArray::Pointer& dca, const H5DatasetCompression& compression, QString& errorMessage)
+{
+  int err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), fileId);
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
+    return -60;
+  }
+  hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+  H5GroupAutoCloser dcaCloser(&dcaGid);
+
   QFile xdmfFile;
   QTextStream xdmfOut(&xdmfFile);
   if(m_WriteXdmfFile)
   {
     QFileInfo ofFi(m_OutputFile);
+    QString parentPath = ofFi.path();
     QString name = ofFi.completeBaseName();
     if(parentPath.isEmpty())
     {
@@ -207,32 +361,16 @@ void DataContainerWriter::execute()
     }
   }
 
-  // Write the Pipeline to the File
-  err = writePipeline();
-
-  err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), m_FileId);
-  if(err < 0)
-  {
-    QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
-    setErrorCondition(-60);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
-  scopedFileSentinel.addGroupId(&dcaGid);
-
-  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
-  for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
+  QList<QString> dcNames = dca->getDataContainerNames();
+  for(int iter = 0; iter < dca->getNumDataContainers(); iter++)
   {
-    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
+    DataContainer::Pointer dc = dca->getDataContainer(dcNames[iter]);
     IGeometry::Pointer geometry = dc->getGeometry();
     err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
     if(err < 0)
     {
-      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
-      setErrorCondition(-60);
-      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      return;
+      errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
+      return -60;
     }
 
     hid_t dcGid = H5Gopen(dcaGid, dcNames[iter].toLatin1().data(), H5P_DEFAULT);
@@ -240,17 +378,17 @@ void DataContainerWriter::execute()
     // QString ss = QObject::tr("%1 |--> Writing %2 DataContainer ").arg(getMessagePrefix()).arg(dcNames[iter]);
 
     // Have the DataContainer write all of its Attribute Matrices and its Mesh
-    err = dc->writeAttributeMatricesToHDF5(dcGid);
+    err = dc->writeAttributeMatricesToHDF5(dcGid, compression);
     if(err < 0)
     {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
-      return;
+      errorMessage = "Error writing DataContainer AttributeMatrices";
+      return -803;
     }
     err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
     if(err < 0)
     {
-      notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
-      return;
+      errorMessage = "Error writing DataContainer Geometry";
+      return -804;
     }
     if(m_WriteXdmfFile && geometry.get() != nullptr)
     {
@@ -265,36 +403,77 @@ void DataContainerWriter::execute()
       dc->getGeometry()->setTemporalDataPath(DataArrayPath(dc->getName(), SIMPL::StringConstants::MetaData, "Step #"));
 #endif
 
-      QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
+      QString hdfFileName = QH5Utilities::fileNameFromFileId(fileId);
       err = dc->writeXdmf(xdmfOut, hdfFileName);
       if(err < 0)
       {
-        notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
-        return;
+        errorMessage = "Error writing Xdmf File";
+        return -805;
       }
     }
   }
 
-  // Write the Data ContainerBundles
-  err = writeDataContainerBundles(m_FileId);
-  if(err < 0)
-  {
-    QString ss = QObject::tr("Error writing DataContainerBundles");
-    setErrorCondition(-11113);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-
   // Write the XDMF File
   if(m_WriteXdmfFile)
   {
     writeXdmfFooter(xdmfOut);
   }
 
-  H5Gclose(dcaGid);
+  return 0;
+}
 
-  dcaGid = -1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWriter::waitForBackgroundWrite()
+{
+  if(!m_BackgroundWrite.valid())
+  {
+    return;
+  }
+  int err = m_BackgroundWrite.get();
+  if(err < 0)
+  {
+    setErrorCondition(err);
+    notifyErrorMessage(getHumanLabel(), m_BackgroundErrorMessage, getErrorCondition());
+  }
+  m_BackgroundErrorMessage.clear();
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWriter::WaitForBackgroundWrites()
+{
+  std::unique_lock<std::mutex> lock(s_BackgroundWriteMutex);
+  s_BackgroundWriteFinished.wait(lock, [] { return s_BackgroundWriteCount == 0; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWriter::cleanupFilter()
+{
+  if(!m_BackgroundWrite.valid())
+  {
+    return;
+  }
+  // The pipeline disconnected our notifications when execute() returned, so route any error
+  // from the background write back through the pipeline that is finishing.
+  FilterPipeline* pipeline = qobject_cast<FilterPipeline*>(sender());
+  if(nullptr != pipeline)
+  {
+    pipeline->connectFilterNotifications(this);
+  }
+  waitForBackgroundWrite();
+  if(nullptr != pipeline)
+  {
+    pipeline->disconnectFilterNotifications(this);
+    if(getErrorCondition() < 0 && pipeline->getErrorCondition() >= 0)
+    {
+      pipeline->setErrorCondition(getErrorCondition());
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -401,6 +580,54 @@ int DataContainerWriter::writePipeline()
   return writer->writePipelineToFile(pipeline, m_OutputFile, SIMPL::StringConstants::PipelineGroupName);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DataContainerWriter::resolveLazyLoadsFromOutputFile()
+{
+  QFileInfo outputInfo(m_OutputFile);
+  if(!outputInfo.exists())
+  {
+    return 0;
+  }
+  QString outputPath = outputInfo.canonicalFilePath();
+
+  DataContainerArray::Pointer dca = getDataContainerArray();
+  QList<QString> dcNames = dca->getDataContainerNames();
+  for(const QString& dcName : dcNames)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcName);
+    if(nullptr == dc.get())
+    {
+      continue;
+    }
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      QList<QString> arrayNames = am->getAttributeArrayNames();
+      for(const QString& arrayName : arrayNames)
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        if(nullptr == array.get() || !array->isLazyLoadPending())
+        {
+          continue;
+        }
+        QString source = array->getLazyLoadSource();
+        if(source.isEmpty() || QFileInfo(source).canonicalFilePath() != outputPath)
+        {
+          continue;
+        }
+        if(array->resolveLazyLoadNow() < 0)
+        {
+          setErrorCondition(-11117);
+          notifyErrorMessage(getHumanLabel(), array->takeLazyLoadError(), getErrorCondition());
+          return getErrorCondition();
+        }
+      }
+    }
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -36,6 +36,10 @@
 
 #pragma once
 
+#include <future>
+
+#include "H5Support/H5DatasetCompression.h"
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
@@ -52,6 +56,9 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
     PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
     PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+    PYB11_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+    PYB11_PROPERTY(int ChunkPolicy READ getChunkPolicy WRITE setChunkPolicy)
+    PYB11_PROPERTY(bool WriteInBackground READ getWriteInBackground WRITE setWriteInBackground)
 
   public:
     SIMPL_SHARED_POINTERS(DataContainerWriter)
@@ -73,6 +80,33 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
 
     SIMPL_INSTANCE_PROPERTY(bool, AppendToExisting)
 
+    /**
+     * @brief The gzip level (0-9) applied to Attribute Array datasets. 0 writes uncompressed data.
+     */
+    SIMPL_FILTER_PARAMETER(int, CompressionLevel)
+    Q_PROPERTY(int CompressionLevel READ getCompressionLevel WRITE setCompressionLevel)
+
+    /**
+     * @brief How Attribute Array datasets are chunked. See H5DatasetCompression::ChunkPolicy
+     */
+    SIMPL_FILTER_PARAMETER(int, ChunkPolicy)
+    Q_PROPERTY(int ChunkPolicy READ getChunkPolicy WRITE setChunkPolicy)
+
+    /**
+     * @brief Writes the Attribute Matrices and Geometries from a snapshot of the data structure
+     * on a separate thread so that the following filters can keep executing. The write is joined
+     * when the pipeline finishes. Requires a thread safe build of HDF5; otherwise the file is written
+     * in place as usual.
+     */
+    SIMPL_FILTER_PARAMETER(bool, WriteInBackground)
+    Q_PROPERTY(bool WriteInBackground READ getWriteInBackground WRITE setWriteInBackground)
+
+    /**
+     * @brief Blocks until every background write started by any DataContainerWriter has finished.
+     * Filters that read .dream3d files call this so they never see a partially written file.
+     */
+    static void WaitForBackgroundWrites();
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -161,6 +195,12 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
      */
     void preflightExecuted();
 
+  protected slots:
+    /**
+     * @brief Waits for a pending background write and reports any error it produced
+     */
+    void cleanupFilter() override;
+
   protected:
     DataContainerWriter();
     /**
@@ -174,6 +214,13 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     void initialize();
 
 
+    /**
+     * @brief resolveLazyLoadsFromOutputFile Reads every deferred array whose data still lives in the
+     * output file, which is about to be truncated or modified.
+     * @return Integer error value
+     */
+    int32_t resolveLazyLoadsFromOutputFile();
+
     /**
      * @brief openFile Opens or creates an HDF5 file to write data into
      * @param append Should a new file be created or append data to a currently existing file
@@ -200,6 +247,22 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
      */
     int writeDataContainerBundles(hid_t fileId);
 
+    /**
+     * @brief writeDataContainers Writes the Attribute Matrices, Geometries and Xdmf file of every
+     * DataContainer. This does not touch any filter state so it can run on the background thread.
+     * @param fileId The open HDF5 file
+     * @param dca The DataContainers to write
+     * @param compression The compression settings for the Attribute Arrays
+     * @param errorMessage Set to a description of the failure when an error is returned
+     * @return Integer error value
+     */
+    int writeDataContainers(hid_t fileId, const DataContainerArray::Pointer& dca, const H5DatasetCompression& compression, QString& errorMessage);
+
+    /**
+     * @brief waitForBackgroundWrite Joins the background write of this filter, if any, and reports its errors
+     */
+    void waitForBackgroundWrite();
+
     /**
      * @brief writeXdmfHeader Writes the Xdmf header
      * @param out QTextStream for output
@@ -214,6 +277,8 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
 
   private:
     hid_t m_FileId;
+    std::future<int> m_BackgroundWrite;
+    QString m_BackgroundErrorMessage;
 
   public:
     DataContainerWriter(const DataContainerWriter&) = delete; // Copy Constructor Not Implemented
@@ -215,105 +215,88 @@ void MultiThresholdObjects2::execute()
 
     bool invert = m_SelectedThresholds.shouldInvert();
 
-    int64_t thresholdSize;
-    BoolArrayType::Pointer thresholdArray;
-
-    createBoolArray(thresholdSize, thresholdArray);
+    ThresholdMask::Pointer thresholdMask = acquireThresholdMask();
     bool firstValueFound = false;
 
-    // Loop on the remaining Comparison objects updating our final result array as we go
+    // Loop on the remaining Comparison objects updating our final result mask as we go
     for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
     {
       if (std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
       {
         ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-        thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
+        thresholdSet(comparisonSet, thresholdMask, err, !firstValueFound, false);
         firstValueFound = true;
       }
       else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
       {
         ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-        thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
+        thresholdValue(comparisonValue, thresholdMask, err, !firstValueFound, false);
         firstValueFound = true;
       }
     }
 
     if (invert)
     {
-      invertThreshold(thresholdSize, thresholdArray);
+      thresholdMask->invert();
     }
 
-    bool* threshold = thresholdArray->getPointer(0);
-    for (int64_t p = 0; p < thresholdSize; p++)
-    {
-      m_Destination[p] = threshold[p];
-    }
+    thresholdMask->copyTo(m_Destination);
+
+    // Free the scratch masks until the next execute
+    m_MaskPool.clear();
 }
 
+namespace
+{
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
+ThresholdMask::Combine unionToCombine(int unionOperator)
 {
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
+  return (SIMPL::Union::Operator_Or == unionOperator) ? ThresholdMask::Combine::Or : ThresholdMask::Combine::And;
 }
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
+ThresholdMask::Pointer MultiThresholdObjects2::acquireThresholdMask()
 {
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
+  if(!m_MaskPool.empty())
   {
-    // invert the current comparison if necessary
-    if (inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if (SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
-    }
+    ThresholdMask::Pointer mask = m_MaskPool.back();
+    m_MaskPool.pop_back();
+    mask->initializeWithZeros();
+    return mask;
   }
+
+  // Get the names of the Data Container and AttributeMatrix for later
+  QString dcName = m_SelectedThresholds.getDataContainerName();
+  QString amName = m_SelectedThresholds.getAttributeMatrixName();
+
+  DataContainerArray::Pointer dca = getDataContainerArray();
+  DataContainer::Pointer m = dca->getDataContainer(dcName);
+
+  // Get the total number of tuples and create a mask, initialized to false, to use for these results
+  size_t totalTuples = m->getAttributeMatrix(amName)->getNumberOfTuples();
+  return ThresholdMask::New(totalTuples);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
+void MultiThresholdObjects2::releaseThresholdMask(ThresholdMask::Pointer mask)
 {
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
+  if(nullptr != mask)
   {
-    threshold[i] = !threshold[i];
+    m_MaskPool.push_back(mask);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
+void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, ThresholdMask::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
 {
   if (nullptr == comparisonSet)
   {
@@ -329,10 +312,18 @@ void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet,
     inverse = comparisonSet->getInvertComparison();
   }
 
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
+  // When the result replaces the input the set can be evaluated in place,
+  // otherwise it needs its own mask until it is merged
+  ThresholdMask::Pointer setThresholdMask;
+  if (replaceInput)
+  {
+    setThresholdMask = currentThreshold;
+    setThresholdMask->initializeWithZeros();
+  }
+  else
+  {
+    setThresholdMask = acquireThresholdMask();
+  }
   bool firstValueFound = false;
 
   QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
@@ -342,14 +333,14 @@ void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet,
     if (std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
     { 
       ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
+      thresholdSet(childSet, setThresholdMask, err, !firstValueFound, false);
       firstValueFound = true;
     }
     // Check Comparison Values
     if (std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
     {
       ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
+      thresholdValue(childValue, setThresholdMask, err, !firstValueFound, false);
       firstValueFound = true;
     }
 
@@ -363,21 +354,21 @@ void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet,
   {
     if (inverse)
     {
-      invertThreshold(setArraySize, setThresholdArray);
+      currentThreshold->invert();
     }
-    currentThreshold.swap(setThresholdArray);
   }
   else
   {
     // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
+    currentThreshold->combine(*setThresholdMask, unionToCombine(comparisonSet->getUnionOperator()), inverse);
+    releaseThresholdMask(setThresholdMask);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
+void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, ThresholdMask::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
 {
   if (nullptr == comparisonValue)
   {
@@ -391,20 +382,14 @@ void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonV
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
 
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  //bool* currentArray = currentArrayPtr->getPointer(0);
   int compOperator = comparisonValue->getCompOperator();
   double compValue = comparisonValue->getCompValue();
 
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
+  // The comparison is merged word by word straight into the input, or replaces it
+  ThresholdMask::Combine combine = replaceInput ? ThresholdMask::Combine::Replace : unionToCombine(comparisonValue->getUnionOperator());
+  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, inputThreshold.get(), combine, inverse);
 
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()).get(), currentArrayPtr.get());
+  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()).get(), nullptr);
   if (err < 0)
   {
     DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
@@ -413,20 +398,6 @@ void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonV
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
-  
-  if (replaceInput)
-  {
-    if (inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else 
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
-  }
 }
 
 // -----------------------------------------------------------------------------
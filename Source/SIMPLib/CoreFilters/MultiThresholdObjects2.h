@@ -36,11 +36,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
 #include "SIMPLib/Filtering/ComparisonSet.h"
 #include "SIMPLib/Filtering/ComparisonValue.h"
+#include "SIMPLib/Filtering/ThresholdMask.h"
 #include "SIMPLib/SIMPLib.h"
 
 /**
@@ -167,51 +170,43 @@ class  SIMPLib_EXPORT MultiThresholdObjects2 : public AbstractFilter
     void initialize();
 
     /**
-    * @brief Creates and returns a DataArray<bool> for the given AttributeMatrix and the number of tuples
-    */
-    void createBoolArray(int64_t& numItems, BoolArrayType::Pointer& thresholdArrayPtr);
-    
-    /**
-    * @brief Merges two DataArray<bool>s of a given size using a union operator AND / OR and inverts the second DataArray if requested
-    * @param numItems Number of values in both DataArrays
-    * @param currentArray DataArray<bool> to merge values into
-    * @param unionOperator Union operator used to merge into currentArray
-    * @param newArray DataArray<bool> of values to merge into the currentArray
-    * @param inverse Should newArray have its boolean values flipped before being merged in
+    * @brief Returns a cleared ThresholdMask sized to the selected AttributeMatrix, reusing a released mask when one is available
     */
-    void insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArray, int unionOperator, const BoolArrayType::Pointer newArray, bool inverse);
-    
+    ThresholdMask::Pointer acquireThresholdMask();
+
     /**
-    * @brief Flips the boolean values for a DataArray<bool>
-    * @param numItems Number of tuples in the DataArray
-    * @param thresholdArray DataArray to invert
+    * @brief Hands a mask obtained from acquireThresholdMask back so later comparison sets can reuse it
+    * @param mask Mask that is no longer needed
     */
-    void invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray);
+    void releaseThresholdMask(ThresholdMask::Pointer mask);
 
     /**
-    * @brief Performs a check on a ComparisonSet and either merges the result into the DataArray passed in or replaces the DataArray
+    * @brief Performs a check on a ComparisonSet and either merges the result into the mask passed in or replaces its contents
     * @param comparisonSet The set of comparisons used for setting the threshold
-    * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
+    * @param inputThreshold ThresholdMask merged into or overwritten with the ComparisonSet's threshold output
     * @param err Return any error code given
     * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
     * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
     */
-    void thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
-    
+    void thresholdSet(ComparisonSet::Pointer comparisonSet, ThresholdMask::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
+
     /**
-    * @brief Performs a check on a single ComparisonValue and either merges the result into the DataArray passed in or replaces the DataArray
+    * @brief Performs a check on a single ComparisonValue and either merges the result into the mask passed in or replaces its contents.
+    * The comparison writes straight into inputThreshold without any intermediate array.
     * @param comparisonValue The comparison operator and value used for caluculating the threshold
-    * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
+    * @param inputThreshold ThresholdMask merged into or overwritten with the ComparisonValue's threshold output
     * @param err Return any error code given
     * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
     * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
     */
-    void thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
+    void thresholdValue(ComparisonValue::Pointer comparisonValue, ThresholdMask::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
 
 
   private:
     DEFINE_DATAARRAY_VARIABLE(bool, Destination)
 
+    std::vector<ThresholdMask::Pointer> m_MaskPool;
+
   public:
     MultiThresholdObjects2(const MultiThresholdObjects2&) = delete; // Copy Constructor Not Implemented
     MultiThresholdObjects2(MultiThresholdObjects2&&) = delete;      // Move Constructor Not Implemented
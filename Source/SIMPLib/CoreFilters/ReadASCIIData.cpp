@@ -4,6 +4,20 @@
 
 #include "ReadASCIIData.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
@@ -11,7 +25,6 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
-#include "SIMPLib/Utilities/StringOperations.h"
 #include "SIMPLib/Utilities/SIMPLDataPathValidator.h"
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -20,8 +33,149 @@
 
 namespace {
    const QString k_Skip("Skip");
+
+   // Number of lines that are located, parsed and reported on at a time
+   const size_t k_LinesPerBatch = 65536;
 }
 
+/**
+ * @brief The ReadASCIIDataImpl class tokenizes and converts a range of lines of the input file. Lines
+ * and tokens are spans into the mapped file that are handed to the column parsers directly, so nothing
+ * is copied unless a value needs the QString fallback conversion. Each line writes its own tuple, so
+ * ranges of lines may be parsed concurrently as long as every parser can parse concurrently.
+ */
+class ReadASCIIDataImpl
+{
+public:
+  using Span = std::pair<const char*, const char*>;
+
+  /**
+   * @brief The Error struct records the first line of a batch that could not be parsed
+   */
+  struct Error
+  {
+    size_t lineIndex = std::numeric_limits<size_t>::max();
+    int code = 0;
+    QString message;
+    std::mutex mutex;
+  };
+
+  ReadASCIIDataImpl(const std::vector<Span>& lines, size_t firstTuple, int firstLineNumber, const QList<AbstractDataParser::Pointer>& parsers, size_t numColumns,
+                    const std::array<bool, 256>& isDelimiter, bool hasDelimiters, Error* error)
+  : m_Lines(lines)
+  , m_FirstTuple(firstTuple)
+  , m_FirstLineNumber(firstLineNumber)
+  , m_Parsers(parsers)
+  , m_NumColumns(numColumns)
+  , m_IsDelimiter(isDelimiter)
+  , m_HasDelimiters(hasDelimiters)
+  , m_Error(error)
+  {
+  }
+  virtual ~ReadASCIIDataImpl() = default;
+
+  /**
+   * @brief Splits a line on runs of delimiters, matching StringOperations::TokenizeString, which never produces
+   * empty tokens. At most tokens.size() spans are stored but every token is counted.
+   */
+  size_t tokenize(const Span& line, std::vector<Span>& tokens) const
+  {
+    if(!m_HasDelimiters)
+    {
+      if(!tokens.empty())
+      {
+        tokens[0] = line;
+      }
+      return 1;
+    }
+
+    size_t count = 0;
+    const char* p = line.first;
+    while(p != line.second)
+    {
+      while(p != line.second && m_IsDelimiter[static_cast<unsigned char>(*p)])
+      {
+        ++p;
+      }
+      if(p == line.second)
+      {
+        break;
+      }
+      const char* tokenBegin = p;
+      while(p != line.second && !m_IsDelimiter[static_cast<unsigned char>(*p)])
+      {
+        ++p;
+      }
+      if(count < tokens.size())
+      {
+        tokens[count] = Span(tokenBegin, p);
+      }
+      count++;
+    }
+    return count;
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<Span> tokens(m_NumColumns);
+    for(size_t i = start; i < end; i++)
+    {
+      int lineNum = m_FirstLineNumber + static_cast<int>(i);
+      size_t numTokens = tokenize(m_Lines[i], tokens);
+      if(numTokens != m_NumColumns)
+      {
+        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+        QTextStream out(&ss);
+        out << "Expecting " << m_NumColumns << " but found " << numTokens << "\n";
+        out << "Input line was:\n";
+        out << CharSpanParsing::ToQString(m_Lines[i].first, m_Lines[i].second);
+        setError(i, ReadASCIIData::INCONSISTENT_COLS, ss);
+        return;
+      }
+
+      for(const AbstractDataParser::Pointer& parser : m_Parsers)
+      {
+        int index = parser->getColumnIndex();
+        ParserFunctor::ErrorObject obj = parser->parse(tokens[index].first, tokens[index].second, m_FirstTuple + i);
+        if(!obj.ok)
+        {
+          QString ss = obj.errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+          setError(i, ReadASCIIData::CONVERSION_FAILURE, ss);
+          return;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<Span>& m_Lines;
+  size_t m_FirstTuple;
+  int m_FirstLineNumber;
+  const QList<AbstractDataParser::Pointer>& m_Parsers;
+  size_t m_NumColumns;
+  const std::array<bool, 256>& m_IsDelimiter;
+  bool m_HasDelimiters;
+  Error* m_Error;
+
+  void setError(size_t lineIndex, int code, const QString& message) const
+  {
+    std::lock_guard<std::mutex> lock(m_Error->mutex);
+    if(lineIndex < m_Error->lineIndex)
+    {
+      m_Error->lineIndex = lineIndex;
+      m_Error->code = code;
+      m_Error->message = message;
+    }
+  }
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -448,7 +602,6 @@ void ReadASCIIData::execute()
   QStringList headers = wizardData.dataHeaders;
   QStringList dataTypes = wizardData.dataTypes;
   QList<char> delimiters = wizardData.delimiters;
-  bool consecutiveDelimiters = wizardData.consecutiveDelimiters;
   int numLines = wizardData.numberOfLines;
   int beginIndex = wizardData.beginIndex;
 
@@ -526,80 +679,151 @@ void ReadASCIIData::execute()
     }
   }
 
-  int insertIndex = 0;
+  // Columns whose arrays can not be written from several threads are parsed after the parallel pass
+  QList<AbstractDataParser::Pointer> concurrentParsers;
+  QList<AbstractDataParser::Pointer> serialParsers;
+  for(const AbstractDataParser::Pointer& parser : dataParsers)
+  {
+    if(parser->canParseConcurrently())
+    {
+      concurrentParsers.push_back(parser);
+    }
+    else
+    {
+      serialParsers.push_back(parser);
+    }
+  }
 
   SIMPLDataPathValidator* validator = SIMPLDataPathValidator::Instance();
   inputFilePath = validator->convertToAbsolutePath(inputFilePath);
 
   QFile inputFile(inputFilePath);
-  if(inputFile.open(QIODevice::ReadOnly))
+  if(!inputFile.open(QIODevice::ReadOnly))
   {
-    QTextStream in(&inputFile);
+    return;
+  }
 
-    for(int i = 1; i < beginIndex; i++)
+  // Map the file so lines can be tokenized in place. If the file can not be mapped it is read into memory instead.
+  qint64 fileSize = inputFile.size();
+  QByteArray fileContents;
+  const char* cursor = nullptr;
+  if(fileSize > 0)
+  {
+    cursor = reinterpret_cast<const char*>(inputFile.map(0, fileSize));
+    if(nullptr == cursor)
     {
-      // Skip to the first data line
-      in.readLine();
+      fileContents = inputFile.readAll();
+      cursor = fileContents.constData();
+      fileSize = fileContents.size();
     }
+  }
+  const char* fileEnd = cursor + fileSize;
 
-    float threshold = 0.0f;
-    size_t numTuples = numLines - beginIndex + 1;
-
-    for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
-    {
-      QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+  // Skip a UTF-8 byte order mark the same way QTextStream does
+  if(fileSize >= 3 && std::memcmp(cursor, "\xEF\xBB\xBF", 3) == 0)
+  {
+    cursor += 3;
+  }
 
-      if(dataTypes.size() != tokens.size())
+  // Returns the line starting at cursor without its "\n", "\r\n" or "\r" and moves cursor to the next line.
+  // Reading past the end of the file gives empty lines, like QTextStream::readLine().
+  auto nextLine = [&cursor, fileEnd]() -> ReadASCIIDataImpl::Span {
+    const char* lineBegin = cursor;
+    const char* lineEnd = fileEnd;
+    if(cursor != fileEnd)
+    {
+      const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(fileEnd - cursor)));
+      const char* searchEnd = (nullptr != newline) ? newline : fileEnd;
+      const char* carriageReturn = static_cast<const char*>(std::memchr(cursor, '\r', static_cast<size_t>(searchEnd - cursor)));
+      if(nullptr != carriageReturn)
       {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
+        // Either the "\r" of a "\r\n" or a bare "\r" as in classic Mac OS files
+        lineEnd = carriageReturn;
+        cursor = (carriageReturn + 1 == newline) ? newline + 1 : carriageReturn + 1;
       }
-
-      for(int i = 0; i < dataParsers.size(); i++)
+      else if(nullptr != newline)
       {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-          return;
-        }
+        lineEnd = newline;
+        cursor = newline + 1;
       }
-
-      if((static_cast<float>(lineNum) / numTuples) * 100.0f > threshold)
+      else
       {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg((static_cast<float>(lineNum) / numTuples) * 100.0f, 0, 'f', 0);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < (static_cast<float>(lineNum) / numTuples) * 100.0f)
-        {
-          threshold = (static_cast<float>(lineNum) / numTuples) * 100.0f;
-        }
+        cursor = fileEnd;
       }
+    }
+    return ReadASCIIDataImpl::Span(lineBegin, lineEnd);
+  };
 
-      if(getCancel())
-      {
-        return;
-      }
+  for(int i = 1; i < beginIndex; i++)
+  {
+    // Skip to the first data line
+    nextLine();
+  }
 
-      insertIndex++;
-    }
-    inputFile.close();
+  std::array<bool, 256> isDelimiter;
+  isDelimiter.fill(false);
+  for(char delimiter : delimiters)
+  {
+    isDelimiter[static_cast<unsigned char>(delimiter)] = true;
   }
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  size_t numTuples = (numLines >= beginIndex) ? static_cast<size_t>(numLines - beginIndex + 1) : 0;
+  std::vector<ReadASCIIDataImpl::Span> lines;
+  lines.reserve(std::min(numTuples, k_LinesPerBatch));
+
+  for(size_t batchStart = 0; batchStart < numTuples; batchStart += k_LinesPerBatch)
+  {
+    // Locating line breaks is a cheap sequential scan; tokenizing and converting the lines is done in parallel
+    size_t batchSize = std::min(k_LinesPerBatch, numTuples - batchStart);
+    lines.resize(batchSize);
+    for(size_t i = 0; i < batchSize; i++)
+    {
+      lines[i] = nextLine();
+    }
+
+    // The parallel pass also checks the number of columns of every line, even without concurrent parsers
+    ReadASCIIDataImpl::Error error;
+    ReadASCIIDataImpl impl(lines, batchStart, beginIndex + static_cast<int>(batchStart), concurrentParsers, static_cast<size_t>(dataTypes.size()), isDelimiter, !delimiters.isEmpty(), &error);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, batchSize), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, batchSize);
+    }
+
+    if(error.code >= 0 && !serialParsers.isEmpty())
+    {
+      ReadASCIIDataImpl serialImpl(lines, batchStart, beginIndex + static_cast<int>(batchStart), serialParsers, static_cast<size_t>(dataTypes.size()), isDelimiter, !delimiters.isEmpty(), &error);
+      serialImpl.compute(0, batchSize);
+    }
+
+    if(error.code < 0)
+    {
+      setErrorCondition(error.code);
+      notifyErrorMessage(getHumanLabel(), error.message, getErrorCondition());
+      return;
+    }
+
+    // Print the status of the import
+    float percent = static_cast<float>(batchStart + batchSize) / numTuples * 100.0f;
+    QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(percent, 0, 'f', 0);
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+
+    if(getCancel())
+    {
+      return;
+    }
+  }
+  inputFile.close();
 }
 
 // -----------------------------------------------------------------------------
@@ -33,6 +33,8 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include <QtCore/QCoreApplication>
 
 #include "SIMPLib/Common/Constants.h"
@@ -53,7 +55,15 @@
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+#include "SIMPLib/CoreFilters/util/AdditionOperator.h"
+#include "SIMPLib/CoreFilters/util/CalculatorArray.hpp"
+#include "SIMPLib/CoreFilters/util/CalculatorKernel.h"
 #include "SIMPLib/CoreFilters/util/CalculatorOperator.h"
+#include "SIMPLib/CoreFilters/util/DivisionOperator.h"
+#include "SIMPLib/CoreFilters/util/MultiplicationOperator.h"
+#include "SIMPLib/CoreFilters/util/SinOperator.h"
+#include "SIMPLib/CoreFilters/util/SqrtOperator.h"
+#include "SIMPLib/CoreFilters/util/SubtractionOperator.h"
 
 class DummyObserver : public Observer
 {
@@ -919,6 +929,76 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void KernelMatchesScalarPathTest()
+  {
+    // The lengths straddle the kernel's block size so the partial last block is covered
+    std::vector<size_t> lengths = {1, 7, CalculatorKernel::BlockSize - 1, CalculatorKernel::BlockSize, CalculatorKernel::BlockSize + 1, 3 * CalculatorKernel::BlockSize + 17};
+    DataArrayPath calculatedPath("DataContainer", "AttributeMatrix", "Result");
+
+    for(size_t numTuples : lengths)
+    {
+      Int32ArrayType::Pointer aArray = Int32ArrayType::CreateArray(numTuples, "A");
+      FloatArrayType::Pointer bArray = FloatArrayType::CreateArray(numTuples, "B");
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        aArray->setValue(i, static_cast<int32_t>(i % 17) - 8);
+        bArray->setValue(i, static_cast<float>(i) * 0.5f + 1.0f);
+      }
+      DoubleArrayType::Pointer three = DoubleArrayType::CreateArray(1, "3");
+      three->setValue(0, 3.0);
+
+      // sqrt(b) * a + sin(a) - b / 3
+      QVector<CalculatorItem::Pointer> rpn;
+      rpn.push_back(CalculatorArray<float>::New(bArray, ICalculatorArray::Array, true));
+      rpn.push_back(SqrtOperator::New());
+      rpn.push_back(CalculatorArray<int32_t>::New(aArray, ICalculatorArray::Array, true));
+      rpn.push_back(MultiplicationOperator::New());
+      rpn.push_back(CalculatorArray<int32_t>::New(aArray, ICalculatorArray::Array, true));
+      rpn.push_back(SinOperator::New());
+      rpn.push_back(AdditionOperator::New());
+      rpn.push_back(CalculatorArray<float>::New(bArray, ICalculatorArray::Array, true));
+      rpn.push_back(CalculatorArray<double>::New(three, ICalculatorArray::Number, true));
+      rpn.push_back(DivisionOperator::New());
+      rpn.push_back(SubtractionOperator::New());
+
+      CalculatorKernel::Pointer kernel = CalculatorKernel::New();
+      DREAM3D_REQUIRE_EQUAL(kernel->compile(rpn, false), true);
+      DoubleArrayType::Pointer fused = kernel->execute(calculatedPath.getDataArrayName());
+      DREAM3D_REQUIRE(fused.get() != nullptr);
+      DREAM3D_REQUIRE(fused->getNumberOfTuples() == numTuples);
+
+      ArrayCalculator::Pointer filter = ArrayCalculator::New();
+      filter->setUnits(ArrayCalculator::Radians);
+      QStack<ICalculatorArray::Pointer> executionStack;
+      for(const CalculatorItem::Pointer& item : rpn)
+      {
+        ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+        if(nullptr != calcArray)
+        {
+          executionStack.push(calcArray);
+          continue;
+        }
+        CalculatorOperator::Pointer calcOperator = std::dynamic_pointer_cast<CalculatorOperator>(item);
+        calcOperator->calculate(filter.get(), calculatedPath, executionStack);
+      }
+      DREAM3D_REQUIRE(executionStack.size() == 1);
+      ICalculatorArray::Pointer scalar = executionStack.pop();
+      DREAM3D_REQUIRE(scalar->getArray()->getNumberOfTuples() == numTuples);
+
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        double a = static_cast<double>(aArray->getValue(i));
+        double b = static_cast<double>(bArray->getValue(i));
+        double expected = std::sqrt(b) * a + std::sin(a) - b / 3.0;
+        DREAM3D_REQUIRE(SIMPLibMath::closeEnough<double>(fused->getValue(i), expected, 1.0E-9) == true);
+        DREAM3D_REQUIRE(SIMPLibMath::closeEnough<double>(fused->getValue(i), scalar->getValue(i), 1.0E-9) == true);
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -928,6 +1008,7 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(SingleComponentArrayCalculatorTest())
     DREAM3D_REGISTER_TEST(MultiComponentArrayCalculatorTest())
+    DREAM3D_REGISTER_TEST(KernelMatchesScalarPathTest())
   }
 
 private:
@@ -37,6 +37,7 @@
 #include <QtCore/QFile>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/CoreFilters/CreateFeatureArrayFromElementArray.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -341,6 +342,60 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestAggregationModes()
+  {
+    const int32_t featureIdValues[8] = {1, 1, 2, 2, 2, -1, 3, 1};
+    const float cellValues[8] = {1.0f, 3.0f, 5.0f, 5.0f, 6.0f, 9.0f, 7.0f, 2.0f};
+    // Expected values of Features 1, 2 and 3 for each AggregationMode
+    const float expected[6][3] = {{2.0f, 6.0f, 7.0f}, {1.0f, 5.0f, 7.0f}, {1.0f, 5.0f, 7.0f}, {3.0f, 6.0f, 7.0f}, {2.0f, 16.0f / 3.0f, 7.0f}, {1.0f, 5.0f, 7.0f}};
+
+    for(int mode = CreateFeatureArrayFromElementArray::Last; mode <= CreateFeatureArrayFromElementArray::Mode; mode++)
+    {
+      CreateFeatureArrayFromElementArray::Pointer filter = CreateFeatureArrayFromElementArray::New();
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New("DataContainer");
+      AttributeMatrix::Pointer cellAttr = AttributeMatrix::New(QVector<size_t>(1, 8), "Cell Attribute Matrix", AttributeMatrix::Type::Cell);
+      AttributeMatrix::Pointer featureAttr = AttributeMatrix::New(QVector<size_t>(1, 4), "Feature Attribute Matrix", AttributeMatrix::Type::CellFeature);
+
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(8, "FeatureIds");
+      FloatArrayType::Pointer cellData = FloatArrayType::CreateArray(8, "CellData");
+      for(size_t i = 0; i < 8; i++)
+      {
+        featureIds->setValue(i, featureIdValues[i]);
+        cellData->setValue(i, cellValues[i]);
+      }
+      cellAttr->addAttributeArray("FeatureIds", featureIds);
+      cellAttr->addAttributeArray("CellData", cellData);
+      dc->addAttributeMatrix("Cell Attribute Matrix", cellAttr);
+      dc->addAttributeMatrix("Feature Attribute Matrix", featureAttr);
+      dca->addDataContainer(dc);
+
+      filter->setDataContainerArray(dca);
+      filter->setFeatureIdsArrayPath(DataArrayPath("DataContainer", "Cell Attribute Matrix", "FeatureIds"));
+      filter->setSelectedCellArrayPath(DataArrayPath("DataContainer", "Cell Attribute Matrix", "CellData"));
+      filter->setCellFeatureAttributeMatrixName(DataArrayPath("DataContainer", "Feature Attribute Matrix", ""));
+      filter->setCreatedArrayName("CreatedArray");
+      filter->setAggregationMode(mode);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+      // Features 1 and 2 hold differing values
+      DREAM3D_REQUIRE_EQUAL(filter->getWarningCondition(), -1000)
+
+      FloatArrayType::Pointer created = featureAttr->getAttributeArrayAs<FloatArrayType>("CreatedArray");
+      DREAM3D_REQUIRE_VALID_POINTER(created.get())
+      for(size_t f = 1; f < 4; f++)
+      {
+        float value = expected[mode][f - 1];
+        DREAM3D_COMPARE_FLOATS(&value, created->getPointer(f), 2)
+      }
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -352,6 +407,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestAggregationModes())
   }
 
 private:
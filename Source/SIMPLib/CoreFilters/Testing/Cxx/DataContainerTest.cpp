@@ -46,6 +46,7 @@
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StructArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -110,6 +111,11 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString RegionFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Region.h5");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -136,6 +142,7 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::RegionFile());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -460,6 +467,221 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBackgroundWriter()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile()));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+    int numDataContainers = dca->getNumDataContainers();
+    DREAM3D_REQUIRE(numDataContainers > 0)
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile2());
+    writer->setWriteInBackground(true);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+
+    // The writer works from a snapshot so the data structure may change while the file is written
+    QList<QString> names = dca->getDataContainerNames();
+    for(const QString& name : names)
+    {
+      dca->removeDataContainer(name);
+    }
+
+    // Reading the file waits for the background write to finish
+    DataContainerArray::Pointer dca2 = DataContainerArray::New();
+    DataContainerReader::Pointer reader2 = DataContainerReader::New();
+    reader2->setInputFile(DataContainerIOTest::TestFile2());
+    reader2->setDataContainerArray(dca2);
+    reader2->setInputFileDataContainerArrayProxy(reader2->readDataContainerArrayStructure(DataContainerIOTest::TestFile2()));
+    reader2->execute();
+    DREAM3D_REQUIRE(reader2->getErrorCondition() >= 0)
+    DREAM3D_REQUIRE_EQUAL(dca2->getNumDataContainers(), numDataContainers)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLazyLoadReader()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile()));
+    reader->setLazyLoad(true);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+
+    LazyLoadStatistics::Pointer stats = reader->getLazyLoadStatistics();
+    DREAM3D_REQUIRE(stats->getRegisteredArrayCount() > 0)
+    DREAM3D_REQUIRE_EQUAL(stats->getMissCount(), 0)
+
+    DataArrayPath featureIdsPath(SIMPL::Defaults::DataContainerName, getCellFeatureAttributeMatrixName(), SIMPL::CellData::FeatureIds);
+    Int32ArrayType::Pointer featureIds = dca->getAttributeMatrix(featureIdsPath)->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds->isLazyLoadPending(), true)
+    DREAM3D_REQUIRE_EQUAL(featureIds->isAllocated(), true)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), DataContainerIOTest::XSize * DataContainerIOTest::YSize * DataContainerIOTest::ZSize)
+
+    // The first access reads the data, every later one is a hit
+    int32_t* ptr = featureIds->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(featureIds->isLazyLoadPending(), false)
+    DREAM3D_REQUIRE_EQUAL(stats->getMissCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(stats->getBytesLoaded(), featureIds->getSize() * sizeof(int32_t))
+    DREAM3D_REQUIRE_EQUAL(ptr[0], DataContainerIOTest::Offset)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(5), 5 + DataContainerIOTest::Offset)
+    featureIds->getVoidPointer(0);
+    DREAM3D_REQUIRE_EQUAL(stats->getHitCount(), 1)
+
+    // Writing the data structure loads whatever is still pending
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile2());
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+    DREAM3D_REQUIRE_EQUAL(stats->getMissCount(), stats->getRegisteredArrayCount())
+
+    // Overwriting the file the arrays are deferred from reads them before the file is truncated
+    DataContainerArray::Pointer dca2 = DataContainerArray::New();
+    reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile2());
+    reader->setDataContainerArray(dca2);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile2()));
+    reader->setLazyLoad(true);
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+    writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca2);
+    writer->setOutputFile(DataContainerIOTest::TestFile2());
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+
+    DataContainerArray::Pointer dca3 = DataContainerArray::New();
+    reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile2());
+    reader->setDataContainerArray(dca3);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile2()));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+    featureIds = dca3->getAttributeMatrix(featureIdsPath)->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_VALID_POINTER(featureIds.get())
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(5), 5 + DataContainerIOTest::Offset)
+
+    // A failed read leaves a zero filled array behind and reports the failure once
+    Int32ArrayType::Pointer failing = Int32ArrayType::CreateArray(10, "Failing", false);
+    DREAM3D_REQUIRE_EQUAL(failing->setLazyLoader([](void*, size_t) { return -1; }, LazyLoadStatistics::NullPointer(), "Missing.dream3d"), true)
+    DREAM3D_REQUIRE_EQUAL(failing->getLazyLoadSource(), QString("Missing.dream3d"))
+    DREAM3D_REQUIRE(failing->resolveLazyLoadNow() < 0)
+    DREAM3D_REQUIRE_VALID_POINTER(failing->getPointer(0))
+    DREAM3D_REQUIRE_EQUAL(failing->getValue(9), 0)
+    DREAM3D_REQUIRE_EQUAL(failing->takeLazyLoadError().isEmpty(), false)
+    DREAM3D_REQUIRE_EQUAL(failing->takeLazyLoadError().isEmpty(), true)
+
+    // The failure is also recorded in the statistics the array was registered with
+    LazyLoadStatistics::Pointer statistics = LazyLoadStatistics::New();
+    failing = Int32ArrayType::CreateArray(10, "Failing", false);
+    DREAM3D_REQUIRE_EQUAL(failing->setLazyLoader([](void*, size_t) { return -1; }, statistics, "Missing.dream3d"), true)
+    DREAM3D_REQUIRE_EQUAL(statistics->takeFailures().size(), 0)
+    DREAM3D_REQUIRE(failing->resolveLazyLoadNow() < 0)
+    DREAM3D_REQUIRE_EQUAL(statistics->takeFailures().size(), 1)
+    DREAM3D_REQUIRE_EQUAL(statistics->takeFailures().size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRegionOfInterestReader()
+  {
+    size_t nx = DataContainerIOTest::XSize;
+    size_t ny = DataContainerIOTest::YSize;
+    size_t nz = DataContainerIOTest::ZSize;
+    QVector<size_t> tupleDims = {nx, ny, nz};
+
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(nx, ny, nz);
+      image->setResolution(0.5f, 0.5f, 0.5f);
+      image->setOrigin(1.0f, 2.0f, 3.0f);
+      dc->setGeometry(image);
+      dca->addDataContainer(dc);
+
+      AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tupleDims, getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
+      dc->addAttributeMatrix(cellAttrMat->getName(), cellAttrMat);
+      Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tupleDims, QVector<size_t>(1, 1), SIMPL::CellData::FeatureIds);
+      for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+      {
+        featureIds->setValue(i, static_cast<int32_t>(i));
+      }
+      cellAttrMat->addAttributeArray(featureIds->getName(), featureIds);
+      CreateStringArray(cellAttrMat, QVector<size_t>(1, 1));
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::RegionFile());
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::RegionFile());
+    reader->setDataContainerArray(dca);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::RegionFile()));
+    // The maximum along Z lies past the end of the volume and is clamped
+    bool validRegion = reader->setRegionOfInterest(SIMPL::Defaults::ImageDataContainerName, {1, 1, 1}, {3, 2, 10}, {2, 1, 1});
+    DREAM3D_REQUIRE_EQUAL(validRegion, true)
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+
+    DataContainer::Pointer dc = dca->getDataContainer(SIMPL::Defaults::ImageDataContainerName);
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    size_t dims[3] = {0, 0, 0};
+    std::tie(dims[0], dims[1], dims[2]) = image->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(dims[0], 2)
+    DREAM3D_REQUIRE_EQUAL(dims[1], 2)
+    DREAM3D_REQUIRE_EQUAL(dims[2], 2)
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    image->getOrigin(origin);
+    image->getResolution(res);
+    // Offsets and strides of a half voxel resolution are exact in floating point
+    DREAM3D_REQUIRE_EQUAL(origin[0], 1.5f)
+    DREAM3D_REQUIRE_EQUAL(origin[2], 3.5f)
+    DREAM3D_REQUIRE_EQUAL(res[0], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(res[1], 0.5f)
+
+    // Voxel (x, y, z) of the region is voxel (1 + 2x, 1 + y, 1 + z) of the stored volume
+    AttributeMatrix::Pointer cellAttrMat = dc->getAttributeMatrix(getCellAttributeMatrixName());
+    DREAM3D_REQUIRE_EQUAL(cellAttrMat->getNumberOfTuples(), 8)
+    Int32ArrayType::Pointer featureIds = cellAttrMat->getAttributeArrayAs<Int32ArrayType>(SIMPL::CellData::FeatureIds);
+    DREAM3D_REQUIRE_EQUAL(featureIds->getNumberOfTuples(), 8)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(0), static_cast<int32_t>((1 * ny + 1) * nx + 1))
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(7), static_cast<int32_t>((2 * ny + 2) * nx + 3))
+
+    StringDataArray::Pointer strings = cellAttrMat->getAttributeArrayAs<StringDataArray>("ExampleStringDataArray");
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), 8)
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(0), QString("string_%1").arg((1 * ny + 1) * nx + 1))
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(1), QString("string_%1").arg((1 * ny + 1) * nx + 3))
+    DREAM3D_REQUIRE_EQUAL(strings->getValue(7), QString("string_%1").arg((2 * ny + 2) * nx + 3))
+
+    // A region that lies outside of the volume is an error
+    reader->setRegionOfInterest(SIMPL::Defaults::ImageDataContainerName, {nx, 0, 0}, {nx + 2, 1, 1});
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() < 0)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -635,6 +857,121 @@ public:
     dap2.update("Foo", "Bar", "Baz");
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNameLookup()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addDataContainer(dc);
+    dca->addDataContainer(DataContainer::New("Other"));
+
+    QVector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(am->getName(), am);
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(10, "Ids");
+    am->addAttributeArray(ids->getName(), ids);
+
+    DREAM3D_REQUIRE(dca->getDataContainer("DataContainer") == dc)
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Missing"), false)
+
+    // Renames and removals must be seen by the index
+    DREAM3D_REQUIRE_EQUAL(dca->renameDataContainer("DataContainer", "Renamed"), true)
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("DataContainer"), false)
+    DREAM3D_REQUIRE(dca->getDataContainer("Renamed") == dc)
+    dca->removeDataContainer("Other");
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Other"), false)
+    dca->addDataContainer(DataContainer::New("Other"));
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Other"), true)
+
+    DREAM3D_REQUIRE(dca->getAttributeMatrix(DataArrayPath("Renamed", "CellData", "")) == am)
+    DREAM3D_REQUIRE_EQUAL(dca->renameDataContainer("Renamed", "DataContainer"), true)
+
+    // Renaming the DataContainer itself bypasses renameDataContainer()
+    dc->setName("Direct");
+    DREAM3D_REQUIRE(dca->getDataContainer("Direct") == dc)
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("Direct"), true)
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("DataContainer"), false)
+
+    // Replacing a DataContainer with another one of the same name
+    DataContainer::Pointer swapped = DataContainer::New("Direct");
+    DREAM3D_REQUIRE(dca->removeDataContainer("Direct") == dc)
+    DREAM3D_REQUIRE(nullptr == dca->getDataContainer("Direct").get())
+    dca->addDataContainer(swapped);
+    DREAM3D_REQUIRE(dca->getDataContainer("Direct") == swapped)
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeMatrix(DataArrayPath("Direct", "CellData", "")).get())
+  }
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    const size_t numFeatures = 6;
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, numFeatures), "FeatureData", AttributeMatrix::Type::CellFeature);
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(numFeatures, QVector<size_t>(1, 2), "Values");
+    StringDataArray::Pointer labels = StringDataArray::CreateArray(numFeatures, "Labels");
+    for(size_t i = 0; i < numFeatures; i++)
+    {
+      values->setComponent(i, 0, static_cast<int32_t>(i));
+      values->setComponent(i, 1, static_cast<int32_t>(i * 10));
+      labels->setValue(i, QString::number(i));
+    }
+    am->addAttributeArray(values->getName(), values);
+    am->addAttributeArray(labels->getName(), labels);
+    // Every Feature lists its neighbors i - 1 and i + 1 with a matching shared area each
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numFeatures, "Neighbors");
+    NeighborList<float>::Pointer areas = NeighborList<float>::CreateArray(numFeatures, "SharedAreas");
+    for(size_t i = 1; i < numFeatures; i++)
+    {
+      NeighborList<int32_t>::SharedVectorType list(new std::vector<int32_t>);
+      NeighborList<float>::SharedVectorType areaList(new std::vector<float>);
+      for(size_t n = i - 1; n <= i + 1; n += 2)
+      {
+        if(n > 0 && n < numFeatures)
+        {
+          list->push_back(static_cast<int32_t>(n));
+          areaList->push_back(static_cast<float>(n));
+        }
+      }
+      neighbors->setList(static_cast<int>(i), list);
+      areas->setList(static_cast<int>(i), areaList);
+    }
+    neighbors->getListReference(1).push_back(5);
+    areas->getListReference(1).push_back(5.0f);
+    am->addAttributeArray(neighbors->getName(), neighbors);
+    am->addAttributeArray(areas->getName(), areas);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(8, "FeatureIds");
+    int32_t ids[8] = {0, 1, 2, 3, 4, 5, 5, 2};
+    std::copy(ids, ids + 8, featureIds->getPointer(0));
+
+    QVector<bool> active(static_cast<int>(numFeatures), true);
+    active[2] = false;
+    active[4] = false;
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get()), true)
+
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 4)
+    int32_t kept[4] = {0, 1, 3, 5};
+    for(size_t i = 0; i < 4; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 0), kept[i])
+      DREAM3D_REQUIRE_EQUAL(values->getComponent(i, 1), kept[i] * 10)
+      DREAM3D_REQUIRE_EQUAL(labels->getValue(i), QString::number(kept[i]))
+    }
+
+    // NeighborLists cannot be compacted with the Feature Ids and are removed
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist(neighbors->getName()), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist(areas->getName()), false)
+
+    int32_t renumbered[8] = {0, 1, 0, 2, 0, 3, 3, 0};
+    for(size_t i = 0; i < 8; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), renumbered[i])
+    }
+  }
+
+
 #if 0
     template<typename T, typename K>
     void _arrayCreation(VolumeDataContainer::Pointer m)
@@ -905,7 +1242,12 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestBackgroundWriter())
+    DREAM3D_REGISTER_TEST(TestLazyLoadReader())
+    DREAM3D_REGISTER_TEST(TestRegionOfInterestReader())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
+    DREAM3D_REGISTER_TEST(TestNameLookup())
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -33,6 +33,8 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include <cmath>
+#include <cstring>
+#include <limits>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
@@ -41,6 +43,7 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -54,6 +57,7 @@
 
 #include "SIMPLib/CoreFilters/ReadASCIIData.h"
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/CoreFilters/util/ParserFunctors.hpp"
 
 const QString DataContainerName = "DataContainer";
 const QString AttributeMatrixName = "AttributeMatrix";
@@ -410,6 +414,158 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStringColumn()
+  {
+    // Enough lines to span several batches and to be split across threads within each batch
+    const int numLines = 150000;
+    const QString StringArrayName = "Array2";
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders.push_back(DataArrayName);
+    data.dataHeaders.push_back(StringArrayName);
+    data.dataTypes.push_back(SIMPL::TypeNames::Int32);
+    data.dataTypes.push_back(SIMPL::TypeNames::String);
+    data.delimiters.push_back(',');
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = numLines;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, static_cast<size_t>(numLines));
+
+    // Strings of different lengths so that a mixed up row can not go unnoticed
+    auto expectedString = [](int row) { return QString("Row%1").arg(row) + QString(row % 7, 'x'); };
+
+    QFile file(UnitTest::ReadASCIIDataTest::TestFile1);
+    DREAM3D_REQUIRE(file.open(QFile::WriteOnly))
+    for(int row = 0; row < numLines; row++)
+    {
+      file.write(QByteArray::number(row));
+      file.write(",");
+      file.write(expectedString(row).toUtf8());
+      file.write("\n");
+    }
+    file.close();
+
+    AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+    DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+    importASCIIData->execute();
+    DREAM3D_REQUIRE_EQUAL(importASCIIData->getErrorCondition(), 0)
+
+    AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+    Int32ArrayType::Pointer ids = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(DataArrayName));
+    StringDataArray::Pointer strings = std::dynamic_pointer_cast<StringDataArray>(am->getAttributeArray(StringArrayName));
+    DREAM3D_REQUIRE_VALID_POINTER(ids.get())
+    DREAM3D_REQUIRE_VALID_POINTER(strings.get())
+    DREAM3D_REQUIRE_EQUAL(strings->getNumberOfTuples(), static_cast<size_t>(numLines))
+    for(int row = 0; row < numLines; row++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ids->getValue(row), row)
+      DREAM3D_REQUIRE_EQUAL(strings->getValue(row), expectedString(row))
+    }
+
+    RemoveTestFiles();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLineEndings()
+  {
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders.push_back(DataArrayName);
+    data.dataTypes.push_back(SIMPL::TypeNames::Int32);
+    data.delimiters.push_back('\t');
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = 10;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, 10);
+
+    // Classic Mac OS ("\r"), Windows ("\r\n") and Unix ("\n") line endings
+    std::vector<QByteArray> lineEndings = {"\r", "\r\n", "\n"};
+    for(const QByteArray& lineEnding : lineEndings)
+    {
+      QFile file(UnitTest::ReadASCIIDataTest::TestFile1);
+      DREAM3D_REQUIRE(file.open(QFile::WriteOnly))
+      for(size_t row = 0; row < inputIntVector.size(); row++)
+      {
+        file.write(QByteArray::number(inputIntVector[row]));
+        file.write(lineEnding);
+      }
+      file.close();
+
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      DREAM3D_REQUIRE_EQUAL(importASCIIData->getErrorCondition(), 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer results = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray(DataArrayName));
+      DREAM3D_REQUIRE_VALID_POINTER(results.get())
+      DREAM3D_REQUIRE_EQUAL(results->getSize(), data.numberOfLines)
+      for(size_t i = 0; i < results->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(results->getValue(i), inputIntVector[i])
+      }
+
+      RemoveTestFiles();
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCharSpanParsing()
+  {
+    // Values accepted by the span parsers must convert exactly like QString does
+    QStringList doubleTokens = {"0", "-0", "1.5", "-.25", "3.", "6.534", "43.4e-1", "1E22", "9007199254740992", "0.1", "123456.789012"};
+    for(const QString& token : doubleTokens)
+    {
+      QByteArray bytes = token.toLatin1();
+      double value = 0.0;
+      bool ok = CharSpanParsing::ParseDouble(bytes.constData(), bytes.constData() + bytes.size(), value);
+      DREAM3D_REQUIRE_EQUAL(ok, true)
+      DREAM3D_REQUIRE_EQUAL(value, token.toDouble())
+    }
+
+    // Anything else is left to the QString conversion
+    QStringList rejectedTokens = {"", "-", "1e23", "9007199254740993", "1.5x", " 1", "inf", "nan", "1e"};
+    for(const QString& token : rejectedTokens)
+    {
+      QByteArray bytes = token.toLatin1();
+      double value = 0.0;
+      DREAM3D_REQUIRE_EQUAL(CharSpanParsing::ParseDouble(bytes.constData(), bytes.constData() + bytes.size(), value), false)
+    }
+
+    const char* minInt64 = "-9223372036854775808";
+    int64_t intValue = 0;
+    DREAM3D_REQUIRE_EQUAL(CharSpanParsing::ParseInteger(minInt64, minInt64 + std::strlen(minInt64), intValue), true)
+    DREAM3D_REQUIRE_EQUAL(intValue, std::numeric_limits<int64_t>::min())
+    const char* overflow = "9223372036854775808";
+    DREAM3D_REQUIRE_EQUAL(CharSpanParsing::ParseInteger(overflow, overflow + std::strlen(overflow), intValue), false)
+    const char* octal = "010";
+    DREAM3D_REQUIRE_EQUAL(CharSpanParsing::ParseInteger(octal, octal + 3, intValue, false), false)
+
+    // A value that falls back to QString still goes through the same range checks
+    ParserFunctor::ErrorObject obj;
+    const char* outOfRange = "300";
+    Int8Functor()(outOfRange, outOfRange + 3, obj);
+    DREAM3D_REQUIRE_EQUAL(obj.ok, false)
+    const char* hex = "0x0A";
+    int8_t hexValue = Int8Functor()(hex, hex + 4, obj);
+    DREAM3D_REQUIRE_EQUAL(obj.ok, true)
+    DREAM3D_REQUIRE_EQUAL(hexValue, 10)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -441,6 +597,9 @@ public:
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
+    DREAM3D_REGISTER_TEST(TestCharSpanParsing())
+    DREAM3D_REGISTER_TEST(TestLineEndings())
+    DREAM3D_REGISTER_TEST(TestStringColumn())
     DREAM3D_REGISTER_TEST(RunTest())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
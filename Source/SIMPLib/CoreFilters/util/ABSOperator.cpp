@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 ABSOperator::ABSOperator()
 {
+  setOpCode(OpCode::Abs);
   setNumberOfArguments(1);
   setInfixToken("abs");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 ACosOperator::ACosOperator()
 {
+  setOpCode(OpCode::ACos);
   setNumberOfArguments(1);
   setInfixToken("acos");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 ASinOperator::ASinOperator()
 {
+  setOpCode(OpCode::ASin);
   setNumberOfArguments(1);
   setInfixToken("asin");
 }
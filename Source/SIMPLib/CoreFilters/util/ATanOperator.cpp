@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 ATanOperator::ATanOperator()
 {
+  setOpCode(OpCode::ATan);
   setNumberOfArguments(1);
   setInfixToken("atan");
 }
@@ -29,6 +29,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <type_traits>
+
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -66,6 +68,26 @@ public:
 
   virtual ParserFunctor::ErrorObject parse(const QString& token, size_t index) = 0;
 
+  /**
+   * @brief Parses the characters in [begin, end) without copying them and stores the value at index.
+   * Different indices may be parsed concurrently if canParseConcurrently() returns true.
+   * @param begin
+   * @param end
+   * @param index
+   * @return
+   */
+  virtual ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index) = 0;
+
+  /**
+   * @brief canParseConcurrently Returns false if storing a value touches state that is shared by all indices
+   * so the column must be parsed from a single thread.
+   * @return
+   */
+  virtual bool canParseConcurrently() const
+  {
+    return true;
+  }
+
 protected:
   AbstractDataParser() :
   m_ColumnIndex(0)
@@ -122,6 +144,20 @@ public:
     return obj;
   }
 
+  ParserFunctor::ErrorObject parse(const char* begin, const char* end, size_t index) override
+  {
+    ParserFunctor::ErrorObject obj;
+    obj.ok = true;
+    (*m_Ptr).setValue(index, F()(begin, end, obj));
+    return obj;
+  }
+
+  bool canParseConcurrently() const override
+  {
+    // StringDataArray::setValue() allocates every string, and may reorganize its storage, for the whole array
+    return !std::is_same<ArrayType, StringDataArray>::value;
+  }
+
 protected:
   Parser(typename ArrayType::Pointer ptr, const QString& name, int index)
   {
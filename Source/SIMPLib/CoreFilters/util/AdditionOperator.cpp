@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 AdditionOperator::AdditionOperator()
 {
+  setOpCode(OpCode::Addition);
   setPrecedence(A_Precedence);
   setInfixToken("+");
 }
@@ -81,12 +81,12 @@ class SIMPLib_EXPORT BinaryOperator : public CalculatorOperator
       newArray = DoubleArrayType::CreateArray(array2->getArray()->getNumberOfTuples(), array2->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                          \
     }                                                                                                                                                                                                  \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                             \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                          \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                               \
         double num1 = array1->getValue(index);                                                                                                                                                         \
         double num2 = array2->getValue(index);                                                                                                                                                         \
         newArray->setValue(index, num2 op num1);                                                                                                                                                       \
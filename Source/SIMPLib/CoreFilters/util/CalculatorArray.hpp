@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <QtCore/QObject>
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -55,30 +57,54 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
 
     ~CalculatorArray() override = default;
 
-    IDataArray::Pointer getArray() override { return m_Array; }
+    IDataArray::Pointer getArray() override
+    {
+      convertToDouble();
+      return m_Array;
+    }
 
-    void setValue(int i, double val) override
+    void setValue(size_t i, double val) override
     {
+      convertToDouble();
       m_Array->setValue(i, val);
     }
 
-    double getValue(int i) override
+    double getValue(size_t i) override
     {
-      if (m_Array->getNumberOfTuples() > 1)
+      if(m_Converted)
       {
-        return static_cast<double>(m_Array->getValue(i));
+        return ReadValue<double>(*m_Array, i);
       }
-      else if (m_Array->getNumberOfTuples() == 1)
+      return ReadValue<T>(*m_SourceArray, i);
+    }
+
+    void getValues(size_t start, size_t count, double* values) override
+    {
+      if(m_Converted)
       {
-        return static_cast<double>(m_Array->getValue(0));
+        ReadValues<double>(*m_Array, start, count, values);
       }
       else
       {
-        // ERROR: The array is empty!
-        return 0.0;
+        ReadValues<T>(*m_SourceArray, start, count, values);
       }
     }
 
+    size_t getNumberOfTuples() override
+    {
+      return m_Array->getNumberOfTuples();
+    }
+
+    int getNumberOfComponents() override
+    {
+      return m_Array->getNumberOfComponents();
+    }
+
+    QVector<size_t> getComponentDimensions() override
+    {
+      return m_Array->getComponentDimensions();
+    }
+
     ICalculatorArray::ValueType getType() override
     {
       return m_Type;
@@ -93,9 +119,9 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
           DoubleArrayType::Pointer newArray = DoubleArrayType::CreateArray(m_Array->getNumberOfTuples(), QVector<size_t>(1, 1), m_Array->getName(), allocate);
           if(allocate)
           {
-            for(int i = 0; i < m_Array->getNumberOfTuples(); i++)
+            for(size_t i = 0; i < m_Array->getNumberOfTuples(); i++)
             {
-              newArray->setComponent(i, 0, m_Array->getComponent(i, c));
+              newArray->setComponent(i, 0, m_Converted ? m_Array->getComponent(i, c) : static_cast<double>(m_SourceArray->getComponent(i, c)));
             }
           }
 
@@ -117,23 +143,75 @@ class SIMPLib_EXPORT CalculatorArray : public ICalculatorArray
   protected:
     CalculatorArray() = default;
 
+    /**
+     * @brief CalculatorArray The values are read straight from the typed source array. The double copy
+     * returned by getArray() is only filled in the first time something asks for it.
+     */
     CalculatorArray(typename DataArray<T>::Pointer dataArray, ValueType type, bool allocate) :
       ICalculatorArray(),
-      m_Type(type)
+      m_SourceArray(dataArray),
+      m_Type(type),
+      m_Allocate(allocate)
+    {
+      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), false);
+    }
+
+    /**
+     * @brief convertToDouble Fills the double copy of the source array
+     */
+    void convertToDouble()
     {
-      m_Array = DoubleArrayType::CreateArray(dataArray->getNumberOfTuples(), dataArray->getComponentDimensions(), dataArray->getName(), allocate);
-      if (allocate == true)
+      if(!m_Allocate || m_Converted)
       {
-        for (int i = 0; i < dataArray->getSize(); i++)
+        return;
+      }
+      m_Array->allocate();
+      double* dst = m_Array->getPointer(0);
+      const T* src = m_SourceArray->getConstPointer(0);
+      size_t size = m_SourceArray->getSize();
+      for(size_t i = 0; i < size; i++)
+      {
+        dst[i] = static_cast<double>(src[i]);
+      }
+      m_Converted = true;
+    }
+
+    template <typename K> static double ReadValue(DataArray<K>& array, size_t i)
+    {
+      if(array.getNumberOfTuples() > 1)
+      {
+        return static_cast<double>(array.getValue(i));
+      }
+      if(array.getNumberOfTuples() == 1)
+      {
+        return static_cast<double>(array.getValue(0));
+      }
+      // ERROR: The array is empty!
+      return 0.0;
+    }
+
+    template <typename K> static void ReadValues(DataArray<K>& array, size_t start, size_t count, double* values)
+    {
+      if(array.getNumberOfTuples() > 1)
+      {
+        const K* src = array.getConstPointer(start);
+        for(size_t i = 0; i < count; i++)
         {
-          m_Array->setValue(i, static_cast<double>(dataArray->getValue(i)));
+          values[i] = static_cast<double>(src[i]);
         }
       }
+      else
+      {
+        std::fill(values, values + count, ReadValue<K>(array, 0));
+      }
     }
 
   private:
+    typename DataArray<T>::Pointer                            m_SourceArray;
     DoubleArrayType::Pointer                                  m_Array;
     ValueType                                                 m_Type;
+    bool                                                      m_Allocate = false;
+    bool                                                      m_Converted = false;
 
     CalculatorArray(const CalculatorArray&); // Copy Constructor Not Implemented
     void operator=(const CalculatorArray&);  // Move assignment Not Implemented
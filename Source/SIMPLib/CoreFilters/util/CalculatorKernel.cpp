@@ -0,0 +1,460 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "CalculatorKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+namespace
+{
+const double k_DegreesToRadians = M_PI / 180.0;
+const double k_RadiansToDegrees = 180.0 / M_PI;
+}
+
+/**
+ * @brief The EvaluateCalculatorKernelImpl class evaluates a range of the result of a compiled expression
+ */
+class EvaluateCalculatorKernelImpl
+{
+public:
+  EvaluateCalculatorKernelImpl(const CalculatorKernel* kernel, double* output, AbstractFilter* filter)
+  : m_Kernel(kernel)
+  , m_Output(output)
+  , m_Filter(filter)
+  {
+  }
+  virtual ~EvaluateCalculatorKernelImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<double> registers;
+    for(size_t blockStart = start; blockStart < end; blockStart += CalculatorKernel::BlockSize)
+    {
+      if(nullptr != m_Filter && m_Filter->getCancel())
+      {
+        return;
+      }
+      size_t blockEnd = std::min(end, blockStart + CalculatorKernel::BlockSize);
+      m_Kernel->evaluate(blockStart, blockEnd, m_Output, registers);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const CalculatorKernel* m_Kernel;
+  double* m_Output;
+  AbstractFilter* m_Filter;
+};
+
+const size_t CalculatorKernel::BlockSize;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorKernel::~CalculatorKernel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::IsBinary(CalculatorOperator::OpCode opCode)
+{
+  switch(opCode)
+  {
+  case CalculatorOperator::OpCode::Addition:
+  case CalculatorOperator::OpCode::Subtraction:
+  case CalculatorOperator::OpCode::Multiplication:
+  case CalculatorOperator::OpCode::Division:
+  case CalculatorOperator::OpCode::Pow:
+  case CalculatorOperator::OpCode::Root:
+  case CalculatorOperator::OpCode::Log:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CalculatorKernel::compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees)
+{
+  // The shape of each value on the stack follows the same rules as the CREATE_NEW_ARRAY_* macros
+  struct StackEntry
+  {
+    size_t numTuples;
+    QVector<size_t> cDims;
+    ICalculatorArray::ValueType type;
+  };
+
+  m_Program.clear();
+  m_StackDepth = 0;
+  m_UseDegrees = useDegrees;
+  m_ResultType = ICalculatorArray::Unknown;
+
+  std::vector<StackEntry> stack;
+  for(const CalculatorItem::Pointer& item : rpn)
+  {
+    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(item);
+    if(nullptr != calcArray)
+    {
+      stack.push_back({calcArray->getNumberOfTuples(), calcArray->getComponentDimensions(), calcArray->getType()});
+      m_Program.push_back({calcArray, CalculatorOperator::OpCode::Unknown});
+      m_StackDepth = std::max(m_StackDepth, stack.size());
+      continue;
+    }
+
+    CalculatorOperator::Pointer calcOperator = std::dynamic_pointer_cast<CalculatorOperator>(item);
+    if(nullptr == calcOperator || calcOperator->getOpCode() == CalculatorOperator::OpCode::Unknown)
+    {
+      m_Program.clear();
+      return false;
+    }
+
+    if(IsBinary(calcOperator->getOpCode()))
+    {
+      if(stack.size() < 2)
+      {
+        m_Program.clear();
+        return false;
+      }
+      StackEntry array1 = stack.back();
+      stack.pop_back();
+      StackEntry array2 = stack.back();
+      stack.pop_back();
+
+      StackEntry result = (array1.type == ICalculatorArray::Array) ? array1 : array2;
+      result.type = (array1.type == ICalculatorArray::Array || array2.type == ICalculatorArray::Array) ? ICalculatorArray::Array : ICalculatorArray::Number;
+      stack.push_back(result);
+    }
+    else if(stack.empty())
+    {
+      m_Program.clear();
+      return false;
+    }
+
+    m_Program.push_back({ICalculatorArray::NullPointer(), calcOperator->getOpCode()});
+  }
+
+  if(stack.size() != 1)
+  {
+    m_Program.clear();
+    return false;
+  }
+
+  m_NumTuples = stack.back().numTuples;
+  m_ComponentDims = stack.back().cDims;
+  m_ResultType = stack.back().type;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ICalculatorArray::ValueType CalculatorKernel::getResultType()
+{
+  return m_ResultType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DoubleArrayType::Pointer CalculatorKernel::execute(const QString& name, AbstractFilter* filter)
+{
+  if(m_Program.empty())
+  {
+    return DoubleArrayType::NullPointer();
+  }
+
+  DoubleArrayType::Pointer output = DoubleArrayType::CreateArray(m_NumTuples, m_ComponentDims, name);
+  size_t totalValues = output->getSize();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  EvaluateCalculatorKernelImpl impl(this, output->getPointer(0), filter);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalValues, BlockSize), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, totalValues);
+  }
+
+  if(nullptr != filter && filter->getCancel())
+  {
+    return DoubleArrayType::NullPointer();
+  }
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorKernel::evaluate(size_t start, size_t end, double* output, std::vector<double>& registers) const
+{
+  registers.resize(m_StackDepth * BlockSize);
+
+  for(size_t blockStart = start; blockStart < end; blockStart += BlockSize)
+  {
+    size_t count = std::min(BlockSize, end - blockStart);
+    size_t top = 0;
+    for(const Instruction& instruction : m_Program)
+    {
+      if(nullptr != instruction.input)
+      {
+        instruction.input->getValues(blockStart, count, registers.data() + top * BlockSize);
+        top++;
+      }
+      else if(IsBinary(instruction.opCode))
+      {
+        // The deeper value is the left operand, e.g. "a - b" is stored in RPN as "a b -"
+        applyBinary(instruction.opCode, registers.data() + (top - 2) * BlockSize, registers.data() + (top - 1) * BlockSize, count);
+        top--;
+      }
+      else
+      {
+        applyUnary(instruction.opCode, registers.data() + (top - 1) * BlockSize, count);
+      }
+    }
+    std::copy(registers.data(), registers.data() + count, output + blockStart);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorKernel::applyUnary(CalculatorOperator::OpCode opCode, double* values, size_t count) const
+{
+  // Each case is a plain loop over the block so the compiler can vectorize it
+  switch(opCode)
+  {
+  case CalculatorOperator::OpCode::Negative:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = -1 * values[i];
+    }
+    break;
+  case CalculatorOperator::OpCode::Abs:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = fabs(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Ceil:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = ceil(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Floor:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = floor(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Exp:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = exp(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Ln:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = log(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Log10:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = log10(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Sqrt:
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = sqrt(values[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Sin:
+  case CalculatorOperator::OpCode::Cos:
+  case CalculatorOperator::OpCode::Tan:
+    if(m_UseDegrees)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = values[i] * k_DegreesToRadians;
+      }
+    }
+    if(opCode == CalculatorOperator::OpCode::Sin)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = sin(values[i]);
+      }
+    }
+    else if(opCode == CalculatorOperator::OpCode::Cos)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = cos(values[i]);
+      }
+    }
+    else
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = tan(values[i]);
+      }
+    }
+    break;
+  case CalculatorOperator::OpCode::ASin:
+  case CalculatorOperator::OpCode::ACos:
+  case CalculatorOperator::OpCode::ATan:
+    if(opCode == CalculatorOperator::OpCode::ASin)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = asin(values[i]);
+      }
+    }
+    else if(opCode == CalculatorOperator::OpCode::ACos)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = acos(values[i]);
+      }
+    }
+    else
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = atan(values[i]);
+      }
+    }
+    if(m_UseDegrees)
+    {
+      for(size_t i = 0; i < count; i++)
+      {
+        values[i] = values[i] * k_RadiansToDegrees;
+      }
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorKernel::applyBinary(CalculatorOperator::OpCode opCode, double* left, const double* right, size_t count) const
+{
+  switch(opCode)
+  {
+  case CalculatorOperator::OpCode::Addition:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = left[i] + right[i];
+    }
+    break;
+  case CalculatorOperator::OpCode::Subtraction:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = left[i] - right[i];
+    }
+    break;
+  case CalculatorOperator::OpCode::Multiplication:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = left[i] * right[i];
+    }
+    break;
+  case CalculatorOperator::OpCode::Division:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = left[i] / right[i];
+    }
+    break;
+  case CalculatorOperator::OpCode::Pow:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = pow(left[i], right[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Root:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = (right[i] == 0) ? std::numeric_limits<double>::infinity() : pow(left[i], 1 / right[i]);
+    }
+    break;
+  case CalculatorOperator::OpCode::Log:
+    for(size_t i = 0; i < count; i++)
+    {
+      left[i] = log(right[i]) / log(left[i]);
+    }
+    break;
+  default:
+    break;
+  }
+}
@@ -0,0 +1,135 @@
+/* ============================================================================
+* Copyright (c) 2009-2015 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+#include "CalculatorOperator.h"
+#include "ICalculatorArray.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The CalculatorKernel class evaluates a complete RPN expression in a single pass over the data.
+ * The RPN is compiled once into a flat list of instructions that is then run over blocks of values small
+ * enough to stay in cache, so the intermediate result of each operator never needs an array the size of
+ * the input. The blocks are evaluated in parallel when TBB is available.
+ */
+class SIMPLib_EXPORT CalculatorKernel
+{
+  public:
+    SIMPL_SHARED_POINTERS(CalculatorKernel)
+    SIMPL_STATIC_NEW_MACRO(CalculatorKernel)
+
+    virtual ~CalculatorKernel();
+
+    /**
+     * @brief The number of values of each intermediate result held at once per thread
+     */
+    static const size_t BlockSize = 1024;
+
+    /**
+     * @brief compile Translates the RPN expression into the instruction list. Returns false when the expression
+     * contains an operator the kernel does not know or does not reduce to a single value; the caller should
+     * then evaluate the expression through CalculatorOperator::calculate() instead.
+     * @param rpn
+     * @param useDegrees
+     * @return
+     */
+    bool compile(const QVector<CalculatorItem::Pointer>& rpn, bool useDegrees);
+
+    /**
+     * @brief execute Evaluates the compiled expression into a new array
+     * @param name Name of the array that is created
+     * @param filter Optional filter that is polled for cancellation between blocks
+     * @return The result, or a null pointer if nothing has been compiled or the filter was canceled
+     */
+    DoubleArrayType::Pointer execute(const QString& name, AbstractFilter* filter = nullptr);
+
+    /**
+     * @brief getResultType Returns whether the compiled expression evaluates to an array or a single number
+     * @return
+     */
+    ICalculatorArray::ValueType getResultType();
+
+    /**
+     * @brief evaluate Evaluates the values in the range [start, end) of the result into output
+     * @param start
+     * @param end
+     * @param output
+     * @param registers Scratch space; resized as needed so it can be reused between calls
+     */
+    void evaluate(size_t start, size_t end, double* output, std::vector<double>& registers) const;
+
+  protected:
+    CalculatorKernel();
+
+    static bool IsBinary(CalculatorOperator::OpCode opCode);
+
+    void applyUnary(CalculatorOperator::OpCode opCode, double* values, size_t count) const;
+
+    void applyBinary(CalculatorOperator::OpCode opCode, double* left, const double* right, size_t count) const;
+
+  private:
+    /**
+     * @brief Either loads an input onto the stack (input is set) or applies an operator to the top of the stack
+     */
+    struct Instruction
+    {
+      ICalculatorArray::Pointer input;
+      CalculatorOperator::OpCode opCode;
+    };
+
+    std::vector<Instruction>                        m_Program;
+    size_t                                          m_StackDepth = 0;
+    bool                                            m_UseDegrees = false;
+    size_t                                          m_NumTuples = 0;
+    QVector<size_t>                                 m_ComponentDims;
+    ICalculatorArray::ValueType                     m_ResultType = ICalculatorArray::Unknown;
+
+  public:
+    CalculatorKernel(const CalculatorKernel&) = delete; // Copy Constructor Not Implemented
+    CalculatorKernel(CalculatorKernel&&) = delete;      // Move Constructor Not Implemented
+    CalculatorKernel& operator=(const CalculatorKernel&) = delete; // Copy Assignment Not Implemented
+    CalculatorKernel& operator=(CalculatorKernel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -42,6 +42,7 @@
 // -----------------------------------------------------------------------------
 CalculatorOperator::CalculatorOperator()
 : m_Precedence(Unknown_Precedence)
+, m_OpCode(OpCode::Unknown)
 {
 }
 
@@ -90,6 +91,22 @@ void CalculatorOperator::setOperatorType(OperatorType type)
   m_OperatorType = type;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CalculatorOperator::OpCode CalculatorOperator::getOpCode()
+{
+  return m_OpCode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CalculatorOperator::setOpCode(OpCode opCode)
+{
+  m_OpCode = opCode;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
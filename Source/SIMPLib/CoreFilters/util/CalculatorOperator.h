@@ -55,6 +55,36 @@ class SIMPLib_EXPORT CalculatorOperator : public CalculatorItem
       Binary
     };
 
+    /**
+     * @brief The OpCode enum identifies the math performed by each concrete operator so that
+     * an expression can be evaluated without going through calculate() one operator at a time.
+     */
+    enum class OpCode
+    {
+      Unknown,
+      Addition,
+      Subtraction,
+      Multiplication,
+      Division,
+      Pow,
+      Root,
+      Log,
+      Negative,
+      Abs,
+      Ceil,
+      Floor,
+      Exp,
+      Ln,
+      Log10,
+      Sqrt,
+      Sin,
+      Cos,
+      Tan,
+      ASin,
+      ACos,
+      ATan
+    };
+
     SIMPL_SHARED_POINTERS(CalculatorOperator)
 
     static double toDegrees(double radians);
@@ -68,6 +98,8 @@ class SIMPLib_EXPORT CalculatorOperator : public CalculatorItem
 
     OperatorType getOperatorType();
 
+    OpCode getOpCode();
+
   protected:
     CalculatorOperator();
 
@@ -88,9 +120,12 @@ class SIMPLib_EXPORT CalculatorOperator : public CalculatorItem
 
     void setOperatorType(OperatorType type);
 
+    void setOpCode(OpCode opCode);
+
   private:
     Precedence                                      m_Precedence;
     OperatorType                                    m_OperatorType;
+    OpCode                                          m_OpCode;
 
   public:
     CalculatorOperator(const CalculatorOperator&) = delete; // Copy Constructor Not Implemented
@@ -117,12 +152,12 @@ class SIMPLib_EXPORT CalculatorOperator : public CalculatorItem
       newArray = DoubleArrayType::CreateArray(array2->getArray()->getNumberOfTuples(), array2->getArray()->getComponentDimensions(), calculatedArrayPath.getDataArrayName());                          \
     }                                                                                                                                                                                                  \
                                                                                                                                                                                                        \
-    int numComps = newArray->getNumberOfComponents();                                                                                                                                                  \
-    for(int i = 0; i < static_cast<int>(newArray->getNumberOfTuples()); i++)                                                                                                                           \
+    size_t numComps = newArray->getNumberOfComponents();                                                                                                                                               \
+    for(size_t i = 0; i < newArray->getNumberOfTuples(); i++)                                                                                                                                         \
     {                                                                                                                                                                                                  \
-      for(int c = 0; c < newArray->getNumberOfComponents(); c++)                                                                                                                                       \
+      for(size_t c = 0; c < numComps; c++)                                                                                                                                                             \
       {                                                                                                                                                                                                \
-        int index = numComps * i + c;                                                                                                                                                                  \
+        size_t index = numComps * i + c;                                                                                                                                                                  \
         double num1 = array1->getValue(index);                                                                                                                                                         \
         double num2 = array2->getValue(index);                                                                                                                                                         \
         newArray->setValue(index, func(num2, num1));                                                                                                                                                   \
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 CeilOperator::CeilOperator()
 {
+  setOpCode(OpCode::Ceil);
   setNumberOfArguments(1);
   setInfixToken("ceil");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 CosOperator::CosOperator()
 {
+  setOpCode(OpCode::Cos);
   setNumberOfArguments(1);
   setInfixToken("cos");
 }
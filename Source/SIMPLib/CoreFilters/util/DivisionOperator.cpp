@@ -49,6 +49,7 @@
 // -----------------------------------------------------------------------------
 DivisionOperator::DivisionOperator()
 {
+  setOpCode(OpCode::Division);
   setPrecedence(B_Precedence);
   setInfixToken("/");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 ExpOperator::ExpOperator()
 {
+  setOpCode(OpCode::Exp);
   setNumberOfArguments(1);
   setInfixToken("exp");
 }
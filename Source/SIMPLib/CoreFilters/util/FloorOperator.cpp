@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 FloorOperator::FloorOperator()
 {
+  setOpCode(OpCode::Floor);
   setNumberOfArguments(1);
   setInfixToken("floor");
 }
@@ -57,10 +57,23 @@ class SIMPLib_EXPORT ICalculatorArray : public CalculatorItem
     ~ICalculatorArray() override;
 
     virtual IDataArray::Pointer getArray() = 0;
-    virtual double getValue(int i) = 0;
-    virtual void setValue(int i, double value) = 0;
+    virtual double getValue(size_t i) = 0;
+    virtual void setValue(size_t i, double value) = 0;
     virtual ValueType getType() = 0;
 
+    virtual size_t getNumberOfTuples() = 0;
+    virtual int getNumberOfComponents() = 0;
+    virtual QVector<size_t> getComponentDimensions() = 0;
+
+    /**
+     * @brief getValues Copies count values starting at index start into values, following the same
+     * rules as getValue(): an array with a single tuple returns its first value for every index.
+     * @param start
+     * @param count
+     * @param values
+     */
+    virtual void getValues(size_t start, size_t count, double* values) = 0;
+
     virtual DoubleArrayType::Pointer reduceToOneComponent(int c, bool allocate = true) = 0;
 
   protected:
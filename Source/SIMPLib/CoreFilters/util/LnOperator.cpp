@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 LnOperator::LnOperator()
 {
+  setOpCode(OpCode::Ln);
   setNumberOfArguments(1);
   setInfixToken("ln");
 }
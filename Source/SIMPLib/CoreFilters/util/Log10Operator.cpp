@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 Log10Operator::Log10Operator()
 {
+  setOpCode(OpCode::Log10);
   setNumberOfArguments(1);
   setInfixToken("log10");
 }
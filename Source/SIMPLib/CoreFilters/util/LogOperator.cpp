@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 LogOperator::LogOperator()
 {
+  setOpCode(OpCode::Log);
   setNumberOfArguments(2);
   setInfixToken("log");
 }
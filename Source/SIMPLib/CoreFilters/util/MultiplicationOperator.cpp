@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 MultiplicationOperator::MultiplicationOperator()
 {
+  setOpCode(OpCode::Multiplication);
   setPrecedence(B_Precedence);
   setInfixToken("*");
 }
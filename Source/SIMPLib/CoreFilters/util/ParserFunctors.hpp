@@ -30,6 +30,11 @@
 
 #pragma once
 
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 
@@ -41,6 +46,198 @@ const QString ValueOutOfRange = "Value is out of range for the specified data ty
 const QString CouldNotConvert = "Value could not be converted to the specified data type.";
 }
 
+/**
+ * @brief The CharSpanParsing namespace holds allocation free conversions that work directly on a
+ * [begin, end) span of characters in the style of std::from_chars. They only accept the plain forms
+ * that make up almost every value in a delimited text file and return false for anything else so the
+ * caller can fall back to the QString conversion, which keeps the results identical to it.
+ */
+namespace CharSpanParsing
+{
+/**
+ * @brief Parses an optionally signed decimal integer
+ * @param begin
+ * @param end
+ * @param value
+ * @param allowLeadingZeros When false, values such as "010" are rejected because they would be octal for a base 0 conversion
+ * @return
+ */
+inline bool ParseInteger(const char* begin, const char* end, int64_t& value, bool allowLeadingZeros = true)
+{
+  const char* p = begin;
+  bool negative = false;
+  if(p != end && *p == '-')
+  {
+    negative = true;
+    ++p;
+  }
+  if(p == end || (!allowLeadingZeros && *p == '0' && end - p > 1))
+  {
+    return false;
+  }
+
+  // Accumulate as a negative number so that the minimum value of int64_t is representable
+  int64_t result = 0;
+  const int64_t limit = std::numeric_limits<int64_t>::min();
+  for(; p != end; ++p)
+  {
+    if(*p < '0' || *p > '9')
+    {
+      return false;
+    }
+    int64_t digit = *p - '0';
+    if(result < (limit + digit) / 10)
+    {
+      return false;
+    }
+    result = result * 10 - digit;
+  }
+  if(!negative)
+  {
+    if(result == limit)
+    {
+      return false;
+    }
+    result = -result;
+  }
+  value = result;
+  return true;
+}
+
+/**
+ * @brief Parses an unsigned decimal integer
+ * @param begin
+ * @param end
+ * @param value
+ * @return
+ */
+inline bool ParseUnsigned(const char* begin, const char* end, uint64_t& value)
+{
+  if(begin == end)
+  {
+    return false;
+  }
+  uint64_t result = 0;
+  const uint64_t limit = std::numeric_limits<uint64_t>::max();
+  for(const char* p = begin; p != end; ++p)
+  {
+    if(*p < '0' || *p > '9')
+    {
+      return false;
+    }
+    uint64_t digit = static_cast<uint64_t>(*p - '0');
+    if(result > (limit - digit) / 10)
+    {
+      return false;
+    }
+    result = result * 10 + digit;
+  }
+  value = result;
+  return true;
+}
+
+/**
+ * @brief Parses a decimal floating point value such as "-12.5" or "3.1e-4". Only values whose digits
+ * fit exactly in a double and whose decimal exponent is at most 22 in magnitude are accepted; for those
+ * a single multiplication or division by an exact power of ten is correctly rounded, so the result
+ * matches a full conversion bit for bit.
+ * @param begin
+ * @param end
+ * @param value
+ * @return
+ */
+inline bool ParseDouble(const char* begin, const char* end, double& value)
+{
+  static const double k_PowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const uint64_t k_MaxExactMantissa = uint64_t(1) << 53;
+  const int k_MaxExactExponent = 22;
+
+  const char* p = begin;
+  bool negative = false;
+  if(p != end && (*p == '-' || *p == '+'))
+  {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  bool foundDigit = false;
+  for(; p != end && *p >= '0' && *p <= '9'; ++p)
+  {
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+    if(mantissa > k_MaxExactMantissa)
+    {
+      return false;
+    }
+    foundDigit = true;
+  }
+  if(p != end && *p == '.')
+  {
+    for(++p; p != end && *p >= '0' && *p <= '9'; ++p)
+    {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+      if(mantissa > k_MaxExactMantissa)
+      {
+        return false;
+      }
+      exponent--;
+      foundDigit = true;
+    }
+  }
+  if(!foundDigit)
+  {
+    return false;
+  }
+
+  if(p != end && (*p == 'e' || *p == 'E'))
+  {
+    ++p;
+    bool negativeExponent = false;
+    if(p != end && (*p == '-' || *p == '+'))
+    {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+    if(p == end)
+    {
+      return false;
+    }
+    int explicitExponent = 0;
+    for(; p != end; ++p)
+    {
+      if(*p < '0' || *p > '9' || explicitExponent > 1000)
+      {
+        return false;
+      }
+      explicitExponent = explicitExponent * 10 + (*p - '0');
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+  if(p != end || exponent < -k_MaxExactExponent || exponent > k_MaxExactExponent)
+  {
+    return false;
+  }
+
+  double result = static_cast<double>(mantissa);
+  result = (exponent < 0) ? result / k_PowersOfTen[-exponent] : result * k_PowersOfTen[exponent];
+  value = negative ? -result : result;
+  return true;
+}
+
+/**
+ * @brief Converts a span to a QString for the fallback conversions
+ * @param begin
+ * @param end
+ * @return
+ */
+inline QString ToQString(const char* begin, const char* end)
+{
+  return QString::fromUtf8(begin, static_cast<int>(end - begin));
+}
+} // namespace CharSpanParsing
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -94,6 +291,17 @@ public:
     }
     return value;
   }
+
+  int8_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    int64_t value = 0;
+    if(CharSpanParsing::ParseInteger(begin, end, value, false) && value <= std::numeric_limits<int8_t>::max() && value >= std::numeric_limits<int8_t>::min())
+    {
+      obj.ok = true;
+      return static_cast<int8_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -136,6 +344,17 @@ public:
     }
     return value;
   }
+
+  uint8_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    uint64_t value = 0;
+    if(CharSpanParsing::ParseUnsigned(begin, end, value) && value <= std::numeric_limits<uint8_t>::max())
+    {
+      obj.ok = true;
+      return static_cast<uint8_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -176,6 +395,17 @@ public:
     }
     return value;
   }
+
+  int16_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    int64_t value = 0;
+    if(CharSpanParsing::ParseInteger(begin, end, value) && value <= std::numeric_limits<int16_t>::max() && value >= std::numeric_limits<int16_t>::min())
+    {
+      obj.ok = true;
+      return static_cast<int16_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -224,6 +454,17 @@ public:
     }
     return value;
   }
+
+  uint16_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    uint64_t value = 0;
+    if(CharSpanParsing::ParseUnsigned(begin, end, value) && value <= std::numeric_limits<uint16_t>::max())
+    {
+      obj.ok = true;
+      return static_cast<uint16_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -264,6 +505,17 @@ public:
     }
     return value;
   }
+
+  int32_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    int64_t value = 0;
+    if(CharSpanParsing::ParseInteger(begin, end, value) && value <= std::numeric_limits<int32_t>::max() && value >= std::numeric_limits<int32_t>::min())
+    {
+      obj.ok = true;
+      return static_cast<int32_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -312,6 +564,17 @@ public:
     }
     return value;
   }
+
+  uint32_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    uint64_t value = 0;
+    if(CharSpanParsing::ParseUnsigned(begin, end, value) && value <= std::numeric_limits<uint32_t>::max())
+    {
+      obj.ok = true;
+      return static_cast<uint32_t>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -346,6 +609,17 @@ public:
     }
     return value;
   }
+
+  int64_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    int64_t value = 0;
+    if(CharSpanParsing::ParseInteger(begin, end, value))
+    {
+      obj.ok = true;
+      return value;
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -384,6 +658,17 @@ public:
     }
     return value;
   }
+
+  uint64_t operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    uint64_t value = 0;
+    if(CharSpanParsing::ParseUnsigned(begin, end, value))
+    {
+      obj.ok = true;
+      return value;
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -399,6 +684,18 @@ public:
     float value = token.toFloat(&obj.ok);
     return value;
   }
+
+  float operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    double value = 0.0;
+    // Values that would overflow or underflow a float go through QString so they are reported the same way
+    if(CharSpanParsing::ParseDouble(begin, end, value) && std::fabs(value) <= FLT_MAX && (value == 0.0 || std::fabs(value) >= FLT_MIN))
+    {
+      obj.ok = true;
+      return static_cast<float>(value);
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -414,6 +711,17 @@ public:
     double value = token.toDouble(&obj.ok);
     return value;
   }
+
+  double operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    double value = 0.0;
+    if(CharSpanParsing::ParseDouble(begin, end, value))
+    {
+      obj.ok = true;
+      return value;
+    }
+    return (*this)(CharSpanParsing::ToQString(begin, end), obj);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -428,5 +736,10 @@ public:
   {
     return token;
   }
+
+  QString operator()(const char* begin, const char* end, ErrorObject& obj)
+  {
+    return CharSpanParsing::ToQString(begin, end);
+  }
 };
 
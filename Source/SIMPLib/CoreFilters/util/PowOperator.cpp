@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 PowOperator::PowOperator()
 {
+  setOpCode(OpCode::Pow);
   setPrecedence(C_Precedence);
   setInfixToken("^");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 RootOperator::RootOperator()
 {
+  setOpCode(OpCode::Root);
   setNumberOfArguments(2);
   setInfixToken("root");
 }
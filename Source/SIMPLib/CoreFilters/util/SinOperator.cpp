@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 SinOperator::SinOperator()
 {
+  setOpCode(OpCode::Sin);
   setNumberOfArguments(1);
   setInfixToken("sin");
 }
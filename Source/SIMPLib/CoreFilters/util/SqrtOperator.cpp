@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 SqrtOperator::SqrtOperator()
 {
+  setOpCode(OpCode::Sqrt);
   setNumberOfArguments(1);
   setInfixToken("sqrt");
 }
@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 SubtractionOperator::SubtractionOperator()
 {
+  setOpCode(OpCode::Subtraction);
   setPrecedence(A_Precedence);
   setInfixToken("-");
 }
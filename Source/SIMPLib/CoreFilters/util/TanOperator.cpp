@@ -46,6 +46,7 @@
 // -----------------------------------------------------------------------------
 TanOperator::TanOperator()
 {
+  setOpCode(OpCode::Tan);
   setNumberOfArguments(1);
   setInfixToken("tan");
 }
@@ -0,0 +1,1022 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QLocale>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+
+/**
+ * @class CSRNeighborList CSRNeighborList.hpp SIMPLib/DataArrays/CSRNeighborList.hpp
+ * @brief A NeighborList that stores all of its lists in compressed sparse row (CSR) form: a single
+ * values array holding every list back to back and an offsets array where the entries of list i are
+ * values[offsets[i]] .. values[offsets[i+1]-1]. Compared to NeighborList<T> there is no per-list heap
+ * allocation and the data is already laid out the way it is stored in the HDF5 file (the
+ * "NumNeighbors" array plus one flat dataset) so reading and writing does not copy anything.
+ *
+ * Entries added with addEntry() are buffered and merged into the CSR arrays the next time the lists
+ * are accessed, so building the lists in any order is linear in the number of entries. Replacing a
+ * single list with setList() has to move all the following values and should be avoided in loops.
+ *
+ * The class writes the same on-disk layout and ObjectType as NeighborList<T> so files written from
+ * either class can be read by the other.
+ */
+template<typename T>
+class CSRNeighborList : public IDataArray
+{
+  public:
+    SIMPL_SHARED_POINTERS(CSRNeighborList<T>)
+    SIMPL_TYPE_MACRO_SUPER(CSRNeighborList<T>, IDataArray)
+    SIMPL_CLASS_VERSION(2)
+
+    SIMPL_INSTANCE_STRING_PROPERTY(NumNeighborsArrayName)
+
+    using VectorType = std::vector<T>;
+    using SharedVectorType = std::shared_ptr<VectorType>;
+
+    /**
+     * @brief The ListView class refers to the values of one list in place. Like the pointer returned by
+     * getListPointer() it is invalidated by any call that changes the size of a list.
+     */
+    class ListView
+    {
+      public:
+        ListView(T* data, size_t size)
+        : m_Data(data)
+        , m_Size(size)
+        {
+        }
+
+        T* begin() const { return m_Data; }
+        T* end() const { return m_Data + m_Size; }
+        size_t size() const { return m_Size; }
+        bool empty() const { return m_Size == 0; }
+        T& operator[](size_t i) const { return m_Data[i]; }
+
+      private:
+        T* m_Data;
+        size_t m_Size;
+    };
+
+    static Pointer New()
+    {
+      return CreateArray(0, "NeighborList", false);
+    }
+
+    /**
+     * @brief CreateArray
+     * @param numTuples
+     * @param name
+     * @param allocate
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true)
+    {
+      if(name.isEmpty())
+      {
+        return NullPointer();
+      }
+      Pointer ptr = Pointer(new CSRNeighborList<T>(numTuples, name));
+      if(allocate)
+      {
+        ptr->resize(numTuples);
+      }
+      return ptr;
+    }
+
+    /**
+     * @brief CreateArray
+     * @param numTuples
+     * @param cDims
+     * @param name
+     * @param allocate
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, QVector<size_t> cDims, const QString& name, bool allocate = true)
+    {
+      size_t numElements = numTuples;
+      for(const auto& dim : cDims)
+      {
+        numElements *= dim;
+      }
+      return CreateArray(numElements, name, allocate);
+    }
+
+    /**
+     * @brief FromNeighborList Creates a CSR copy of an existing NeighborList
+     * @param list
+     * @return
+     */
+    static Pointer FromNeighborList(NeighborList<T>& list)
+    {
+      Pointer ptr = CreateArray(list.getNumberOfTuples(), list.getName(), true);
+      if(nullptr == ptr)
+      {
+        return ptr;
+      }
+      ptr->setNumNeighborsArrayName(list.getNumNeighborsArrayName());
+      size_t numLists = std::min(list.getNumberOfTuples(), static_cast<size_t>(list.getNumberOfLists()));
+      size_t total = 0;
+      for(size_t i = 0; i < numLists; i++)
+      {
+        total += list.getListSize(static_cast<int>(i));
+      }
+      ptr->m_Values.reserve(total);
+      for(size_t i = 0; i < numLists; i++)
+      {
+        const VectorType& src = list.getListReference(static_cast<int>(i));
+        ptr->m_Values.insert(ptr->m_Values.end(), src.begin(), src.end());
+        ptr->m_Offsets[i + 1] = ptr->m_Values.size();
+      }
+      for(size_t i = numLists + 1; i < ptr->m_Offsets.size(); i++)
+      {
+        ptr->m_Offsets[i] = ptr->m_Values.size();
+      }
+      return ptr;
+    }
+
+    /**
+     * @brief toNeighborList Creates a NeighborList<T> copy of this array for code that needs
+     * the shared list interface.
+     * @return
+     */
+    typename NeighborList<T>::Pointer toNeighborList()
+    {
+      compact();
+      typename NeighborList<T>::Pointer list = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), true);
+      list->setNumNeighborsArrayName(getNumNeighborsArrayName());
+      for(size_t i = 0; i < getNumberOfTuples(); i++)
+      {
+        typename NeighborList<T>::SharedVectorType vec(new VectorType(m_Values.begin() + m_Offsets[i], m_Values.begin() + m_Offsets[i + 1]));
+        list->setList(static_cast<int>(i), vec);
+      }
+      return list;
+    }
+
+    /**
+     * @brief createNewArray
+     * @param numElements
+     * @param rank
+     * @param dims
+     * @param name
+     * @return
+     */
+    IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true) override
+    {
+      QVector<size_t> cDims(rank);
+      for(int i = 0; i < rank; i++)
+      {
+        cDims[i] = dims[i];
+      }
+      return CSRNeighborList<T>::CreateArray(numElements, cDims, name, allocate);
+    }
+
+    /**
+     * @brief createNewArray
+     * @param numElements
+     * @param dims
+     * @param name
+     * @return
+     */
+    IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true) override
+    {
+      return CSRNeighborList<T>::CreateArray(numElements, QVector<size_t>::fromStdVector(dims), name, allocate);
+    }
+
+    /**
+     * @brief createNewArray
+     * @param numElements
+     * @param dims
+     * @param name
+     * @return
+     */
+    IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true) override
+    {
+      return CSRNeighborList<T>::CreateArray(numElements, dims, name, allocate);
+    }
+
+    ~CSRNeighborList() override = default;
+
+    /**
+     * @brief isAllocated
+     * @return
+     */
+    bool isAllocated() override { return true; }
+
+    /**
+     * @brief getXdmfTypeAndSize
+     * @param xdmfTypeName
+     * @param precision
+     */
+    void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision) override
+    {
+      NeighborList<T>::New()->getXdmfTypeAndSize(xdmfTypeName, precision);
+    }
+
+    /**
+     * @brief getTypeAsString
+     * @return
+     */
+    QString getTypeAsString() override { return NeighborList<T>::ClassName(); }
+
+    /**
+     * @brief setName
+     * @param name
+     */
+    void setName(const QString& name) override { m_Name = name; }
+
+    /**
+     * @brief getName
+     * @return
+     */
+    QString getName() override { return m_Name; }
+
+    /**
+     * @brief takeOwnership
+     */
+    void takeOwnership() override {}
+
+    /**
+     * @brief releaseOwnership
+     */
+    void releaseOwnership() override {}
+
+    /**
+     * @brief getVoidPointer
+     * @param i
+     * @return
+     */
+    void* getVoidPointer(size_t i) override { return nullptr; }
+
+    /**
+     * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
+     * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
+     * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
+     * returned from the program.
+     * @param idxs The indices to remove
+     * @return error code.
+     */
+    int eraseTuples(QVector<size_t>& idxs) override
+    {
+      if(idxs.empty())
+      {
+        return 0;
+      }
+      compact();
+      size_t numLists = getNumberOfTuples();
+      if(static_cast<size_t>(idxs.size()) >= numLists)
+      {
+        resize(0);
+        return 0;
+      }
+      std::vector<bool> remove(numLists, false);
+      for(const auto& idx : idxs)
+      {
+        if(idx >= numLists)
+        {
+          return -100;
+        }
+        remove[idx] = true;
+      }
+
+      // Slide the kept lists down in place so no second copy of the values is needed
+      size_t writeList = 0;
+      size_t writeValue = 0;
+      for(size_t i = 0; i < numLists; i++)
+      {
+        if(remove[i])
+        {
+          continue;
+        }
+        size_t start = m_Offsets[i];
+        size_t end = m_Offsets[i + 1];
+        if(writeValue != start)
+        {
+          std::copy(m_Values.begin() + start, m_Values.begin() + end, m_Values.begin() + writeValue);
+        }
+        m_Offsets[writeList] = writeValue;
+        writeValue += end - start;
+        writeList++;
+      }
+      m_Offsets[writeList] = writeValue;
+      m_Offsets.resize(writeList + 1);
+      m_Values.resize(writeValue);
+      m_NumTuples = writeList;
+      return 0;
+    }
+
+    /**
+     * @brief copyTuple
+     * @param currentPos
+     * @param newPos
+     * @return
+     */
+    int copyTuple(size_t currentPos, size_t newPos) override
+    {
+      compact();
+      if(currentPos >= getNumberOfTuples() || newPos >= getNumberOfTuples())
+      {
+        return -1;
+      }
+      VectorType copy = copyOfList(static_cast<int>(currentPos));
+      setList(static_cast<int>(newPos), copy);
+      return 0;
+    }
+
+    // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+    // This is required so that other classes can call this version of copyData from the subclasses.
+    using IDataArray::copyFromArray;
+
+    /**
+     * @brief copyFromArray Copies totalSrcTuples lists starting at srcTupleOffset from the sourceArray, which can
+     * be either a CSRNeighborList<T> or a NeighborList<T>, into this array starting at destTupleOffset.
+     * @param destTupleOffset
+     * @param sourceArray
+     * @param srcTupleOffset
+     * @param totalSrcTuples
+     * @return
+     */
+    bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
+    {
+      if(nullptr == sourceArray || destTupleOffset >= getNumberOfTuples())
+      {
+        return false;
+      }
+      if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples())
+      {
+        return false;
+      }
+      if(destTupleOffset + totalSrcTuples > getNumberOfTuples())
+      {
+        return false;
+      }
+      Self* csrSource = dynamic_cast<Self*>(sourceArray.get());
+      NeighborList<T>* source = dynamic_cast<NeighborList<T>*>(sourceArray.get());
+      if(nullptr == csrSource && nullptr == source)
+      {
+        return false;
+      }
+      compact();
+
+      // The values are rebuilt in one pass: the lists before the destination range, the copied lists,
+      // then the lists after it. This array is left untouched until the end, so it may be its own source.
+      size_t destStart = m_Offsets[destTupleOffset];
+      size_t destEnd = m_Offsets[destTupleOffset + totalSrcTuples];
+      std::vector<T> newValues;
+      newValues.reserve(m_Values.size() - (destEnd - destStart) + sourceArray->getSize());
+      newValues.insert(newValues.end(), m_Values.begin(), m_Values.begin() + destStart);
+      std::vector<size_t> listEnds(totalSrcTuples);
+      for(size_t i = 0; i < totalSrcTuples; i++)
+      {
+        int srcIdx = static_cast<int>(srcTupleOffset + i);
+        if(nullptr != csrSource)
+        {
+          ListView list = csrSource->getList(srcIdx);
+          newValues.insert(newValues.end(), list.begin(), list.end());
+        }
+        else
+        {
+          const VectorType& list = source->getListReference(srcIdx);
+          newValues.insert(newValues.end(), list.begin(), list.end());
+        }
+        listEnds[i] = newValues.size();
+      }
+      size_t newEnd = newValues.size();
+      newValues.insert(newValues.end(), m_Values.begin() + destEnd, m_Values.end());
+
+      for(size_t i = 0; i < totalSrcTuples; i++)
+      {
+        m_Offsets[destTupleOffset + i + 1] = listEnds[i];
+      }
+      for(size_t i = destTupleOffset + totalSrcTuples + 1; i < m_Offsets.size(); i++)
+      {
+        m_Offsets[i] = m_Offsets[i] - destEnd + newEnd;
+      }
+      m_Values.swap(newValues);
+      return true;
+    }
+
+    /**
+     * @brief initializeTuple
+     * @param i
+     * @param p
+     */
+    void initializeTuple(size_t i, void* p) override
+    {
+      Q_UNUSED(i);
+      Q_UNUSED(p);
+      Q_ASSERT(false);
+    }
+
+    /**
+     * @brief Returns the number of lists
+     */
+    size_t getNumberOfTuples() override
+    {
+      return m_NumTuples;
+    }
+
+    /**
+     * @brief getSize Returns the total number of values stored in all the lists
+     * @return
+     */
+    size_t getSize() override
+    {
+      return m_Values.size() + m_PendingValues.size();
+    }
+
+    /**
+     * @brief getNumberOfComponents
+     * @return
+     */
+    int getNumberOfComponents() override { return 1; }
+
+    /**
+     * @brief getComponentDimensions
+     * @return
+     */
+    QVector<size_t> getComponentDimensions() override
+    {
+      QVector<size_t> dims(1, 1);
+      return dims;
+    }
+
+    /**
+     * @brief getTypeSize
+     * @return
+     */
+    size_t getTypeSize() override { return sizeof(T); }
+
+    /**
+     * @brief initializeWithZeros Empties every list
+     */
+    void initializeWithZeros() override
+    {
+      m_PendingIds.clear();
+      m_PendingValues.clear();
+      m_Values.clear();
+      std::fill(m_Offsets.begin(), m_Offsets.end(), 0);
+    }
+
+    /**
+     * @brief deepCopy
+     * @param forceNoAllocate
+     * @return
+     */
+    IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
+    {
+      compact();
+      Pointer copy = CreateArray(getNumberOfTuples(), getName(), true);
+      copy->setNumNeighborsArrayName(getNumNeighborsArrayName());
+      if(!forceNoAllocate)
+      {
+        copy->m_Offsets = m_Offsets;
+        copy->m_Values = m_Values;
+      }
+      return copy;
+    }
+
+    /**
+     * @brief resizeTotalElements Sets the number of lists. New lists are empty.
+     * @param size
+     * @return
+     */
+    int32_t resizeTotalElements(size_t size) override
+    {
+      compact();
+      if(size < getNumberOfTuples())
+      {
+        m_Values.resize(m_Offsets[size]);
+      }
+      m_Offsets.resize(size + 1, m_Values.size());
+      m_NumTuples = size;
+      return 1;
+    }
+
+    /**
+     * @brief Resize
+     * @param numTuples
+     * @return
+     */
+    int32_t resize(size_t numTuples) override { return resizeTotalElements(numTuples); }
+
+    /**
+     * @brief printTuple
+     * @param out
+     * @param i
+     * @param delimiter
+     */
+    void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
+    {
+      compact();
+      size_t size = m_Offsets[i + 1] - m_Offsets[i];
+      out << size;
+      for(size_t j = m_Offsets[i]; j < m_Offsets[i + 1]; j++)
+      {
+        out << delimiter << m_Values[j];
+      }
+    }
+
+    /**
+     * @brief printComponent
+     * @param out
+     * @param i
+     * @param j
+     */
+    void printComponent(QTextStream& out, size_t i, int j) override
+    {
+      Q_ASSERT(false);
+    }
+
+    /**
+     * @brief writeH5Data
+     * @param parentId
+     * @param tDims
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
+    {
+      return writeH5Data(parentId, tDims, H5DatasetCompression());
+    }
+
+    /**
+     * @brief writeH5Data Writes the NumNeighbors array, computed from the offsets, and the values
+     * array directly into the same layout that NeighborList<T> uses.
+     * @param parentId
+     * @param tDims
+     * @param compression
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression) override
+    {
+      compact();
+      int err = 0;
+      size_t numLists = getNumberOfTuples();
+      Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(numLists, m_NumNeighborsArrayName);
+      int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
+      for(size_t i = 0; i < numLists; i++)
+      {
+        numNeighbors[i] = static_cast<int32_t>(m_Offsets[i + 1] - m_Offsets[i]);
+      }
+
+      // Only rewrite the NumNeighbors array if it is missing or different from what is in the file
+      bool rewrite = true;
+      if(QH5Lite::datasetExists(parentId, m_NumNeighborsArrayName))
+      {
+        std::vector<int32_t> fileNumNeigh;
+        err = QH5Lite::readVectorDataset(parentId, m_NumNeighborsArrayName, fileNumNeigh);
+        if(err < 0)
+        {
+          return -602;
+        }
+        rewrite = fileNumNeigh.size() != numLists || !std::equal(fileNumNeigh.begin(), fileNumNeigh.end(), numNeighbors);
+      }
+      if(rewrite)
+      {
+        err = numNeighborsPtr->writeH5Data(parentId, tDims, compression);
+        if(err < 0)
+        {
+          return err;
+        }
+      }
+
+      if(m_Values.empty())
+      {
+        return 0;
+      }
+
+      int32_t rank = 1;
+      hsize_t dims[1] = {m_Values.size()};
+      err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, m_Values.data(), compression);
+      if(err < 0)
+      {
+        return -605;
+      }
+      err = QH5Lite::writeScalarAttribute(parentId, getName(), SIMPL::HDF5::DataArrayVersion, getClassVersion());
+      if(err < 0)
+      {
+        return -604;
+      }
+      // Use the NeighborList<T> object type so that either class can read the file
+      err = QH5Lite::writeStringAttribute(parentId, getName(), SIMPL::HDF5::ObjectType, NeighborList<T>::ClassName());
+      if(err < 0)
+      {
+        return -607;
+      }
+      hsize_t size = tDims.size();
+      err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::TupleDimensions, 1, &size, tDims.data());
+      if(err < 0)
+      {
+        return -609;
+      }
+      QVector<size_t> cDims = getComponentDimensions();
+      size = cDims.size();
+      err = QH5Lite::writePointerAttribute(parentId, getName(), SIMPL::HDF5::ComponentDimensions, 1, &size, cDims.data());
+      if(err < 0)
+      {
+        return -610;
+      }
+      err = QH5Lite::writeStringAttribute(parentId, getName(), "Linked NumNeighbors Dataset", m_NumNeighborsArrayName);
+      if(err < 0)
+      {
+        return -608;
+      }
+      return err;
+    }
+
+    /**
+     * @brief writeXdmfAttribute
+     * @param out
+     * @param volDims
+     * @param hdfFileName
+     * @param groupPath
+     * @param label
+     * @return
+     */
+    int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) override
+    {
+      int precision = 0;
+      QString xdmfTypeName;
+      getXdmfTypeAndSize(xdmfTypeName, precision);
+
+      out << "    <Attribute Name=\"" << getName() << label << "\" AttributeType=\"Scalar\" Center=\"Node\">";
+      out << "      <DataItem Format=\"HDF\" Dimensions=\"" << volDims[0] << " " << volDims[1] << " " << volDims[2] << "\" ";
+      out << "NumberType=\"" << xdmfTypeName << "\" "
+          << "Precision=\"" << precision << "\" >";
+      out << "        " << hdfFileName.toLatin1().data() << groupPath.toLatin1().data() << "/" << getName();
+      out << "      </DataItem>";
+      out << "    </Attribute>";
+      return 1;
+    }
+
+    /**
+     * @brief getInfoString
+     * @return Returns a formatted string that contains general infomation about
+     * the instance of the object.
+     */
+    QString getInfoString(SIMPL::InfoStringFormat format) override
+    {
+      QString info;
+      QTextStream ss(&info);
+      if(format == SIMPL::HtmlFormat)
+      {
+        ss << "<html><head></head>\n";
+        ss << "<body>\n";
+        ss << "<table cellpadding=\"4\" cellspacing=\"0\" border=\"0\">\n";
+        ss << "<tbody>\n";
+        ss << "<tr bgcolor=\"#FFFCEA\"><th colspan=2>Attribute Array Info</th></tr>";
+        ss << "<tr bgcolor=\"#E9E7D6\"><th align=\"right\">Name:</th><td>" << getName() << "</td></tr>";
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Type:</th><td>" << getTypeAsString() << " (CSR)</td></tr>";
+        QLocale usa(QLocale::English, QLocale::UnitedStates);
+        QString numStr = usa.toString(static_cast<qlonglong>(getNumberOfTuples()));
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Number of Tuples:</th><td>" << numStr << "</td></tr>";
+        numStr = usa.toString(static_cast<qlonglong>(getSize()));
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Total Elements:</th><td>" << numStr << "</td></tr>";
+        ss << "</tbody></table>\n";
+        ss << "<br/>";
+        ss << "</body></html>";
+      }
+      return info;
+    }
+
+    /**
+     * @brief readH5Data Reads the NumNeighbors array into the offsets and the flat dataset
+     * directly into the values array.
+     * @param parentId
+     * @return
+     */
+    int readH5Data(hid_t parentId) override
+    {
+      std::vector<int32_t> numNeighbors;
+      if(!QH5Lite::datasetExists(parentId, m_NumNeighborsArrayName))
+      {
+        return -703;
+      }
+      int err = QH5Lite::readVectorDataset(parentId, m_NumNeighborsArrayName, numNeighbors);
+      if(err < 0)
+      {
+        return -702;
+      }
+
+      m_PendingIds.clear();
+      m_PendingValues.clear();
+      m_Offsets.resize(numNeighbors.size() + 1);
+      m_Offsets[0] = 0;
+      for(size_t i = 0; i < numNeighbors.size(); i++)
+      {
+        m_Offsets[i + 1] = m_Offsets[i] + static_cast<size_t>(numNeighbors[i]);
+      }
+      m_NumTuples = numNeighbors.size();
+
+      m_Values.clear();
+      if(m_Offsets.back() == 0)
+      {
+        return 0;
+      }
+      err = QH5Lite::readVectorDataset(parentId, getName(), m_Values);
+      if(err < 0)
+      {
+        return err;
+      }
+      if(m_Values.size() != m_Offsets.back())
+      {
+        return -704;
+      }
+      return err;
+    }
+
+    /**
+     * @brief addEntry Appends a value to the end of a list, growing the number of lists if needed.
+     * Negative ids are ignored.
+     * @param grainId
+     * @param value
+     */
+    void addEntry(int grainId, T value)
+    {
+      if(grainId < 0)
+      {
+        return;
+      }
+      m_PendingIds.push_back(static_cast<size_t>(grainId));
+      m_PendingValues.push_back(value);
+      if(static_cast<size_t>(grainId) >= m_NumTuples)
+      {
+        m_NumTuples = static_cast<size_t>(grainId) + 1;
+      }
+    }
+
+    /**
+     * @brief clearAllLists Removes all the lists
+     */
+    void clearAllLists()
+    {
+      m_PendingIds.clear();
+      m_PendingValues.clear();
+      m_Values.clear();
+      m_Offsets.assign(1, 0);
+      m_NumTuples = 0;
+    }
+
+    /**
+     * @brief setList Replaces the contents of a list, growing the number of lists if needed
+     * @param grainId
+     * @param neighborList
+     */
+    void setList(int grainId, const VectorType& neighborList)
+    {
+      size_t listId = static_cast<size_t>(grainId);
+      if(listId >= getNumberOfTuples())
+      {
+        resize(listId + 1);
+      }
+      compact();
+      size_t start = m_Offsets[listId];
+      size_t oldSize = m_Offsets[listId + 1] - start;
+      size_t newSize = neighborList.size();
+      if(newSize > oldSize)
+      {
+        m_Values.insert(m_Values.begin() + start + oldSize, newSize - oldSize, T());
+      }
+      else if(newSize < oldSize)
+      {
+        m_Values.erase(m_Values.begin() + start + newSize, m_Values.begin() + start + oldSize);
+      }
+      std::copy(neighborList.begin(), neighborList.end(), m_Values.begin() + start);
+      for(size_t i = listId + 1; i < m_Offsets.size(); i++)
+      {
+        m_Offsets[i] = m_Offsets[i] + newSize - oldSize;
+      }
+    }
+
+    /**
+     * @brief setList
+     * @param grainId
+     * @param neighborList
+     */
+    void setList(int grainId, SharedVectorType neighborList)
+    {
+      setList(grainId, (nullptr != neighborList) ? *neighborList : VectorType());
+    }
+
+    /**
+     * @brief getValue
+     * @param grainId
+     * @param index
+     * @param ok
+     * @return
+     */
+    T getValue(int grainId, int index, bool& ok)
+    {
+      compact();
+      Q_ASSERT(static_cast<size_t>(grainId) < getNumberOfTuples());
+      if(index < 0 || static_cast<size_t>(index) >= m_Offsets[grainId + 1] - m_Offsets[grainId])
+      {
+        ok = false;
+        return -1;
+      }
+      return m_Values[m_Offsets[grainId] + index];
+    }
+
+    /**
+     * @brief getNumberOfLists
+     * @return
+     */
+    int getNumberOfLists()
+    {
+      return static_cast<int>(getNumberOfTuples());
+    }
+
+    /**
+     * @brief getListSize
+     * @param grainId
+     * @return
+     */
+    int getListSize(int grainId)
+    {
+      compact();
+      Q_ASSERT(static_cast<size_t>(grainId) < getNumberOfTuples());
+      return static_cast<int>(m_Offsets[grainId + 1] - m_Offsets[grainId]);
+    }
+
+    /**
+     * @brief getListPointer Returns a pointer to the first value of a list. The values of the list can be
+     * modified in place. The pointer is invalidated by any call that changes the size of a list.
+     * @param grainId
+     * @return
+     */
+    T* getListPointer(int grainId)
+    {
+      compact();
+      Q_ASSERT(static_cast<size_t>(grainId) < getNumberOfTuples());
+      return m_Values.data() + m_Offsets[grainId];
+    }
+
+    /**
+     * @brief getList Returns a view of a list without copying it. The values can be modified through the
+     * view; use setList() to change the length of a list and copyOfList() for a copy that outlives it.
+     * @param grainId
+     * @return
+     */
+    ListView getList(int grainId)
+    {
+      compact();
+      Q_ASSERT(static_cast<size_t>(grainId) < getNumberOfTuples());
+      return ListView(m_Values.data() + m_Offsets[grainId], m_Offsets[grainId + 1] - m_Offsets[grainId]);
+    }
+
+    /**
+     * @brief copyOfList
+     * @param grainId
+     * @return
+     */
+    VectorType copyOfList(int grainId)
+    {
+      compact();
+      Q_ASSERT(static_cast<size_t>(grainId) < getNumberOfTuples());
+      return VectorType(m_Values.begin() + m_Offsets[grainId], m_Values.begin() + m_Offsets[grainId + 1]);
+    }
+
+    /**
+     * @brief getOffsets Returns the CSR offsets array which has getNumberOfTuples() + 1 entries
+     * @return
+     */
+    const std::vector<size_t>& getOffsets()
+    {
+      compact();
+      return m_Offsets;
+    }
+
+    /**
+     * @brief getValues Returns the CSR values array
+     * @return
+     */
+    std::vector<T>& getValues()
+    {
+      compact();
+      return m_Values;
+    }
+
+  protected:
+    /**
+     * @brief CSRNeighborList
+     * @param numTuples
+     * @param name
+     */
+    CSRNeighborList(size_t numTuples, const QString& name)
+    : m_NumNeighborsArrayName(SIMPL::FeatureData::NumNeighbors)
+    , m_Name(name)
+    , m_NumTuples(numTuples)
+    , m_Offsets(1, 0)
+    {
+    }
+
+    /**
+     * @brief compact Merges the entries buffered by addEntry() into the CSR arrays. The entries are
+     * distributed with a counting sort so the order in which they were added is kept within each list.
+     */
+    void compact()
+    {
+      if(m_Offsets.size() < m_NumTuples + 1)
+      {
+        m_Offsets.resize(m_NumTuples + 1, m_Values.size());
+      }
+      if(m_PendingIds.empty())
+      {
+        return;
+      }
+
+      std::vector<size_t> newOffsets(m_NumTuples + 1, 0);
+      for(size_t i = 0; i < m_NumTuples; i++)
+      {
+        newOffsets[i + 1] = m_Offsets[i + 1] - m_Offsets[i];
+      }
+      for(const auto& id : m_PendingIds)
+      {
+        newOffsets[id + 1]++;
+      }
+      for(size_t i = 0; i < m_NumTuples; i++)
+      {
+        newOffsets[i + 1] += newOffsets[i];
+      }
+
+      std::vector<T> newValues(newOffsets.back());
+      std::vector<size_t> cursor(newOffsets.begin(), newOffsets.end() - 1);
+      for(size_t i = 0; i < m_NumTuples; i++)
+      {
+        cursor[i] = std::copy(m_Values.begin() + m_Offsets[i], m_Values.begin() + m_Offsets[i + 1], newValues.begin() + cursor[i]) - newValues.begin();
+      }
+      for(size_t i = 0; i < m_PendingIds.size(); i++)
+      {
+        newValues[cursor[m_PendingIds[i]]++] = m_PendingValues[i];
+      }
+
+      m_Offsets.swap(newOffsets);
+      m_Values.swap(newValues);
+      m_PendingIds.clear();
+      m_PendingIds.shrink_to_fit();
+      m_PendingValues.clear();
+      m_PendingValues.shrink_to_fit();
+    }
+
+  private:
+    QString m_Name;
+    size_t m_NumTuples;
+    std::vector<size_t> m_Offsets;
+    std::vector<T> m_Values;
+    std::vector<size_t> m_PendingIds;
+    std::vector<T> m_PendingValues;
+
+  public:
+    CSRNeighborList(const CSRNeighborList&) = delete; // Copy Constructor Not Implemented
+    CSRNeighborList(CSRNeighborList&&) = delete;      // Move Constructor Not Implemented
+    CSRNeighborList& operator=(const CSRNeighborList&) = delete; // Copy Assignment Not Implemented
+    CSRNeighborList& operator=(CSRNeighborList&&) = delete;      // Move Assignment Not Implemented
+};
+
+using Int32CSRNeighborListType = CSRNeighborList<int32_t>;
+using FloatCSRNeighborListType = CSRNeighborList<float>;
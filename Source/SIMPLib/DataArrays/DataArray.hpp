@@ -36,12 +36,18 @@
 #pragma once
 
 // STL Includes
-#include <vector>
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/HeapDataStorage.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/IDataStorage.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 
@@ -401,7 +407,9 @@ class DataArray : public IDataArray
       Pointer p(d);
 
       p->m_Array = data; // Now set the internal array to the raw pointer
+      p->m_Capacity = (nullptr != data) ? p->m_Size : 0;
       p->m_OwnsData = ownsData; // Set who owns the data, i.e., who is going to "free" the memory
+      p->m_Storage = HeapDataStorage::New(); // The memory was malloc()'ed so it has to be free()'ed
       if (nullptr != data) { p->m_IsAllocated = true; }
 
       return p;
@@ -433,12 +441,14 @@ class DataArray : public IDataArray
      */
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       if(!m_IsAllocated) { return false; }
       if(nullptr == m_Array) { return false; }
       if(destTupleOffset > m_MaxId) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
-      if(nullptr == source->getPointer(0)) { return false; }
+      if(nullptr == source->getConstPointer(0)) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents()) { return false; }
 
@@ -454,7 +464,7 @@ class DataArray : public IDataArray
 
       size_t elementStart = destTupleOffset*getNumberOfComponents();
       size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-      std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+      std::memcpy(m_Array + elementStart, source->getConstPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
       return true;
     }
 
@@ -464,6 +474,7 @@ class DataArray : public IDataArray
      */
     bool copyIntoArray(Pointer dest)
     {
+      resolveLazyLoad();
       if(m_IsAllocated  && dest->isAllocated() && m_Array && dest->getPointer(0))
       {
         size_t totalBytes = m_Size * sizeof(T);
@@ -519,6 +530,7 @@ class DataArray : public IDataArray
     ~DataArray() override
     {
       //qDebug() << "~DataArrayTemplate '" << m_Name << "'" ;
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       if ((nullptr != m_Array) && (true == m_OwnsData))
       {
         _deallocate();
@@ -529,7 +541,10 @@ class DataArray : public IDataArray
      * @brief isAllocated
      * @return
      */
-    bool isAllocated() override { return m_IsAllocated; }
+    bool isAllocated() override
+    {
+      return m_IsAllocated || m_LazyLoadPending.load(std::memory_order_acquire);
+    }
 
     /**
      * @brief Gives this array a human readable name
@@ -563,6 +578,7 @@ class DataArray : public IDataArray
      */
     void takeOwnership() override
     {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       m_OwnsData = true;
     }
 
@@ -573,19 +589,148 @@ class DataArray : public IDataArray
      */
     void releaseOwnership() override
     {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       m_OwnsData = false;
     }
 
+    /**
+     * @brief getStorage Returns the backend that holds the data of this array or a null
+     * pointer if nothing has been allocated yet.
+     * @return
+     */
+    IDataStorage::Pointer getStorage()
+    {
+      return m_Storage;
+    }
+
+    /**
+     * @brief setStorage Moves the data of this array into the given backend, for instance a
+     * MemoryMappedDataStorage, and uses that backend for all future allocations. Passing a null
+     * pointer returns the array to the global out-of-core policy for its next allocation.
+     * @param storage
+     * @return 1 on success, -1 if the data could not be moved. The array is unchanged on failure.
+     */
+    int32_t setStorage(const IDataStorage::Pointer& storage)
+    {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      if (nullptr == storage)
+      {
+        m_ExplicitStorage = false;
+        return 1;
+      }
+      if (storage == m_Storage)
+      {
+        m_ExplicitStorage = true;
+        return 1;
+      }
+      if (m_IsAllocated && nullptr != m_Array && m_Size > 0)
+      {
+        size_t totalBytes = m_Size * sizeof(T);
+        T* newArray = static_cast<T*>(storage->allocate(totalBytes));
+        if (nullptr == newArray)
+        {
+          qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes in " << storage->getStorageType() << " storage.";
+          return -1;
+        }
+        std::memcpy(newArray, m_Array, totalBytes);
+        if (m_OwnsData)
+        {
+          _deallocate();
+        }
+        m_Array = newArray;
+        m_Capacity = m_Size;
+        m_OwnsData = true;
+        m_IsAllocated = true;
+        releaseSharedBuffer();
+      }
+      m_Storage = storage;
+      m_ExplicitStorage = true;
+      return 1;
+    }
+
+    /**
+     * @brief setLazyLoader Defers reading the data of this array until the first access. Only arrays
+     * that have not been allocated can be deferred; the allocation happens when the data is loaded,
+     * in the backend that the out-of-core policy (or setStorage()) selects at that point.
+     * @param loader
+     * @param statistics
+     * @param sourceFile
+     * @return
+     */
+    bool setLazyLoader(const LazyLoader& loader, const LazyLoadStatistics::Pointer& statistics, const QString& sourceFile = QString()) override
+    {
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      if (m_IsAllocated || nullptr != m_Array || m_Size == 0 || !loader)
+      {
+        return false;
+      }
+      m_LazyLoader = loader;
+      m_LazyLoadStatistics = statistics;
+      m_LazyLoadSource = sourceFile;
+      m_LazyLoadError.clear();
+      m_LazyLoadPending.store(true, std::memory_order_release);
+      if (nullptr != m_LazyLoadStatistics)
+      {
+        m_LazyLoadStatistics->addArray();
+      }
+      return true;
+    }
+
+    /**
+     * @brief isLazyLoadPending
+     * @return
+     */
+    bool isLazyLoadPending() override
+    {
+      return m_LazyLoadPending.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief getLazyLoadSource
+     * @return
+     */
+    QString getLazyLoadSource() override
+    {
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      return m_LazyLoadPending.load(std::memory_order_relaxed) ? m_LazyLoadSource : QString();
+    }
+
+    /**
+     * @brief resolveLazyLoadNow
+     * @return
+     */
+    int32_t resolveLazyLoadNow() override
+    {
+      resolveLazyLoad();
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      return m_LazyLoadError.isEmpty() ? 0 : -1;
+    }
+
+    /**
+     * @brief takeLazyLoadError
+     * @return
+     */
+    QString takeLazyLoadError() override
+    {
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      QString error = m_LazyLoadError;
+      m_LazyLoadError.clear();
+      return error;
+    }
+
     /**
      * @brief Allocates the memory needed for this class
      * @return 1 on success, -1 on failure
      */
     virtual int32_t allocate()
     {
+      discardLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       if ((nullptr != m_Array) && (true == m_OwnsData))
       {
         _deallocate();
       }
+      releaseSharedBuffer();
       m_Array = nullptr;
       m_OwnsData = true;
       m_IsAllocated = false;
@@ -597,17 +742,19 @@ class DataArray : public IDataArray
 
 
       size_t newSize = m_Size;
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      m_Array = static_cast<T*>( _mm_malloc (newSize * sizeof(T), 16) );
-#else
-      m_Array = (T*)malloc(newSize * sizeof(T));
-#endif
+      if (!m_ExplicitStorage)
+      {
+        // Let the out-of-core policy pick the backend for the new size
+        m_Storage.reset();
+      }
+      m_Array = static_cast<T*>(getStorageForSize(newSize * sizeof(T))->allocate(newSize * sizeof(T)));
       if (!m_Array)
       {
         qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
         return -1;
       }
       m_Size = newSize;
+      m_Capacity = newSize;
       m_IsAllocated = true;
 
       return 1;
@@ -619,16 +766,24 @@ class DataArray : public IDataArray
      */
     virtual void clear()
     {
+      discardLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       if (nullptr != m_Array && true == m_OwnsData)
       {
         _deallocate();
       }
+      releaseSharedBuffer();
       m_Array = nullptr;
       m_Size = 0;
+      m_Capacity = 0;
       m_OwnsData = true;
       m_MaxId = 0;
       m_IsAllocated = false;
       m_NumTuples = 0;
+      if (!m_ExplicitStorage)
+      {
+        m_Storage.reset();
+      }
       // We need to actually keep the numComps and the dimensions in case the user resizes the array
       //      m_CompDims.clear();
       //      m_NumComponents = 0;
@@ -639,6 +794,8 @@ class DataArray : public IDataArray
      */
     void initializeWithZeros() override
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       size_t typeSize = sizeof(T);
       ::memset(m_Array, 0, m_Size * typeSize);
@@ -649,6 +806,8 @@ class DataArray : public IDataArray
      */
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       if(!m_IsAllocated || nullptr == m_Array) { return; }
       for (size_t i = offset; i < m_Size; i++)
       {
@@ -666,6 +825,8 @@ class DataArray : public IDataArray
      */
     int eraseTuples(QVector<size_t>& idxs) override
     {
+      resolveLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       int err = 0;
 
       // If nothing is to be erased just return
@@ -691,7 +852,12 @@ class DataArray : public IDataArray
       size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
 
       // Create a new m_Array to copy into
-      T* newArray = (T*)malloc(newSize * sizeof(T));
+      T* newArray = static_cast<T*>(getStorageForSize(newSize * sizeof(T))->allocate(newSize * sizeof(T)));
+      if (nullptr == newArray)
+      {
+        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+        return -101;
+      }
       // Splat AB across the array so we know if we are copying the values or not
       ::memset(newArray, 0xAB, newSize * sizeof(T));
 
@@ -717,8 +883,9 @@ class DataArray : public IDataArray
       {
         T* currentSrc = m_Array + (j * m_NumComponents);
         std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
+        releaseBuffer(); // We are done copying - delete the current m_Array
         m_Size = newSize;
+        m_Capacity = newSize;
         m_Array = newArray;
         m_OwnsData = true;
         m_MaxId = newSize - 1;
@@ -758,10 +925,11 @@ class DataArray : public IDataArray
       }
 
       // We are done copying - delete the current m_Array
-      _deallocate();
+      releaseBuffer();
 
       // Allocation was successful.  Save it.
       m_Size = newSize;
+      m_Capacity = newSize;
       m_Array = newArray;
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
@@ -779,6 +947,8 @@ class DataArray : public IDataArray
      */
     int copyTuple(size_t currentPos, size_t newPos) override
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       size_t max =  ((m_MaxId + 1) / m_NumComponents);
       if (currentPos >= max
           || newPos >= max )
@@ -850,6 +1020,8 @@ class DataArray : public IDataArray
     void* getVoidPointer(size_t i) override
     {
       if (i >= m_Size) { return nullptr;}
+      resolveLazyLoadAndCount();
+      resolveSharedBuffer();
 
       return (void*)(&(m_Array[i]));
     }
@@ -867,9 +1039,28 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      resolveLazyLoadAndCount();
+      resolveSharedBuffer();
       return (T*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief getConstPointer Returns a read only pointer to a specific index into the array. Unlike
+     * getPointer() this does not give the array its own copy of a buffer that it shares with arrays
+     * created by deepCopy(), so it is the accessor to use when the values are only read. The pointer
+     * is valid until the array is modified.
+     * @param i The index to return the pointer to.
+     * @return The pointer to the index
+     */
+    const T* getConstPointer(size_t i)
+    {
+#ifndef NDEBUG
+      if (m_Size > 0) { Q_ASSERT(i < m_Size);}
+#endif
+      resolveLazyLoadAndCount();
+      return m_Array + i;
+    }
+
     /**
      * @brief Returns the value for a given index
      * @param i The index to return the value at
@@ -880,6 +1071,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      resolveLazyLoad();
       return m_Array[i];
     }
 
@@ -894,6 +1086,8 @@ class DataArray : public IDataArray
       if (m_Size > 0)
       { Q_ASSERT(i < m_Size);}
 #endif
+      resolveLazyLoad();
+      resolveSharedBuffer();
       m_Array[i] = value;
     }
 
@@ -904,6 +1098,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      resolveLazyLoad();
       return m_Array[i * m_NumComponents + j];
     }
 
@@ -918,6 +1113,8 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      resolveLazyLoad();
+      resolveSharedBuffer();
       m_Array[i * m_NumComponents + j] = c;
     }
 
@@ -954,6 +1151,8 @@ class DataArray : public IDataArray
      */
     void initializeTuple(size_t i, void* p) override
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       if(!m_IsAllocated) { return; }
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents < m_Size);}
@@ -975,6 +1174,8 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents < m_Size);}
 #endif
+      resolveLazyLoad();
+      resolveSharedBuffer();
       return m_Array + (tupleIndex * m_NumComponents);
     }
 
@@ -998,6 +1199,7 @@ class DataArray : public IDataArray
      */
     void printTuple(QTextStream& out, size_t i, char delimiter = ',') override
     {
+      resolveLazyLoad();
       int precision = out.realNumberPrecision();
       T value = static_cast<T>(0x00);
       if (typeid(value) == typeid(float)) { out.setRealNumberPrecision(8); }
@@ -1019,6 +1221,7 @@ class DataArray : public IDataArray
      */
     void printComponent(QTextStream& out, size_t i, int j) override
     {
+      resolveLazyLoad();
       out << m_Array[i * m_NumComponents + j];
     }
 
@@ -1104,16 +1307,41 @@ class DataArray : public IDataArray
     }
 
     /**
-     * @brief deepCopy
-     * @param forceNoAllocate
+     * @brief deepCopy Creates a copy of this array. The copy shares the buffer of this array until either
+     * of the two is modified through one of the mutating accessors (getPointer(), setValue(), ...), at
+     * which point the modified array gets its own buffer, so copies cost no memory until they are
+     * written to. Raw pointers that were obtained from this array before the copy was made must be
+     * fetched again before they are written through.
+     *
+     * Copies may be taken from another thread (the GUI inspects arrays while a pipeline runs): handing
+     * the buffer over happens under the same lock that every call replacing or freeing the buffer of
+     * this array holds, and the writing thread detaches on its next mutating access.
+     * @param forceNoAllocate Returns a copy with the same layout whose values are not copied
      * @return
      */
     IDataArray::Pointer deepCopy(bool forceNoAllocate = false) override
     {
+      resolveLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      // Arrays placed in a specific backend with setStorage() are copied right away so that the copy
+      // follows the global policy
+      if(!forceNoAllocate && m_IsAllocated && nullptr != m_Array && m_Size > 0 && !m_ExplicitStorage && (m_OwnsData || nullptr != m_SharedBuffer))
+      {
+        Pointer copy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+        copy->m_SharedBuffer = shareBuffer();
+        copy->m_Storage = copy->m_SharedBuffer->Storage;
+        copy->m_Array = m_Array;
+        copy->m_Capacity = m_Size;
+        copy->m_OwnsData = false;
+        copy->m_IsAllocated = true;
+        copy->m_BufferShared.store(true, std::memory_order_release);
+        return copy;
+      }
+
       IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
       if(m_IsAllocated  && !forceNoAllocate)
       {
-        T* src = getPointer(0);
+        const T* src = getConstPointer(0);
         void* dest = daCopy->getVoidPointer(0);
         size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
         std::memcpy(dest, src, totalBytes);
@@ -1130,9 +1358,22 @@ class DataArray : public IDataArray
      */
     int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
     {
+      return writeH5Data(parentId, tDims, H5DatasetCompression());
+    }
+
+    /**
+     * @brief writeH5Data
+     * @param parentId
+     * @param tDims
+     * @param compression Chunking and compression used when the dataset is created
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression) override
+    {
+      resolveLazyLoad();
       if (m_Array == nullptr)
       { return -85648; }
-      return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims);
+      return H5DataArrayWriter::writeDataArray<Self>(parentId, this, tDims, compression);
     }
 
     /**
@@ -1144,7 +1385,8 @@ class DataArray : public IDataArray
     int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName,
                                    const QString& groupPath, const QString& label) override
     {
-      if (m_Array == nullptr) { return -85648; }
+      // Only the location of the data is written so a pending load does not have to be resolved
+      if (m_Array == nullptr && !isLazyLoadPending()) { return -85648; }
       QString dimStr;
       int precision = 0;
       QString xdmfTypeName;
@@ -1250,6 +1492,8 @@ class DataArray : public IDataArray
     int readH5Data(hid_t parentId) override
     {
       int err = 0;
+      discardLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
 
       resize(0);
       IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
@@ -1259,7 +1503,12 @@ class DataArray : public IDataArray
       }
       m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
       m_Size = p->getSize();
+      m_Capacity = m_Size;
       m_OwnsData = true;
+      // Adopt the backend that created the buffer so it is released correctly
+      Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(p);
+      m_Storage = (nullptr != typedArray && nullptr != typedArray->m_Storage) ? typedArray->m_Storage : HeapDataStorage::New();
+      m_ExplicitStorage = false;
       m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
       m_IsAllocated = true;
       m_Name = p->getName();
@@ -1278,6 +1527,8 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
+      resolveLazyLoad();
+      resolveSharedBuffer();
       char* ptr = (char*)(m_Array);
       char t[8];
       size_t size = getTypeSize();
@@ -1311,6 +1562,8 @@ class DataArray : public IDataArray
     inline T& operator[](size_t i)
     {
       Q_ASSERT(i < m_Size);
+      resolveLazyLoad();
+      resolveSharedBuffer();
       return m_Array[i];
     }
 
@@ -1324,6 +1577,7 @@ class DataArray : public IDataArray
     */
     DataArray(size_t numTuples, QVector<size_t> compDims, QString name, bool ownsData = true) :
       m_Array(nullptr),
+      m_Capacity(0),
       m_OwnsData(ownsData),
       m_IsAllocated(false),
       m_Name(std::move(name)),
@@ -1373,12 +1627,16 @@ class DataArray : public IDataArray
       }
 #endif
 
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      _mm_free( m_buffer );
-#else
-      free(m_Array);
-#endif
+      if (nullptr != m_Storage)
+      {
+        m_Storage->deallocate(m_Array);
+      }
+      else
+      {
+        free(m_Array);
+      }
       m_Array = nullptr;
+      m_Capacity = 0;
       m_IsAllocated = false;
     }
 
@@ -1389,6 +1647,7 @@ class DataArray : public IDataArray
      */
     int32_t resizeTotalElements(size_t size) override
     {
+      resolveLazyLoad();
       // std::cout << "DataArray::resizeTotalElements(" << size << ")" << std::endl;
       if (size == 0)
       {
@@ -1405,13 +1664,17 @@ class DataArray : public IDataArray
 
 
     /**
-     * @brief resizes the internal array to be 'size' elements in length
+     * @brief resizes the internal array to be 'size' elements in length. An array that grows from a non
+     * zero size gets at least 50% more room than it needs, so arrays that are extended a little at a time
+     * (vertex lists of meshes under construction, for instance) are copied O(log n) times instead of
+     * on every call. Only the newly exposed elements are initialized. Shrinking releases the extra memory.
      * @param size
      * @return Pointer to the internal array
      */
     virtual T* resizeAndExtend(size_t size)
     {
-      T* newArray;
+      resolveLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
       size_t newSize;
       size_t oldSize;
 
@@ -1428,12 +1691,83 @@ class DataArray : public IDataArray
         clear();
         return m_Array;
       }
+
+      if (newSize > m_Capacity || newSize < oldSize || false == m_OwnsData)
+      {
+        size_t newCapacity = newSize;
+        if (newSize > oldSize && oldSize > 0)
+        {
+          newCapacity = std::max(newSize, m_Capacity + m_Capacity / 2);
+        }
+        if (nullptr == reallocateBuffer(newCapacity))
+        {
+          return nullptr;
+        }
+      }
+
+      // Allocation was successful.  Save it.
+      m_Size = newSize;
+      m_MaxId = newSize - 1;
+      m_IsAllocated = true;
+
+      // Initialize the new tuples if newSize is larger than old size
+      if(newSize > oldSize)
+      {
+        initializeWithValue(m_InitValue, oldSize);
+      }
+
+      return m_Array;
+    }
+
+    /**
+     * @brief reserve Makes room for numTuples tuples without changing the number of tuples, so that
+     * the array can later be resized up to that many tuples without moving its data.
+     * @param numTuples
+     * @return 1 on success, -1 if the memory could not be allocated
+     */
+    int32_t reserve(size_t numTuples)
+    {
+      resolveLazyLoad();
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      size_t newCapacity = numTuples * m_NumComponents;
+      if (newCapacity <= m_Capacity && (m_OwnsData || nullptr == m_Array))
+      {
+        return 1;
+      }
+      if (newCapacity < m_Size)
+      {
+        newCapacity = m_Size;
+      }
+      return (nullptr != reallocateBuffer(newCapacity)) ? 1 : -1;
+    }
+
+    /**
+     * @brief getCapacity Returns the number of elements the array can hold before it has to move its data
+     * @return
+     */
+    size_t getCapacity()
+    {
+      return m_Capacity;
+    }
+
+  protected:
+    /**
+     * @brief reallocateBuffer Moves the data into a buffer of newCapacity elements that this array owns.
+     * Up to m_Size elements are preserved; m_Size itself is not changed.
+     * @param newCapacity
+     * @return The new buffer or nullptr if the memory could not be allocated. The array is unchanged on failure.
+     */
+    T* reallocateBuffer(size_t newCapacity)
+    {
+      T* newArray;
+      size_t numToCopy = (newCapacity < m_Size ? newCapacity : m_Size);
+
       // OS X's realloc does not free memory if the new block is smaller.  This
       // is a very serious problem and causes huge amount of memory to be
-      // wasted. Do not use realloc on the Mac.
+      // wasted. Do not use realloc on the Mac when shrinking.
       bool dontUseRealloc = false;
 #if defined __APPLE__
-      dontUseRealloc = true;
+      dontUseRealloc = (newCapacity < m_Capacity);
 #endif
 
       // Allocate a new array if we DO NOT own the current array
@@ -1441,70 +1775,64 @@ class DataArray : public IDataArray
       {
         // The old array is owned by the user so we cannot try to
         // reallocate it.  Just allocate new memory that we will own.
-        newArray = (T*)malloc(newSize * sizeof(T));
+        if (!m_ExplicitStorage)
+        {
+          m_Storage.reset();
+        }
+        newArray = static_cast<T*>(getStorageForSize(newCapacity * sizeof(T))->allocate(newCapacity * sizeof(T)));
         if (!newArray)
         {
-          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+          qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. " ;
           return nullptr;
         }
 
         // Copy the data from the old array.
-        std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        std::memcpy(newArray, m_Array, numToCopy * sizeof(T));
+        releaseSharedBuffer();
       }
       else if (!dontUseRealloc)
       {
         // Try to reallocate with minimal memory usage and possibly avoid copying.
-        newArray = (T*)realloc(m_Array, newSize * sizeof(T));
+        newArray = static_cast<T*>(getStorageForSize(newCapacity * sizeof(T))->reallocate(m_Array, m_Capacity * sizeof(T), newCapacity * sizeof(T)));
         if (!newArray)
         {
-          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+          qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. " ;
           return nullptr;
         }
       }
       else
       {
-        newArray = (T*)malloc(newSize * sizeof(T));
+        newArray = static_cast<T*>(getStorageForSize(newCapacity * sizeof(T))->allocate(newCapacity * sizeof(T)));
         if (!newArray)
         {
-          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+          qDebug() << "Unable to allocate " << newCapacity << " elements of size " << sizeof(T) << " bytes. " ;
           return nullptr;
         }
 
         // Copy the data from the old array.
         if (m_Array != nullptr)
         {
-          std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+          std::memcpy(newArray, m_Array, numToCopy * sizeof(T));
         }
         // Free the old array
         _deallocate();
       }
 
-      // Allocation was successful.  Save it.
-      m_Size = newSize;
       m_Array = newArray;
+      m_Capacity = newCapacity;
 
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
-
-      m_MaxId = newSize - 1;
-      m_IsAllocated = true;
-
-      // Initialize the new tuples if newSize is larger than old size
-      if(newSize > oldSize)
-      {
-        initializeWithValue(m_InitValue, oldSize);
-      }
-
       return m_Array;
     }
 
-
   private:
 
     //  unsigned long long int MUD_FLAP_0;
     T* m_Array;
     //  unsigned long long int MUD_FLAP_1;
     size_t m_Size;
+    size_t m_Capacity; // Number of elements the buffer can hold, at least m_Size
     //  unsigned long long int MUD_FLAP_4;
     bool m_OwnsData;
     //  unsigned long long int MUD_FLAP_2;
@@ -1522,6 +1850,246 @@ class DataArray : public IDataArray
 
     T m_InitValue;
 
+    IDataStorage::Pointer m_Storage;
+    bool m_ExplicitStorage = false;
+
+    LazyLoader m_LazyLoader;
+    LazyLoadStatistics::Pointer m_LazyLoadStatistics;
+    std::atomic<bool> m_LazyLoadPending{false};
+    std::mutex m_LazyLoadMutex;
+    QString m_LazyLoadSource;
+    QString m_LazyLoadError;
+
+    /**
+     * @brief resolveLazyLoad Reads the deferred payload if it has not been read yet. This is a single
+     * atomic load for arrays that are not lazily loaded.
+     */
+    inline void resolveLazyLoad()
+    {
+      if (m_LazyLoadPending.load(std::memory_order_acquire))
+      {
+        loadLazyData();
+      }
+    }
+
+    /**
+     * @brief resolveLazyLoadAndCount Same as resolveLazyLoad() but also counts the access as a hit
+     * if the payload had already been loaded.
+     */
+    inline void resolveLazyLoadAndCount()
+    {
+      if (m_LazyLoadPending.load(std::memory_order_acquire))
+      {
+        loadLazyData();
+      }
+      else if (nullptr != m_LazyLoadStatistics)
+      {
+        m_LazyLoadStatistics->recordHit();
+      }
+    }
+
+    /**
+     * @brief loadLazyData Allocates the array and fills it through the lazy loader. Concurrent
+     * callers wait for the first one to finish. If the read fails the array is zero filled so that
+     * callers never see a null pointer, and the failure is kept for takeLazyLoadError() and recorded
+     * in the LazyLoadStatistics of the array.
+     */
+    void loadLazyData()
+    {
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      if (!m_LazyLoadPending.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      size_t totalBytes = m_Size * sizeof(T);
+      if (!m_ExplicitStorage)
+      {
+        m_Storage.reset();
+      }
+      IDataStorage::Pointer storage = getStorageForSize(totalBytes);
+      T* buffer = static_cast<T*>(storage->allocate(totalBytes));
+      int32_t err = 0;
+      if (nullptr == buffer)
+      {
+        m_LazyLoadError = QString("Unable to allocate %1 bytes for the deferred data of array '%2'").arg(totalBytes).arg(m_Name);
+      }
+      else if ((err = m_LazyLoader(buffer, totalBytes)) < 0)
+      {
+        m_LazyLoadError = QString("Unable to read the deferred data of array '%1' from '%2' (error %3)").arg(m_Name).arg(m_LazyLoadSource).arg(err);
+        std::fill_n(buffer, m_Size, static_cast<T>(0));
+      }
+      if (!m_LazyLoadError.isEmpty() && nullptr != m_LazyLoadStatistics)
+      {
+        m_LazyLoadStatistics->recordFailure(m_LazyLoadError);
+      }
+
+      if (nullptr != buffer)
+      {
+        m_Array = buffer;
+        m_Capacity = m_Size;
+        m_OwnsData = true;
+        m_MaxId = m_Size - 1;
+        m_IsAllocated = true;
+        if (nullptr != m_LazyLoadStatistics)
+        {
+          m_LazyLoadStatistics->recordMiss(totalBytes);
+        }
+      }
+      m_LazyLoader = nullptr;
+      m_LazyLoadSource.clear();
+      m_LazyLoadPending.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief discardLazyLoad Drops a pending load, used when the contents are about to be replaced
+     */
+    void discardLazyLoad()
+    {
+      std::lock_guard<std::mutex> lock(m_LazyLoadMutex);
+      m_LazyLoader = nullptr;
+      m_LazyLoadStatistics.reset();
+      m_LazyLoadSource.clear();
+      m_LazyLoadPending.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief The SharedBuffer struct owns a buffer that several arrays read from after deepCopy().
+     * The buffer is released together with the last array that still refers to it.
+     */
+    struct SharedBuffer
+    {
+      T* Array = nullptr;
+      size_t Capacity = 0;
+      IDataStorage::Pointer Storage;
+
+      ~SharedBuffer()
+      {
+        if (nullptr != Array)
+        {
+          Storage->deallocate(Array);
+        }
+      }
+    };
+
+    std::shared_ptr<SharedBuffer> m_SharedBuffer;
+    std::atomic<bool> m_BufferShared{false};
+    // Held by every call that replaces or frees m_Array or changes m_OwnsData, and by deepCopy()
+    std::recursive_mutex m_BufferMutex;
+
+    /**
+     * @brief shareBuffer Hands the buffer of this array over to a SharedBuffer (if that has not
+     * happened yet) so that copies can refer to it.
+     * @return
+     */
+    std::shared_ptr<SharedBuffer> shareBuffer()
+    {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      if (nullptr == m_SharedBuffer)
+      {
+        m_SharedBuffer = std::make_shared<SharedBuffer>();
+        m_SharedBuffer->Array = m_Array;
+        m_SharedBuffer->Capacity = m_Capacity;
+        m_SharedBuffer->Storage = (nullptr != m_Storage) ? m_Storage : HeapDataStorage::New();
+        m_OwnsData = false;
+        m_BufferShared.store(true, std::memory_order_release);
+      }
+      return m_SharedBuffer;
+    }
+
+    /**
+     * @brief resolveSharedBuffer Gives this array its own buffer before it is modified. This is a
+     * single atomic load for arrays that do not share their buffer.
+     */
+    inline void resolveSharedBuffer()
+    {
+      if (m_BufferShared.load(std::memory_order_acquire))
+      {
+        detachSharedBuffer();
+      }
+    }
+
+    /**
+     * @brief detachSharedBuffer Takes the shared buffer back if no other array refers to it any more,
+     * otherwise copies it. On failure the array is left unallocated.
+     */
+    void detachSharedBuffer()
+    {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      if (!m_BufferShared.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      if (m_SharedBuffer.use_count() == 1)
+      {
+        m_Storage = m_SharedBuffer->Storage;
+        m_Capacity = m_SharedBuffer->Capacity;
+        m_SharedBuffer->Array = nullptr;
+      }
+      else
+      {
+        size_t totalBytes = m_Size * sizeof(T);
+        if (!m_ExplicitStorage)
+        {
+          m_Storage.reset();
+        }
+        T* buffer = static_cast<T*>(getStorageForSize(totalBytes)->allocate(totalBytes));
+        if (nullptr == buffer)
+        {
+          qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. " ;
+          m_IsAllocated = false;
+        }
+        else
+        {
+          std::memcpy(buffer, m_Array, totalBytes);
+        }
+        m_Array = buffer;
+        m_Capacity = (nullptr != buffer) ? m_Size : 0;
+      }
+      m_OwnsData = true;
+      m_SharedBuffer.reset();
+      m_BufferShared.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief releaseSharedBuffer Drops the reference to a shared buffer, used when the contents of
+     * this array are about to be replaced
+     */
+    void releaseSharedBuffer()
+    {
+      std::lock_guard<std::recursive_mutex> bufferLock(m_BufferMutex);
+      m_SharedBuffer.reset();
+      m_BufferShared.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief releaseBuffer Frees the current buffer if this array owns it and drops the reference to
+     * it if it is shared
+     */
+    void releaseBuffer()
+    {
+      if (nullptr != m_Array && m_OwnsData)
+      {
+        _deallocate();
+      }
+      m_Array = nullptr;
+      m_Capacity = 0;
+      releaseSharedBuffer();
+    }
+
+    /**
+     * @brief getStorageForSize Returns the current backend, selecting one through the
+     * out-of-core policy if none has been chosen yet.
+     * @param numBytes
+     * @return
+     */
+    IDataStorage::Pointer getStorageForSize(size_t numBytes)
+    {
+      if (nullptr == m_Storage)
+      {
+        m_Storage = IDataStorage::CreateForSize(numBytes);
+      }
+      return m_Storage;
+    }
 };
 
 
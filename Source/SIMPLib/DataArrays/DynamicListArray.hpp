@@ -35,8 +35,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <vector>
 
+#include <QtCore/QVector>
+
 //-- DREAM3D Includes
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/SIMPLib.h"
@@ -44,6 +49,10 @@
 /**
  * @brief The MeshFaceNeighbors class contains arrays of Faces for each Node in the mesh. This allows quick query to the node
  * to determine what Cells the node is a part of.
+ *
+ * All the lists are packed back to back into a single contiguous arena so building the lists costs one allocation
+ * instead of one allocation per element. A list can only grow past the size it was allocated with through
+ * setElementList(), in which case that one list is moved into its own block.
  */
 template <typename T, typename K> class DynamicListArray
 {
@@ -62,22 +71,7 @@ public:
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
-  virtual ~DynamicListArray()
-  {
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
-    {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
-    }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
-    {
-      delete[] this->m_Array;
-    }
-  }
+  virtual ~DynamicListArray() = default;
 
   /**
    * @brief size
@@ -85,7 +79,21 @@ public:
    */
   size_t size()
   {
-    return m_Size;
+    return m_Array.size();
+  }
+
+  /**
+   * @brief getTotalNumberOfElements Returns the sum of the sizes of all the lists
+   * @return
+   */
+  size_t getTotalNumberOfElements()
+  {
+    size_t total = 0;
+    for(const auto& list : m_Array)
+    {
+      total += list.ncells;
+    }
+    return total;
   }
 
   /**
@@ -96,7 +104,7 @@ public:
   Pointer deepCopy(bool forceNoAllocate = false)
   {
     DynamicListArray::Pointer copy = DynamicListArray::New();
-    std::vector<T> linkCounts(m_Size, 0);
+    std::vector<T> linkCounts(m_Array.size(), 0);
     if(forceNoAllocate)
     {
       copy->allocateLists(linkCounts);
@@ -104,17 +112,18 @@ public:
     }
 
     // Figure out how many entries, and for each entry, how many cells
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
+    for(size_t ptId = 0; ptId < m_Array.size(); ptId++)
     {
-      linkCounts[ptId] = this->m_Array[ptId].ncells;
+      linkCounts[ptId] = m_Array[ptId].ncells;
     }
-    // Allocate all that in the copy
+    // Allocate all that in the copy and copy each list into the packed arena of the copy
     copy->allocateLists(linkCounts);
-    // Copy the data from the original to the new
-    for(size_t ptId = 0; ptId < m_Size; ptId++)
+    for(size_t ptId = 0; ptId < m_Array.size(); ptId++)
     {
-      ElementList& elementList = getElementList(ptId);
-      copy->setElementList(ptId, elementList);
+      if(m_Array[ptId].ncells > 0)
+      {
+        ::memcpy(copy->m_Array[ptId].cells, m_Array[ptId].cells, sizeof(K) * m_Array[ptId].ncells);
+      }
     }
     return copy;
   }
@@ -127,7 +136,7 @@ public:
    */
   inline void insertCellReference(size_t ptId, size_t pos, size_t cellId)
   {
-    this->m_Array[ptId].cells[pos] = cellId;
+    m_Array[ptId].cells[pos] = cellId;
   }
 
   /**
@@ -137,7 +146,7 @@ public:
    */
   ElementList& getElementList(size_t ptId)
   {
-    return this->m_Array[ptId];
+    return m_Array[ptId];
   }
 
   /**
@@ -149,19 +158,21 @@ public:
    */
   bool setElementList(size_t ptId, T nCells, K* data)
   {
-    if(ptId >= m_Size)
+    if(ptId >= m_Array.size())
     {
       return false;
     }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
+    // Reuse the slot in the arena when the new list fits, otherwise give this list its own block
+    if(static_cast<size_t>(nCells) > getCapacity(ptId))
     {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
+      m_Overflow.emplace_back(new K[nCells]);
+      m_Array[ptId].cells = m_Overflow.back().get();
     }
     m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+    if(nCells > 0)
+    {
+      ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
+    }
     return true;
   }
 
@@ -173,22 +184,7 @@ public:
    */
   bool setElementList(size_t ptId, ElementList& list)
   {
-    T nCells = list.ncells;
-    K* data = list.cells;
-    if(ptId >= m_Size)
-    {
-      return false;
-    }
-    if(nullptr != m_Array[ptId].cells && m_Array[ptId].ncells > 0)
-    {
-      m_Array[ptId].cells = nullptr;
-      m_Array[ptId].ncells = 0;
-    }
-    m_Array[ptId].ncells = nCells;
-    // If nCells is huge then there could be problems with this
-    this->m_Array[ptId].cells = new K[nCells];
-    ::memcpy(m_Array[ptId].cells, data, sizeof(K) * nCells);
-    return true;
+    return setElementList(ptId, list.ncells, list.cells);
   }
 
   /**
@@ -198,7 +194,7 @@ public:
    */
   T getNumberOfElements(size_t ptId)
   {
-    return this->m_Array[ptId].ncells;
+    return m_Array[ptId].ncells;
   }
 
   /**
@@ -208,31 +204,18 @@ public:
    */
   K* getElementListPointer(size_t ptId)
   {
-    return this->m_Array[ptId].cells;
+    return m_Array[ptId].cells;
   }
 
   /**
-   * @brief deserializeLinks
+   * @brief deserializeLinks Reads the serialized form written by GeometryHelpers::GeomIO::WriteDynamicListToHDF5,
+   * which is the number of cells (type T) followed by the cells (type K) for each element.
    * @param buffer
    * @param nElements
    */
   void deserializeLinks(QVector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = buffer.data();
-
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    for(size_t i = 0; i < nElements; ++i)
-    {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
-    }
+    deserializeLinks(buffer.data(), static_cast<size_t>(buffer.size()), nElements);
   }
 
   /**
@@ -242,22 +225,7 @@ public:
    */
   void deserializeLinks(std::vector<uint8_t>& buffer, size_t nElements)
   {
-    size_t offset = 0;
-    allocate(nElements); // Allocate all the links with 0 and nullptr;
-    uint8_t* bufPtr = &(buffer.front());
-
-    // Walk the array and allocate all the array links to Zero and nullptr
-    T* ncells = nullptr;
-    // int32_t* cells = nullptr;
-    for(size_t i = 0; i < nElements; ++i)
-    {
-      ncells = reinterpret_cast<T*>(bufPtr + offset);
-      this->m_Array[i].ncells = *ncells; // Set the number of cells in this link
-      offset += 2;
-      this->m_Array[i].cells = new K[(*ncells)];                                // Allocate a new chunk of memory to store the list
-      ::memcpy(this->m_Array[i].cells, bufPtr + offset, (*ncells) * sizeof(K)); // Copy from the buffer into the new list memory
-      offset += (*ncells) * sizeof(K);                                          // Increment the offset
-    }
+    deserializeLinks(buffer.data(), buffer.size(), nElements);
   }
 
   /**
@@ -266,12 +234,7 @@ public:
    */
   void allocateLists(QVector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
-    {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
-    }
+    allocateLists(linkCounts.data(), static_cast<size_t>(linkCounts.size()));
   }
 
   /**
@@ -280,56 +243,119 @@ public:
    */
   void allocateLists(std::vector<T>& linkCounts)
   {
-    allocate(linkCounts.size());
-    for(typename std::vector<T>::size_type i = 0; i < linkCounts.size(); i++)
+    allocateLists(linkCounts.data(), linkCounts.size());
+  }
+
+  /**
+   * @brief setElementLists Replaces all the lists at once from the packed form where the cells of each element
+   * follow each other in the same order as the counts.
+   * @param linkCounts The number of cells of each element
+   * @param cells The cells of all the elements packed back to back
+   */
+  void setElementLists(QVector<T>& linkCounts, const std::vector<K>& cells)
+  {
+    allocateLists(linkCounts);
+    if(!cells.empty())
     {
-      this->m_Array[i].ncells = linkCounts[i];
-      this->m_Array[i].cells = new K[this->m_Array[i].ncells];
+      ::memcpy(m_Arena.get(), cells.data(), sizeof(K) * std::min(cells.size(), m_Offsets.back()));
     }
   }
 
 protected:
-  DynamicListArray()
-  : m_Array(nullptr)
-  , m_Size(0)
+  DynamicListArray() = default;
+
+  /**
+   * @brief allocateLists Sizes the arena to hold all the lists and points each list at its slot. The
+   * contents of the lists are left uninitialized.
+   * @param linkCounts
+   * @param numLists
+   */
+  void allocateLists(const T* linkCounts, size_t numLists)
   {
+    size_t total = 0;
+    for(size_t i = 0; i < numLists; i++)
+    {
+      total += static_cast<size_t>(linkCounts[i]);
+    }
+    m_Overflow.clear();
+    m_Array.resize(numLists);
+    m_Offsets.resize(numLists + 1);
+    m_Arena.reset(total > 0 ? new K[total] : nullptr);
+
+    size_t offset = 0;
+    for(size_t i = 0; i < numLists; i++)
+    {
+      m_Offsets[i] = offset;
+      m_Array[i].ncells = linkCounts[i];
+      m_Array[i].cells = m_Arena.get() + offset;
+      offset += static_cast<size_t>(linkCounts[i]);
+    }
+    m_Offsets[numLists] = offset;
   }
 
-  //----------------------------------------------------------------------------
-  // This will allocate memory to hold all the NeighborList structures where each
-  // structure is initialized to Zero Entries and a nullptr Pointer
-  void allocate(size_t sz, size_t ext = 1000)
+  /**
+   * @brief deserializeLinks Walks the serialized buffer twice: once to size the arena and once to copy each
+   * list into its slot.
+   * @param bufPtr
+   * @param bufSize
+   * @param nElements
+   */
+  void deserializeLinks(const uint8_t* bufPtr, size_t bufSize, size_t nElements)
   {
-    static typename DynamicListArray<T, K>::ElementList linkInit = {0, nullptr};
-
-    // This makes sure we deallocate any lists that have been created
-    for(size_t i = 0; i < this->m_Size; i++)
+    std::vector<T> linkCounts(nElements, 0);
+    std::vector<size_t> listStart(nElements, 0);
+    size_t offset = 0;
+    for(size_t i = 0; i < nElements && offset + sizeof(T) <= bufSize; ++i)
     {
-      if(this->m_Array[i].cells != nullptr)
-      {
-        delete[] this->m_Array[i].cells;
-      }
+      T ncells = 0;
+      ::memcpy(&ncells, bufPtr + offset, sizeof(T));
+      offset += sizeof(T);
+      linkCounts[i] = ncells;
+      listStart[i] = offset;
+      offset += ncells * sizeof(K);
     }
-    // Now delete all the "NeighborLists" structures
-    if(this->m_Array != nullptr)
+    if(offset > bufSize)
     {
-      delete[] this->m_Array;
+      // Truncated buffer; keep the lists empty rather than reading past the end
+      std::fill(linkCounts.begin(), linkCounts.end(), 0);
     }
 
-    this->m_Size = sz;
-    // Allocate a whole new set of structures
-    this->m_Array = new typename DynamicListArray<T, K>::ElementList[sz];
+    allocateLists(linkCounts);
+    for(size_t i = 0; i < nElements; ++i)
+    {
+      if(linkCounts[i] > 0)
+      {
+        ::memcpy(m_Array[i].cells, bufPtr + listStart[i], linkCounts[i] * sizeof(K));
+      }
+    }
+  }
 
-    // Initialize each structure to have 0 entries and nullptr pointer.
-    for(size_t i = 0; i < sz; i++)
+  /**
+   * @brief getCapacity Returns how many cells the list can hold without a new allocation
+   * @param ptId
+   * @return
+   */
+  size_t getCapacity(size_t ptId)
+  {
+    K* arenaSlot = m_Arena.get() + m_Offsets[ptId];
+    if(m_Array[ptId].cells == arenaSlot)
     {
-      this->m_Array[i] = linkInit;
+      return m_Offsets[ptId + 1] - m_Offsets[ptId];
     }
+    return static_cast<size_t>(m_Array[ptId].ncells);
   }
 
 private:
-  ElementList* m_Array; // pointer to data
-  size_t m_Size;
+  std::vector<ElementList> m_Array;
+  std::vector<size_t> m_Offsets;
+  std::unique_ptr<K[]> m_Arena;
+  std::vector<std::unique_ptr<K[]>> m_Overflow;
+
+public:
+  DynamicListArray(const DynamicListArray&) = delete; // Copy Constructor Not Implemented
+  DynamicListArray(DynamicListArray&&) = delete;      // Move Constructor Not Implemented
+  DynamicListArray& operator=(const DynamicListArray&) = delete; // Copy Assignment Not Implemented
+  DynamicListArray& operator=(DynamicListArray&&) = delete;      // Move Assignment Not Implemented
 };
 
 typedef DynamicListArray<int32_t, int32_t> Int32Int32DynamicListArray;
@@ -28,3 +28,55 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
 {
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression)
+{
+  Q_UNUSED(compression)
+  return writeH5Data(parentId, tDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::setLazyLoader(const LazyLoader& loader, const LazyLoadStatistics::Pointer& statistics, const QString& sourceFile)
+{
+  Q_UNUSED(loader)
+  Q_UNUSED(statistics)
+  Q_UNUSED(sourceFile)
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IDataArray::isLazyLoadPending()
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString IDataArray::getLazyLoadSource()
+{
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t IDataArray::resolveLazyLoadNow()
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString IDataArray::takeLazyLoadError()
+{
+  return QString();
+}
@@ -12,6 +12,7 @@
 
 
 //-- C++
+#include <functional>
 #include <vector>
 
 #include <hdf5.h>
@@ -21,9 +22,12 @@
 #include <QtCore/QtDebug>
 
 //SIMPLib Includes
+#include "H5Support/H5DatasetCompression.h"
+
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/LazyLoadStatistics.h"
 
 
 /**
@@ -46,6 +50,12 @@ class SIMPLib_EXPORT IDataArray
     SIMPL_SHARED_POINTERS(IDataArray)
     SIMPL_TYPE_MACRO(IDataArray)
 
+    /**
+     * @brief LazyLoader fills the numBytes bytes at buffer with the payload of an array whose
+     * data is loaded on demand and returns a negative value on failure.
+     */
+    using LazyLoader = std::function<int32_t(void* buffer, size_t numBytes)>;
+
     /**
      * This templated method is used to get at the low level pointer that points
      * to the actual data by testing the conversion with dynamic_cast<> first to
@@ -255,6 +265,17 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims) = 0;
 
+    /**
+     * @brief writeH5Data Writes the array using the dataset chunking/compression
+     * options in @p compression. Array types that do not support custom dataset
+     * layouts fall back to the default writeH5Data() implementation.
+     * @param parentId
+     * @param tDims
+     * @param compression
+     * @return
+     */
+    virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression);
+
     /**
      * @brief readH5Data
      * @param parentId
@@ -262,6 +283,45 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int readH5Data(hid_t parentId) = 0;
 
+    /**
+     * @brief setLazyLoader Defers reading the payload of this array until it is first accessed. The
+     * array must carry its final dimensions and must not be allocated. The loader is called at most
+     * once, from whichever thread touches the data first. Array types that cannot defer their data
+     * return false and the caller is expected to read the data eagerly instead.
+     * @param loader
+     * @param statistics Optional counters that are updated on every access. May be a null pointer.
+     * @param sourceFile Optional path of the file the loader reads from, see getLazyLoadSource()
+     * @return
+     */
+    virtual bool setLazyLoader(const LazyLoader& loader, const LazyLoadStatistics::Pointer& statistics, const QString& sourceFile = QString());
+
+    /**
+     * @brief isLazyLoadPending Returns true if the payload of this array has not been read yet
+     * @return
+     */
+    virtual bool isLazyLoadPending();
+
+    /**
+     * @brief getLazyLoadSource Returns the file a pending load reads from, or an empty string if
+     * no load is pending or the source is unknown. Writers use this to read the payload before they
+     * overwrite that file.
+     * @return
+     */
+    virtual QString getLazyLoadSource();
+
+    /**
+     * @brief resolveLazyLoadNow Reads a pending payload immediately
+     * @return 0 if the data is available (or was never deferred), a negative value if the load failed
+     */
+    virtual int32_t resolveLazyLoadNow();
+
+    /**
+     * @brief takeLazyLoadError Returns the message of a failed load and clears it, so that each
+     * failure is reported once. Returns an empty string if no load has failed.
+     * @return
+     */
+    virtual QString takeLazyLoadError();
+
     /**
      * @brief writeXdmfAttribute
      * @param out
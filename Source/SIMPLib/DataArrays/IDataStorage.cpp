@@ -0,0 +1,191 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IDataStorage.h"
+
+#include <atomic>
+
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/DataArrays/HeapDataStorage.h"
+#include "SIMPLib/DataArrays/MemoryMappedDataStorage.h"
+#include "SIMPLib/DataArrays/PooledDataStorage.h"
+
+namespace
+{
+/**
+ * @brief The OutOfCorePolicy struct holds the process wide out-of-core settings. The
+ * values are initialized from the environment the first time they are needed.
+ */
+struct OutOfCorePolicy
+{
+  OutOfCorePolicy()
+  {
+    bool ok = false;
+    qulonglong thresholdMB = qgetenv("SIMPL_OUT_OF_CORE_THRESHOLD_MB").toULongLong(&ok);
+    if(ok)
+    {
+      Threshold = static_cast<size_t>(thresholdMB) * 1024 * 1024;
+    }
+    ScratchDirectory = QString::fromLocal8Bit(qgetenv("SIMPL_SCRATCH_DIRECTORY"));
+    qulonglong poolLimitKB = qgetenv("SIMPL_POOLED_ALLOCATION_LIMIT_KB").toULongLong(&ok);
+    if(ok)
+    {
+      PooledLimit = static_cast<size_t>(poolLimitKB) * 1024;
+    }
+  }
+
+  std::atomic<size_t> Threshold = {0};
+  std::atomic<size_t> PooledLimit = {0};
+  QMutex Mutex;
+  QString ScratchDirectory;
+};
+
+OutOfCorePolicy& GetPolicy()
+{
+  static OutOfCorePolicy policy;
+  return policy;
+}
+
+std::atomic<uint64_t> s_TotalAllocatedBytes(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataStorage::IDataStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataStorage::~IDataStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataStorage::Pointer IDataStorage::CreateForSize(size_t numBytes)
+{
+  size_t threshold = GetOutOfCoreThreshold();
+  if(threshold > 0 && numBytes >= threshold)
+  {
+    return MemoryMappedDataStorage::New(GetScratchDirectory());
+  }
+  size_t pooledLimit = GetPooledAllocationLimit();
+  if(numBytes <= pooledLimit && numBytes <= PooledDataStorage::MaxPooledSize())
+  {
+    return PooledDataStorage::New();
+  }
+  return HeapDataStorage::New();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStorage::SetOutOfCoreThreshold(size_t numBytes)
+{
+  GetPolicy().Threshold = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IDataStorage::GetOutOfCoreThreshold()
+{
+  return GetPolicy().Threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStorage::SetPooledAllocationLimit(size_t numBytes)
+{
+  GetPolicy().PooledLimit = numBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t IDataStorage::GetPooledAllocationLimit()
+{
+  return GetPolicy().PooledLimit;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStorage::SetScratchDirectory(const QString& path)
+{
+  OutOfCorePolicy& policy = GetPolicy();
+  QMutexLocker locker(&policy.Mutex);
+  policy.ScratchDirectory = path;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString IDataStorage::GetScratchDirectory()
+{
+  OutOfCorePolicy& policy = GetPolicy();
+  QMutexLocker locker(&policy.Mutex);
+  return policy.ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t IDataStorage::GetTotalAllocatedBytes()
+{
+  return s_TotalAllocatedBytes.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStorage::RecordAllocation(size_t numBytes)
+{
+  s_TotalAllocatedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataStorage::RecordReallocation(size_t oldNumBytes, size_t numBytes)
+{
+  if(numBytes > oldNumBytes)
+  {
+    s_TotalAllocatedBytes.fetch_add(numBytes - oldNumBytes, std::memory_order_relaxed);
+  }
+}
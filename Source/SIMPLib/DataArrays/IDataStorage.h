@@ -0,0 +1,177 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @brief The IDataStorage class is the backing store that a DataArray uses to allocate, grow and
+ * release its raw buffer. Every buffer handed out by a storage object is a plain contiguous block of
+ * memory so the DataArray API (getPointer(), getTuplePointer(), ...) is unchanged no matter where the
+ * bytes actually live. A storage object may hand out several buffers at once; each buffer must be
+ * released through the same storage object that created it.
+ *
+ * The static methods control the global out-of-core policy: arrays whose size is at or above the
+ * out-of-core threshold are backed by a MemoryMappedDataStorage in the scratch directory instead of
+ * the heap, and arrays at or below the pooled allocation limit are served by a PooledDataStorage.
+ * The policy can be set from code or through the SIMPL_OUT_OF_CORE_THRESHOLD_MB,
+ * SIMPL_SCRATCH_DIRECTORY and SIMPL_POOLED_ALLOCATION_LIMIT_KB environment variables.
+ */
+class SIMPLib_EXPORT IDataStorage
+{
+public:
+  SIMPL_SHARED_POINTERS(IDataStorage)
+  SIMPL_TYPE_MACRO(IDataStorage)
+
+  virtual ~IDataStorage();
+
+  /**
+   * @brief allocate Creates a new buffer of at least numBytes bytes. The contents are undefined.
+   * @param numBytes
+   * @return The buffer or nullptr if the memory could not be allocated.
+   */
+  virtual void* allocate(size_t numBytes) = 0;
+
+  /**
+   * @brief reallocate Grows or shrinks a buffer created by this object (or creates a new one if
+   * ptr is nullptr). The contents up to the smaller of the two sizes are preserved. On failure the
+   * original buffer is left untouched and nullptr is returned.
+   * @param ptr
+   * @param oldNumBytes The size that ptr was last allocated or reallocated with
+   * @param numBytes
+   * @return
+   */
+  virtual void* reallocate(void* ptr, size_t oldNumBytes, size_t numBytes) = 0;
+
+  /**
+   * @brief deallocate Releases a buffer created by this object.
+   * @param ptr
+   */
+  virtual void deallocate(void* ptr) = 0;
+
+  /**
+   * @brief getStorageType Returns a human readable name of the backend, i.e. "Heap"
+   * @return
+   */
+  virtual QString getStorageType() const = 0;
+
+  /**
+   * @brief CreateForSize Returns the storage that the current out-of-core policy selects for a
+   * buffer of numBytes bytes.
+   * @param numBytes
+   * @return
+   */
+  static Pointer CreateForSize(size_t numBytes);
+
+  /**
+   * @brief SetOutOfCoreThreshold Sets the size in bytes at which new arrays are backed by a memory
+   * mapped scratch file. A value of 0 disables out-of-core storage, which is the default.
+   * @param numBytes
+   */
+  static void SetOutOfCoreThreshold(size_t numBytes);
+
+  /**
+   * @brief GetOutOfCoreThreshold
+   * @return
+   */
+  static size_t GetOutOfCoreThreshold();
+
+  /**
+   * @brief SetPooledAllocationLimit Sets the size in bytes up to which new arrays are served from
+   * the size class pool of PooledDataStorage. The limit is capped at PooledDataStorage::MaxPooledSize().
+   * A value of 0 disables pooling, which is the default.
+   * @param numBytes
+   */
+  static void SetPooledAllocationLimit(size_t numBytes);
+
+  /**
+   * @brief GetPooledAllocationLimit
+   * @return
+   */
+  static size_t GetPooledAllocationLimit();
+
+  /**
+   * @brief SetScratchDirectory Sets the directory where memory mapped scratch files are created.
+   * An empty string selects the system temporary directory.
+   * @param path
+   */
+  static void SetScratchDirectory(const QString& path);
+
+  /**
+   * @brief GetScratchDirectory
+   * @return
+   */
+  static QString GetScratchDirectory();
+
+  /**
+   * @brief GetTotalAllocatedBytes Returns the number of bytes handed out by allocate() of every
+   * storage object since the process started, plus the growth of every reallocate(). Released
+   * buffers are not subtracted, so the difference between two readings is the array memory
+   * requested in between.
+   * @return
+   */
+  static uint64_t GetTotalAllocatedBytes();
+
+protected:
+  IDataStorage();
+
+  /**
+   * @brief RecordAllocation Adds numBytes to the total returned by GetTotalAllocatedBytes(). Backends
+   * call this once for every buffer they hand out.
+   * @param numBytes
+   */
+  static void RecordAllocation(size_t numBytes);
+
+  /**
+   * @brief RecordReallocation Adds the growth from oldNumBytes to numBytes, if any, to the total
+   * returned by GetTotalAllocatedBytes(). Backends call this once for every successful reallocate().
+   * @param oldNumBytes
+   * @param numBytes
+   */
+  static void RecordReallocation(size_t oldNumBytes, size_t numBytes);
+
+public:
+  IDataStorage(const IDataStorage&) = delete; // Copy Constructor Not Implemented
+  IDataStorage(IDataStorage&&) = delete;      // Move Constructor Not Implemented
+  IDataStorage& operator=(const IDataStorage&) = delete; // Copy Assignment Not Implemented
+  IDataStorage& operator=(IDataStorage&&) = delete;      // Move Assignment Not Implemented
+};
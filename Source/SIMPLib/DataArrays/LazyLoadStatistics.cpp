@@ -0,0 +1,151 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "LazyLoadStatistics.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyLoadStatistics::LazyLoadStatistics()
+: m_RegisteredArrays(0)
+, m_Hits(0)
+, m_Misses(0)
+, m_BytesLoaded(0)
+, m_HasFailures(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyLoadStatistics::~LazyLoadStatistics() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LazyLoadStatistics::addArray()
+{
+  m_RegisteredArrays.fetch_add(1, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LazyLoadStatistics::recordHit()
+{
+  m_Hits.fetch_add(1, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LazyLoadStatistics::recordMiss(size_t numBytes)
+{
+  m_Misses.fetch_add(1, std::memory_order_relaxed);
+  m_BytesLoaded.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LazyLoadStatistics::recordFailure(const QString& message)
+{
+  std::lock_guard<std::mutex> lock(m_FailuresMutex);
+  m_Failures.push_back(message);
+  m_HasFailures = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList LazyLoadStatistics::takeFailures()
+{
+  // Checked after every filter, so the common case must not take the lock
+  if(!m_HasFailures.load(std::memory_order_acquire))
+  {
+    return QStringList();
+  }
+  std::lock_guard<std::mutex> lock(m_FailuresMutex);
+  QStringList failures;
+  failures.swap(m_Failures);
+  m_HasFailures = false;
+  return failures;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LazyLoadStatistics::reset()
+{
+  m_RegisteredArrays = 0;
+  m_Hits = 0;
+  m_Misses = 0;
+  m_BytesLoaded = 0;
+  std::lock_guard<std::mutex> lock(m_FailuresMutex);
+  m_Failures.clear();
+  m_HasFailures = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LazyLoadStatistics::getRegisteredArrayCount() const
+{
+  return m_RegisteredArrays.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LazyLoadStatistics::getHitCount() const
+{
+  return m_Hits.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LazyLoadStatistics::getMissCount() const
+{
+  return m_Misses.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LazyLoadStatistics::getBytesLoaded() const
+{
+  return m_BytesLoaded.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,139 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <QtCore/QStringList>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @brief The LazyLoadStatistics class counts how the arrays that were registered for on-demand
+ * loading are used. A miss is the first access to an array, which reads its payload from the
+ * file; every later getPointer()/getVoidPointer() call on the loaded array is a hit. Arrays that
+ * are never touched are never read and only show up in the registered count. Loads that fail are
+ * recorded when they happen so that they can be reported without visiting every array. The counters
+ * are updated atomically so arrays may be loaded from several threads at once.
+ */
+class SIMPLib_EXPORT LazyLoadStatistics
+{
+public:
+  SIMPL_SHARED_POINTERS(LazyLoadStatistics)
+  SIMPL_STATIC_NEW_MACRO(LazyLoadStatistics)
+  SIMPL_TYPE_MACRO(LazyLoadStatistics)
+
+  virtual ~LazyLoadStatistics();
+
+  /**
+   * @brief addArray Counts an array whose payload is deferred until first access
+   */
+  void addArray();
+
+  /**
+   * @brief recordHit Counts an access to an array whose payload was already loaded
+   */
+  void recordHit();
+
+  /**
+   * @brief recordMiss Counts an access that had to read the payload from the file
+   * @param numBytes The number of bytes that were read
+   */
+  void recordMiss(size_t numBytes);
+
+  /**
+   * @brief recordFailure Keeps the message of a load that failed until takeFailures() is called
+   * @param message
+   */
+  void recordFailure(const QString& message);
+
+  /**
+   * @brief takeFailures Returns the messages of the loads that failed since the last call and clears them
+   * @return
+   */
+  QStringList takeFailures();
+
+  /**
+   * @brief reset Sets all counters back to zero
+   */
+  void reset();
+
+  /**
+   * @brief getRegisteredArrayCount
+   * @return
+   */
+  size_t getRegisteredArrayCount() const;
+
+  /**
+   * @brief getHitCount
+   * @return
+   */
+  size_t getHitCount() const;
+
+  /**
+   * @brief getMissCount Returns the number of arrays that have been read so far
+   * @return
+   */
+  size_t getMissCount() const;
+
+  /**
+   * @brief getBytesLoaded
+   * @return
+   */
+  size_t getBytesLoaded() const;
+
+protected:
+  LazyLoadStatistics();
+
+private:
+  std::atomic<size_t> m_RegisteredArrays;
+  std::atomic<size_t> m_Hits;
+  std::atomic<size_t> m_Misses;
+  std::atomic<size_t> m_BytesLoaded;
+  std::atomic<bool> m_HasFailures;
+  std::mutex m_FailuresMutex;
+  QStringList m_Failures;
+
+public:
+  LazyLoadStatistics(const LazyLoadStatistics&) = delete; // Copy Constructor Not Implemented
+  LazyLoadStatistics(LazyLoadStatistics&&) = delete;      // Move Constructor Not Implemented
+  LazyLoadStatistics& operator=(const LazyLoadStatistics&) = delete; // Copy Assignment Not Implemented
+  LazyLoadStatistics& operator=(LazyLoadStatistics&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,196 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "MemoryMappedDataStorage.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QtCore/QDir>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QtDebug>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryMappedDataStorage::MemoryMappedDataStorage(const QString& scratchDirectory)
+: m_ScratchDirectory(scratchDirectory)
+{
+  if(m_ScratchDirectory.isEmpty())
+  {
+    m_ScratchDirectory = QDir::tempPath();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryMappedDataStorage::~MemoryMappedDataStorage()
+{
+  // Any buffer that was not released is unmapped and its scratch file removed here
+  for(auto& buffer : m_Buffers)
+  {
+    buffer.second->unmap(static_cast<uchar*>(buffer.first));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MemoryMappedDataStorage::allocate(size_t numBytes)
+{
+  void* ptr = mapScratchFile(numBytes);
+  if(nullptr != ptr)
+  {
+    RecordAllocation(numBytes);
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MemoryMappedDataStorage::mapScratchFile(size_t numBytes)
+{
+  if(numBytes == 0)
+  {
+    return nullptr;
+  }
+
+  ScratchFilePtr file(new QTemporaryFile(m_ScratchDirectory + QDir::separator() + "SIMPL_DataArray_XXXXXX.dat"));
+  if(!file->open())
+  {
+    qDebug() << "Unable to create the scratch file in " << m_ScratchDirectory << ": " << file->errorString();
+    return nullptr;
+  }
+  if(!file->resize(static_cast<qint64>(numBytes)))
+  {
+    qDebug() << "Unable to resize the scratch file " << file->fileName() << " to " << numBytes << " bytes: " << file->errorString();
+    return nullptr;
+  }
+  uchar* ptr = file->map(0, static_cast<qint64>(numBytes));
+  if(nullptr == ptr)
+  {
+    qDebug() << "Unable to map the scratch file " << file->fileName() << ": " << file->errorString();
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(m_BuffersMutex);
+  m_Buffers[ptr] = std::move(file);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MemoryMappedDataStorage::reallocate(void* ptr, size_t oldNumBytes, size_t numBytes)
+{
+  if(nullptr == ptr)
+  {
+    return allocate(numBytes);
+  }
+  if(numBytes == 0)
+  {
+    deallocate(ptr);
+    return nullptr;
+  }
+  qint64 oldSize = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_BuffersMutex);
+    auto iter = m_Buffers.find(ptr);
+    if(iter == m_Buffers.end())
+    {
+      return nullptr;
+    }
+    oldSize = iter->second->size();
+  }
+
+  // Map a second scratch file and copy the contents over. The original mapping is only released
+  // once the new one exists, so on failure the caller's pointer stays valid as the interface requires.
+  void* newPtr = mapScratchFile(numBytes);
+  if(nullptr == newPtr)
+  {
+    return nullptr;
+  }
+  std::memcpy(newPtr, ptr, std::min(static_cast<size_t>(oldSize), numBytes));
+  deallocate(ptr);
+  RecordReallocation(oldNumBytes, numBytes);
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MemoryMappedDataStorage::deallocate(void* ptr)
+{
+  std::lock_guard<std::mutex> lock(m_BuffersMutex);
+  auto iter = m_Buffers.find(ptr);
+  if(iter == m_Buffers.end())
+  {
+    return;
+  }
+  iter->second->unmap(static_cast<uchar*>(ptr));
+  // Destroying the QTemporaryFile removes the scratch file from the disk
+  m_Buffers.erase(iter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MemoryMappedDataStorage::getStorageType() const
+{
+  return QString("MemoryMapped");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MemoryMappedDataStorage::getScratchDirectory() const
+{
+  return m_ScratchDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString MemoryMappedDataStorage::getScratchFilePath(void* ptr) const
+{
+  std::lock_guard<std::mutex> lock(m_BuffersMutex);
+  auto iter = m_Buffers.find(ptr);
+  if(iter == m_Buffers.end())
+  {
+    return QString();
+  }
+  return iter->second->fileName();
+}
@@ -0,0 +1,120 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataStorage.h"
+
+class QTemporaryFile;
+
+/**
+ * @brief The MemoryMappedDataStorage class backs each buffer with its own temporary scratch file
+ * that is mapped into the address space of the process. The operating system pages the data in
+ * and out of the file as needed so the total size of all arrays is limited by the free disk space
+ * in the scratch directory instead of by the physical memory. The scratch files are removed when
+ * the buffer is released. One instance may serve arrays on several threads.
+ */
+class SIMPLib_EXPORT MemoryMappedDataStorage : public IDataStorage
+{
+public:
+  SIMPL_SHARED_POINTERS(MemoryMappedDataStorage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(MemoryMappedDataStorage, IDataStorage)
+
+  /**
+   * @brief New
+   * @param scratchDirectory The directory for the scratch files. An empty string uses the system
+   * temporary directory.
+   * @return
+   */
+  static Pointer New(const QString& scratchDirectory = QString())
+  {
+    Pointer sharedPtr(new MemoryMappedDataStorage(scratchDirectory));
+    return sharedPtr;
+  }
+
+  ~MemoryMappedDataStorage() override;
+
+  void* allocate(size_t numBytes) override;
+
+  void* reallocate(void* ptr, size_t oldNumBytes, size_t numBytes) override;
+
+  void deallocate(void* ptr) override;
+
+  QString getStorageType() const override;
+
+  /**
+   * @brief getScratchDirectory
+   * @return
+   */
+  QString getScratchDirectory() const;
+
+  /**
+   * @brief getScratchFilePath Returns the path of the scratch file that backs the buffer or
+   * an empty string if the buffer was not created by this object.
+   * @param ptr
+   * @return
+   */
+  QString getScratchFilePath(void* ptr) const;
+
+protected:
+  MemoryMappedDataStorage(const QString& scratchDirectory);
+
+private:
+  using ScratchFilePtr = std::unique_ptr<QTemporaryFile>;
+
+  /**
+   * @brief mapScratchFile Creates and maps a scratch file of numBytes bytes without counting it
+   * @param numBytes
+   * @return
+   */
+  void* mapScratchFile(size_t numBytes);
+
+  QString m_ScratchDirectory;
+  std::map<void*, ScratchFilePtr> m_Buffers;
+  mutable std::mutex m_BuffersMutex;
+
+public:
+  MemoryMappedDataStorage(const MemoryMappedDataStorage&) = delete; // Copy Constructor Not Implemented
+  MemoryMappedDataStorage(MemoryMappedDataStorage&&) = delete;      // Move Constructor Not Implemented
+  MemoryMappedDataStorage& operator=(const MemoryMappedDataStorage&) = delete; // Copy Assignment Not Implemented
+  MemoryMappedDataStorage& operator=(MemoryMappedDataStorage&&) = delete;      // Move Assignment Not Implemented
+};
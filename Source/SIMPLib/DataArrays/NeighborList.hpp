@@ -630,6 +630,19 @@ class NeighborList : public IDataArray
      * @return
      */
     int writeH5Data(hid_t parentId, QVector<size_t> tDims) override
+    {
+      return writeH5Data(parentId, tDims, H5DatasetCompression());
+    }
+
+    /**
+     * @brief writeH5Data Writes the flattened list data and the NumNeighbors array
+     * using the chunking and compression options in @p compression.
+     * @param parentId
+     * @param tDims
+     * @param compression
+     * @return
+     */
+    int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression) override
     {
       int err = 0;
 
@@ -652,7 +665,7 @@ class NeighborList : public IDataArray
       if (QH5Lite::datasetExists(parentId, m_NumNeighborsArrayName) == false)
       {
         // The NumNeighbors Array is NOT already in the file so write it to the file
-        numNeighborsPtr->writeH5Data(parentId, tDims);
+        numNeighborsPtr->writeH5Data(parentId, tDims, compression);
       }
       else
       {
@@ -683,7 +696,7 @@ class NeighborList : public IDataArray
       // the top of the function versus what is in memory
       if(rewrite == true)
       {
-        numNeighborsPtr->writeH5Data(parentId, tDims);
+        numNeighborsPtr->writeH5Data(parentId, tDims, compression);
       }
 
       // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
@@ -708,7 +721,7 @@ class NeighborList : public IDataArray
       hsize_t dims[1] = { total };
       if (total > 0)
       {
-        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, &(flat.front()));
+        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, &(flat.front()), compression);
         if(err < 0)
         {
           return -605;
@@ -0,0 +1,281 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PooledDataStorage.h"
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief The BlockHeader struct sits in front of every buffer. Its size keeps the buffer aligned
+ * the same way malloc() aligns its blocks.
+ */
+struct alignas(16) BlockHeader
+{
+  size_t NumBytes;  // Usable bytes behind the header
+  size_t SizeClass; // Index into the free lists or k_Unpooled
+};
+
+const size_t k_MinClassShift = 6;  // 64 bytes
+const size_t k_NumSizeClasses = 11; // 64 bytes ... 64 KiB
+const size_t k_Unpooled = static_cast<size_t>(-1);
+const size_t k_MaxCachedBytesPerClass = 4 * 1024 * 1024;
+
+size_t ClassBlockSize(size_t sizeClass)
+{
+  return static_cast<size_t>(1) << (sizeClass + k_MinClassShift);
+}
+
+/**
+ * @brief SizeClassFor Returns the smallest size class whose blocks fit numBytes plus the header
+ */
+size_t SizeClassFor(size_t numBytes)
+{
+  size_t total = numBytes + sizeof(BlockHeader);
+  for(size_t c = 0; c < k_NumSizeClasses; c++)
+  {
+    if(total <= ClassBlockSize(c))
+    {
+      return c;
+    }
+  }
+  return k_Unpooled;
+}
+
+/**
+ * @brief The BlockPool struct holds the process wide free lists
+ */
+struct BlockPool
+{
+  void releaseAll()
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    for(std::vector<void*>& freeList : FreeLists)
+    {
+      for(void* block : freeList)
+      {
+        free(block);
+      }
+      freeList.clear();
+    }
+    CachedBytes = 0;
+  }
+
+  std::mutex Mutex;
+  std::array<std::vector<void*>, k_NumSizeClasses> FreeLists;
+  size_t CachedBytes = 0;
+};
+
+BlockPool& GetPool()
+{
+  // Never destroyed so that arrays released during static destruction still find the pool
+  static BlockPool* pool = new BlockPool;
+  return *pool;
+}
+
+BlockHeader* HeaderOf(void* ptr)
+{
+  return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) - sizeof(BlockHeader));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PooledDataStorage::PooledDataStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PooledDataStorage::~PooledDataStorage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* PooledDataStorage::allocate(size_t numBytes)
+{
+  void* ptr = allocateBlock(numBytes);
+  if(nullptr != ptr)
+  {
+    RecordAllocation(numBytes);
+  }
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* PooledDataStorage::allocateBlock(size_t numBytes)
+{
+  size_t sizeClass = SizeClassFor(numBytes);
+  void* block = nullptr;
+  if(sizeClass == k_Unpooled)
+  {
+    block = malloc(numBytes + sizeof(BlockHeader));
+  }
+  else
+  {
+    BlockPool& pool = GetPool();
+    {
+      std::lock_guard<std::mutex> lock(pool.Mutex);
+      std::vector<void*>& freeList = pool.FreeLists[sizeClass];
+      if(!freeList.empty())
+      {
+        block = freeList.back();
+        freeList.pop_back();
+        pool.CachedBytes -= ClassBlockSize(sizeClass);
+      }
+    }
+    if(nullptr == block)
+    {
+      block = malloc(ClassBlockSize(sizeClass));
+    }
+  }
+  if(nullptr == block)
+  {
+    return nullptr;
+  }
+
+  BlockHeader* header = static_cast<BlockHeader*>(block);
+  header->NumBytes = (sizeClass == k_Unpooled) ? numBytes : ClassBlockSize(sizeClass) - sizeof(BlockHeader);
+  header->SizeClass = sizeClass;
+  return header + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* PooledDataStorage::reallocate(void* ptr, size_t oldNumBytes, size_t numBytes)
+{
+  if(nullptr == ptr)
+  {
+    return allocate(numBytes);
+  }
+
+  BlockHeader* header = HeaderOf(ptr);
+  if(header->SizeClass != k_Unpooled && numBytes <= header->NumBytes && SizeClassFor(numBytes) == header->SizeClass)
+  {
+    // Still the best fitting size class
+    RecordReallocation(oldNumBytes, numBytes);
+    return ptr;
+  }
+  if(header->SizeClass == k_Unpooled && SizeClassFor(numBytes) == k_Unpooled)
+  {
+    BlockHeader* newHeader = static_cast<BlockHeader*>(realloc(header, numBytes + sizeof(BlockHeader)));
+    if(nullptr == newHeader)
+    {
+      return nullptr;
+    }
+    newHeader->NumBytes = numBytes;
+    RecordReallocation(oldNumBytes, numBytes);
+    return newHeader + 1;
+  }
+
+  // Moving between a size class and the heap (or between size classes)
+  void* newPtr = allocateBlock(numBytes);
+  if(nullptr == newPtr)
+  {
+    return nullptr;
+  }
+  std::memcpy(newPtr, ptr, (numBytes < header->NumBytes) ? numBytes : header->NumBytes);
+  deallocate(ptr);
+  RecordReallocation(oldNumBytes, numBytes);
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PooledDataStorage::deallocate(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return;
+  }
+  BlockHeader* header = HeaderOf(ptr);
+  size_t sizeClass = header->SizeClass;
+  if(sizeClass != k_Unpooled)
+  {
+    BlockPool& pool = GetPool();
+    std::lock_guard<std::mutex> lock(pool.Mutex);
+    std::vector<void*>& freeList = pool.FreeLists[sizeClass];
+    if((freeList.size() + 1) * ClassBlockSize(sizeClass) <= k_MaxCachedBytesPerClass)
+    {
+      freeList.push_back(header);
+      pool.CachedBytes += ClassBlockSize(sizeClass);
+      return;
+    }
+  }
+  free(header);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PooledDataStorage::getStorageType() const
+{
+  return QString("Pooled");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PooledDataStorage::MaxPooledSize()
+{
+  return ClassBlockSize(k_NumSizeClasses - 1) - sizeof(BlockHeader);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PooledDataStorage::GetCachedBytes()
+{
+  BlockPool& pool = GetPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  return pool.CachedBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PooledDataStorage::ReleaseCachedBlocks()
+{
+  GetPool().releaseAll();
+}
@@ -0,0 +1,99 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/IDataStorage.h"
+
+/**
+ * @brief The PooledDataStorage class serves small buffers from a process wide set of size classes
+ * (powers of two from 64 bytes up to MaxPooledSize()) and keeps released blocks on per class free
+ * lists for reuse, which takes the many short lived temporary arrays that filters create off the
+ * system allocator. Requests that are larger than the biggest size class go to the heap. Every
+ * buffer carries a small header that records its size class, so a PooledDataStorage object can
+ * release buffers created by any other PooledDataStorage object.
+ */
+class SIMPLib_EXPORT PooledDataStorage : public IDataStorage
+{
+public:
+  SIMPL_SHARED_POINTERS(PooledDataStorage)
+  SIMPL_STATIC_NEW_MACRO(PooledDataStorage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(PooledDataStorage, IDataStorage)
+
+  ~PooledDataStorage() override;
+
+  void* allocate(size_t numBytes) override;
+
+  void* reallocate(void* ptr, size_t oldNumBytes, size_t numBytes) override;
+
+  void deallocate(void* ptr) override;
+
+  QString getStorageType() const override;
+
+  /**
+   * @brief MaxPooledSize Returns the largest request in bytes that is served from a size class
+   * @return
+   */
+  static size_t MaxPooledSize();
+
+  /**
+   * @brief GetCachedBytes Returns the number of bytes currently held on the free lists
+   * @return
+   */
+  static size_t GetCachedBytes();
+
+  /**
+   * @brief ReleaseCachedBlocks Returns every block on the free lists to the system
+   */
+  static void ReleaseCachedBlocks();
+
+protected:
+  PooledDataStorage();
+
+private:
+  /**
+   * @brief allocateBlock Takes a block from the free lists or the heap without counting it
+   * @param numBytes
+   * @return
+   */
+  void* allocateBlock(size_t numBytes);
+
+public:
+  PooledDataStorage(const PooledDataStorage&) = delete; // Copy Constructor Not Implemented
+  PooledDataStorage(PooledDataStorage&&) = delete;      // Move Constructor Not Implemented
+  PooledDataStorage& operator=(const PooledDataStorage&) = delete; // Copy Assignment Not Implemented
+  PooledDataStorage& operator=(PooledDataStorage&&) = delete;      // Move Assignment Not Implemented
+};
@@ -3,10 +3,16 @@ set(SUBDIR_NAME DataArrays)
 
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CSRNeighborList.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/HeapDataStorage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataStorage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/LazyLoadStatistics.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryMappedDataStorage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PooledDataStorage.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StructArray.hpp
@@ -14,8 +20,13 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/HeapDataStorage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataStorage.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/LazyLoadStatistics.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryMappedDataStorage.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PooledDataStorage.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.cpp
 )
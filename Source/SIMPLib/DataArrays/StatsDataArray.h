@@ -321,6 +321,10 @@ class SIMPLib_EXPORT StatsDataArray : public IDataArray
      */
     void printComponent(QTextStream& out, size_t i, int j) override;
 
+    // The statistics are written as a tree of groups with many small datasets, which gain nothing
+    // from chunking, so the compressed variant keeps the base class fallback to writeH5Data() below
+    using IDataArray::writeH5Data;
+
     /**
      *
      * @param parentId
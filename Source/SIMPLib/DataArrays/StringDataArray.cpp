@@ -34,9 +34,22 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "StringDataArray.h"
 
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 
+namespace
+{
+const char k_EmptyCString[] = "";
+
+// Compacting is skipped while the unused part of the buffer is this small
+const size_t k_MinGarbageToCompact = 4096;
+} // namespace
+
+const size_t StringDataArray::k_EmptyString = std::numeric_limits<size_t>::max();
 
 // -----------------------------------------------------------------------------
 //
@@ -56,7 +69,7 @@ StringDataArray::StringDataArray(size_t numTuples, const QString name, bool allo
 {
   // if (allocate == true)
   {
-    m_Array.resize(numTuples);
+    m_Offsets.assign(numTuples, k_EmptyString);
   }
 }
 
@@ -197,7 +210,7 @@ void StringDataArray::releaseOwnership()
 // -----------------------------------------------------------------------------
 void* StringDataArray::getVoidPointer(size_t i)
 {
-  return static_cast<void*>(&(m_Array[i]));
+  return static_cast<void*>(const_cast<char*>(getCString(i)));
 }
 
 // -----------------------------------------------------------------------------
@@ -205,7 +218,7 @@ void* StringDataArray::getVoidPointer(size_t i)
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getNumberOfTuples()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -213,7 +226,7 @@ size_t StringDataArray::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 size_t StringDataArray::getSize()
 {
-  return m_Array.size();
+  return m_Offsets.size();
 }
 
 // -----------------------------------------------------------------------------
@@ -278,34 +291,31 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
 
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
+  std::vector<bool> erase(m_Offsets.size(), false);
   for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
   {
-    if(idxs[i] >= static_cast<size_t>(m_Array.size()))
+    if(idxs[i] >= m_Offsets.size())
     {
       return -100;
     }
+    erase[idxs[i]] = true;
   }
 
-  // Create a new Array to copy into
-  std::vector<QString> newArray;
-  std::vector<size_t>::size_type start = 0;
-  for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+  // Only the offsets move; the erased strings become garbage in the buffer
+  size_t j = 0;
+  for(size_t i = 0; i < m_Offsets.size(); ++i)
   {
-    bool keep = true;
-    for(QVector<size_t>::size_type j = start; j < idxs.size(); ++j)
+    if(erase[i])
     {
-      if(static_cast<size_t>(i) == idxs[j])
-      {
-        keep = false;
-        break;
-      }
+      releaseString(i);
     }
-    if(keep)
+    else
     {
-      newArray.push_back(m_Array[i]);
+      m_Offsets[j++] = m_Offsets[i];
     }
   }
-  m_Array = newArray;
+  m_Offsets.resize(j);
+  compactIfNeeded();
   return err;
 }
 
@@ -314,16 +324,18 @@ int StringDataArray::eraseTuples(QVector<size_t>& idxs)
 // -----------------------------------------------------------------------------
 int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 {
-  if(currentPos >= m_Array.size())
+  if(currentPos >= m_Offsets.size())
   {
     return -1;
   }
-  if(newPos >= m_Array.size())
+  if(newPos >= m_Offsets.size())
   {
     return -1;
   }
-  // QString s = m_Array[currentPos];
-  m_Array[newPos] = m_Array[currentPos];
+  if(currentPos != newPos)
+  {
+    setCString(newPos, getCString(currentPos));
+  }
   return 0;
 }
 
@@ -332,7 +344,7 @@ int StringDataArray::copyTuple(size_t currentPos, size_t newPos)
 // -----------------------------------------------------------------------------
 bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
 {
-  if(destTupleOffset >= m_Array.size())
+  if(destTupleOffset >= m_Offsets.size())
   {
     return false;
   }
@@ -347,14 +359,14 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
   {
     return false;
   }
-  if(totalSrcTuples + destTupleOffset > m_Array.size())
+  if(totalSrcTuples + destTupleOffset > m_Offsets.size())
   {
     return false;
   }
 
-  for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
+  for(size_t i = 0; i < totalSrcTuples; i++)
   {
-    m_Array[destTupleOffset + i] = source->getValue(i);
+    setCString(destTupleOffset + i, source->getCString(srcTupleOffset + i));
   }
   return true;
 }
@@ -364,7 +376,7 @@ bool StringDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeTuple(size_t pos, void* value)
 {
-  m_Array[pos] = *(reinterpret_cast<QString*>(value));
+  setValue(pos, *(reinterpret_cast<QString*>(value)));
 }
 
 // -----------------------------------------------------------------------------
@@ -372,7 +384,9 @@ void StringDataArray::initializeTuple(size_t pos, void* value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithZeros()
 {
-  m_Array.assign(m_Array.size(), QString(""));
+  m_Buffer.clear();
+  m_Offsets.assign(m_Offsets.size(), k_EmptyString);
+  m_Garbage = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -380,7 +394,7 @@ void StringDataArray::initializeWithZeros()
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(QString value)
 {
-  m_Array.assign(m_Array.size(), value);
+  initializeWithValue(value.toStdString());
 }
 
 // -----------------------------------------------------------------------------
@@ -388,7 +402,20 @@ void StringDataArray::initializeWithValue(QString value)
 // -----------------------------------------------------------------------------
 void StringDataArray::initializeWithValue(const std::string& value)
 {
-  m_Array.assign(m_Array.size(), QString::fromStdString(value));
+  initializeWithZeros();
+  if(value.empty() || m_Offsets.empty())
+  {
+    return;
+  }
+  // Every tuple gets its own copy so that the unused bytes in the buffer stay exact
+  size_t length = ::strnlen(value.c_str(), value.size());
+  m_Buffer.resize(m_Offsets.size() * (length + 1));
+  for(size_t i = 0; i < m_Offsets.size(); i++)
+  {
+    m_Offsets[i] = i * (length + 1);
+    ::memcpy(m_Buffer.data() + m_Offsets[i], value.c_str(), length);
+    m_Buffer[m_Offsets[i] + length] = '\0';
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -399,10 +426,9 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
   StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName());
   if(!forceNoAllocate)
   {
-    for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-    {
-      daCopy->setValue(i, m_Array[i]);
-    }
+    daCopy->m_Buffer = m_Buffer;
+    daCopy->m_Offsets = m_Offsets;
+    daCopy->m_Garbage = m_Garbage;
   }
   return daCopy;
 }
@@ -412,7 +438,12 @@ IDataArray::Pointer StringDataArray::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resizeTotalElements(size_t size)
 {
-  m_Array.resize(size);
+  for(size_t i = size; i < m_Offsets.size(); i++)
+  {
+    releaseString(i);
+  }
+  m_Offsets.resize(size, k_EmptyString);
+  compactIfNeeded();
   return 1;
 }
 
@@ -421,8 +452,7 @@ int32_t StringDataArray::resizeTotalElements(size_t size)
 // -----------------------------------------------------------------------------
 int32_t StringDataArray::resize(size_t numTuples)
 {
-  m_Array.resize(numTuples);
-  return 1;
+  return resizeTotalElements(numTuples);
 }
 
 // -----------------------------------------------------------------------------
@@ -430,9 +460,11 @@ int32_t StringDataArray::resize(size_t numTuples)
 // -----------------------------------------------------------------------------
 void StringDataArray::initialize()
 {
-  if(!m_Array.empty())
+  if(!m_Offsets.empty())
   {
-    m_Array.clear();
+    m_Offsets.clear();
+    m_Buffer.clear();
+    m_Garbage = 0;
     this->_ownsData = true;
   }
 }
@@ -442,7 +474,7 @@ void StringDataArray::initialize()
 // -----------------------------------------------------------------------------
 void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -450,7 +482,7 @@ void StringDataArray::printTuple(QTextStream& out, size_t i, char delimiter)
 // -----------------------------------------------------------------------------
 void StringDataArray::printComponent(QTextStream& out, size_t i, int j)
 {
-  out << m_Array[i];
+  out << getValue(i);
 }
 
 // -----------------------------------------------------------------------------
@@ -466,7 +498,16 @@ QString StringDataArray::getFullNameOfClass()
 // -----------------------------------------------------------------------------
 int StringDataArray::writeH5Data(hid_t parentId, QVector<size_t> tDims)
 {
-  return H5DataArrayWriter::writeStringDataArray<StringDataArray>(parentId, this);
+  return writeH5Data(parentId, tDims, H5DatasetCompression());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int StringDataArray::writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression)
+{
+  Q_UNUSED(tDims)
+  return H5DataArrayWriter::writeStringDataArray<StringDataArray>(parentId, this, compression);
 }
 
 // -----------------------------------------------------------------------------
@@ -514,42 +555,141 @@ int StringDataArray::readH5Data(hid_t parentId)
 {
   int err = 0;
   this->resize(0);
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), buffer, offsets);
+  setPackedStrings(std::move(buffer), std::move(offsets));
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setValue(size_t i, const QString& value)
+{
+  QByteArray utf8 = value.toUtf8();
+  setCString(i, utf8.constData());
+}
 
-  m_Array.resize(strings.size());
-  for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString StringDataArray::getValue(size_t i)
+{
+  if(i >= m_Offsets.size())
   {
-    m_Array[i] = QString::fromStdString(strings[i]);
+    throw std::out_of_range("StringDataArray::getValue index is out of range");
   }
-#if 0
-  IDataArray::Pointer p = H5DataArrayReader::ReadStringDataArray(parentId, getName());
-  if (p.get() == nullptr)
+  return QString::fromUtf8(getCString(i));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const char* StringDataArray::getCString(size_t i) const
+{
+  size_t offset = m_Offsets[i];
+  return (offset == k_EmptyString) ? k_EmptyCString : m_Buffer.data() + offset;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setCString(size_t i, const char* value)
+{
+  size_t length = ::strlen(value);
+  size_t offset = (length == 0) ? k_EmptyString : appendString(value, length);
+  releaseString(i);
+  m_Offsets[i] = offset;
+  compactIfNeeded();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<const char*> StringDataArray::getCStrings() const
+{
+  std::vector<const char*> strings(m_Offsets.size());
+  for(size_t i = 0; i < m_Offsets.size(); i++)
   {
-    return -1;
+    strings[i] = getCString(i);
   }
-  StringDataArray::Pointer srcPtr = std::dynamic_pointer_cast<StringDataArray>(p);
-  size_t count = srcPtr->getNumberOfTuples();
-  for (size_t i = 0; i < count; ++i)
+  return strings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StringDataArray::setPackedStrings(std::vector<char> buffer, std::vector<size_t> offsets)
+{
+  m_Buffer = std::move(buffer);
+  m_Offsets = std::move(offsets);
+  m_Garbage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StringDataArray::appendString(const char* value, size_t length)
+{
+  // The value may live inside our own buffer (copyTuple) so remember where it is
+  // before the buffer is allowed to reallocate
+  const char* begin = m_Buffer.data();
+  bool isInternal = !m_Buffer.empty() && value >= begin && value < begin + m_Buffer.size();
+  size_t internalOffset = isInternal ? static_cast<size_t>(value - begin) : 0;
+
+  size_t offset = m_Buffer.size();
+  m_Buffer.resize(offset + length + 1);
+  if(isInternal)
   {
-    m_Array.push_back( srcPtr->getValue(i) );
+    value = m_Buffer.data() + internalOffset;
   }
-#endif
-  return err;
+  ::memcpy(m_Buffer.data() + offset, value, length);
+  m_Buffer[offset + length] = '\0';
+  return offset;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void StringDataArray::setValue(size_t i, const QString& value)
+void StringDataArray::releaseString(size_t i)
 {
-  m_Array[i] = value;
+  if(m_Offsets[i] != k_EmptyString)
+  {
+    m_Garbage += ::strlen(m_Buffer.data() + m_Offsets[i]) + 1;
+    m_Offsets[i] = k_EmptyString;
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QString StringDataArray::getValue(size_t i)
+void StringDataArray::compactIfNeeded()
 {
-  return m_Array.at(i);
+  if(m_Offsets.empty())
+  {
+    m_Buffer.clear();
+    m_Garbage = 0;
+    return;
+  }
+  if(m_Garbage < k_MinGarbageToCompact || m_Garbage * 2 < m_Buffer.size())
+  {
+    return;
+  }
+
+  std::vector<char> buffer;
+  buffer.reserve(m_Buffer.size() - m_Garbage);
+  for(size_t& offset : m_Offsets)
+  {
+    if(offset == k_EmptyString)
+    {
+      continue;
+    }
+    const char* value = m_Buffer.data() + offset;
+    size_t length = ::strlen(value);
+    offset = buffer.size();
+    buffer.insert(buffer.end(), value, value + length + 1);
+  }
+  m_Buffer.swap(buffer);
+  m_Garbage = 0;
 }
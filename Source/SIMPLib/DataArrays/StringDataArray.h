@@ -48,7 +48,15 @@
 
 /**
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
- * @brief Stores an array of QString objects
+ * @brief Stores an array of strings.
+ *
+ * The strings are kept UTF-8 encoded and NUL terminated in a single packed buffer
+ * together with the offset of each string, which lets the whole array be handed
+ * to HDF5 (or any other C style consumer) without a per string conversion.
+ *
+ * Every write may grow or compact the shared buffer, so unlike DataArray<T> no two
+ * tuples may be written concurrently, not even distinct ones. Reading from several
+ * threads is safe while nobody writes.
  *
  * @date Nov 13, 2012
  * @version 1.0
@@ -164,11 +172,11 @@ public:
    */
   void releaseOwnership() override;
   /**
-   * @brief Returns a void pointer pointing to the index of the array. nullptr
-   * pointers are entirely possible. No checks are performed to make sure
-   * the index is with in the range of the internal data array.
+   * @brief Returns a pointer to the NUL terminated UTF-8 string at the index. The
+   * string must be treated as read only; use setValue() to change it. No checks
+   * are performed to make sure the index is with in the range of the internal data array.
    * @param i The index to have the returned pointer pointing to.
-   * @return Void Pointer. Possibly nullptr.
+   * @return Void Pointer.
    */
   void* getVoidPointer(size_t i) override;
 
@@ -329,6 +337,16 @@ public:
    */
   int writeH5Data(hid_t parentId, QVector<size_t> tDims) override;
 
+  /**
+   * @brief writeH5Data Writes the strings as a variable length dataset that is chunked and
+   * compressed as described by @p compression
+   * @param parentId
+   * @param tDims
+   * @param compression
+   * @return
+   */
+  int writeH5Data(hid_t parentId, QVector<size_t> tDims, const H5DatasetCompression& compression) override;
+
   /**
    * @brief writeXdmfAttribute
    * @param out
@@ -354,7 +372,7 @@ public:
   int readH5Data(hid_t parentId) override;
 
   /**
-   * @brief setValue
+   * @brief setValue Stores the value at the index. Must not run concurrently with any other write.
    * @param i
    * @param value
    */
@@ -367,6 +385,36 @@ public:
    */
   QString getValue(size_t i);
 
+  /**
+   * @brief Returns the NUL terminated UTF-8 string at the index. The pointer is
+   * invalidated by any call that modifies the array.
+   * @param i
+   * @return
+   */
+  const char* getCString(size_t i) const;
+
+  /**
+   * @brief Sets the value at the index from a NUL terminated UTF-8 string. Must not run concurrently with any other write.
+   * @param i
+   * @param value
+   */
+  void setCString(size_t i, const char* value);
+
+  /**
+   * @brief Returns a pointer to every string in the array. The pointers are
+   * invalidated by any call that modifies the array.
+   * @return
+   */
+  std::vector<const char*> getCStrings() const;
+
+  /**
+   * @brief Replaces the contents of the array with already packed strings. Every
+   * offset must point at a NUL terminated string inside the buffer.
+   * @param buffer The UTF-8 string data
+   * @param offsets The offset of each string in the buffer
+   */
+  void setPackedStrings(std::vector<char> buffer, std::vector<size_t> offsets);
+
 protected:
   /**
    * @brief Protected Constructor
@@ -380,9 +428,28 @@ protected:
 private:
   QString m_Name;
   QString m_InitValue;
-  std::vector<QString> m_Array;
+  std::vector<char> m_Buffer;
+  std::vector<size_t> m_Offsets;
+  size_t m_Garbage = 0;
   bool _ownsData;
 
+  static const size_t k_EmptyString;
+
+  /**
+   * @brief Appends the string to the packed buffer and returns its offset.
+   */
+  size_t appendString(const char* value, size_t length);
+
+  /**
+   * @brief Marks the storage used by the string at the index as unused.
+   */
+  void releaseString(size_t i);
+
+  /**
+   * @brief Rewrites the packed buffer once enough of it is no longer referenced.
+   */
+  void compactIfNeeded();
+
 public:
   StringDataArray(const StringDataArray&) = delete;            // Copy Constructor Not Implemented
   StringDataArray(StringDataArray&&) = delete;                 // Move Constructor Not Implemented
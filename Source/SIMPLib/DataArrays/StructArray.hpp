@@ -656,6 +656,10 @@ class StructArray : public IDataArray
     }
 
 
+    // StructArrays can not be written to HDF5 at all, so the compressed variant keeps the base
+    // class fallback to writeH5Data() below
+    using IDataArray::writeH5Data;
+
     /**
      *
      * @param parentId
@@ -35,7 +35,9 @@
 
 #include <stdlib.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -43,9 +45,14 @@
 #include <QtCore/QString>
 #include <QtCore/QVector>
 
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/DataArrays/CSRNeighborList.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/MemoryMappedDataStorage.h"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/PooledDataStorage.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
@@ -645,6 +652,130 @@ public:
     TestNeighborListDeepCopyForType<int8_t>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestCSRNeighborListForType()
+  {
+    typename CSRNeighborList<T>::Pointer csr = CSRNeighborList<T>::CreateArray(6, "CSRNeighborList");
+    typename NeighborList<T>::Pointer ref = NeighborList<T>::CreateArray(6, "CSRNeighborList");
+
+    // Add the entries out of order so the buffered entries have to be merged
+    for(int j = 0; j < 5; ++j)
+    {
+      for(int i = 4; i >= 0; --i)
+      {
+        if(j < i + 1)
+        {
+          csr->addEntry(i, static_cast<T>(i * 10 + j));
+          ref->addEntry(i, static_cast<T>(i * 10 + j));
+        }
+      }
+    }
+    csr->addEntry(7, static_cast<T>(1));
+    ref->addEntry(7, static_cast<T>(1));
+    // Negative ids are ignored instead of wrapping around to a huge list index
+    csr->addEntry(-1, static_cast<T>(1));
+
+    DREAM3D_REQUIRE_EQUAL(csr->getNumberOfLists(), ref->getNumberOfLists())
+    DREAM3D_REQUIRE_EQUAL(csr->getSize(), ref->getSize())
+    for(int i = 0; i < ref->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(csr->getListSize(i), ref->getListSize(i))
+      DREAM3D_REQUIRE(csr->copyOfList(i) == ref->copyOfList(i))
+    }
+    DREAM3D_REQUIRE_EQUAL(csr->getOffsets().size(), static_cast<size_t>(csr->getNumberOfLists() + 1))
+
+    // getList() refers to the values in place
+    typename CSRNeighborList<T>::ListView view = csr->getList(2);
+    DREAM3D_REQUIRE_EQUAL(view.size(), static_cast<size_t>(3))
+    DREAM3D_REQUIRE(view.begin() == csr->getListPointer(2))
+    view[0] = static_cast<T>(5);
+    DREAM3D_REQUIRE_EQUAL(csr->copyOfList(2)[0], static_cast<T>(5))
+    view[0] = static_cast<T>(20);
+
+    // Copy lists of different lengths over a range, from another array and from this array itself
+    typename CSRNeighborList<T>::Pointer copy = CSRNeighborList<T>::FromNeighborList(*ref);
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(1, csr, 3, 3), true)
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(5, ref, 0, 1), true)
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(0, copy, 2, 2), true)
+    DREAM3D_REQUIRE(copy->copyOfList(0) == csr->copyOfList(4))
+    DREAM3D_REQUIRE(copy->copyOfList(1) == csr->copyOfList(5))
+    DREAM3D_REQUIRE(copy->copyOfList(2) == csr->copyOfList(4))
+    DREAM3D_REQUIRE(copy->copyOfList(3) == csr->copyOfList(5))
+    DREAM3D_REQUIRE(copy->copyOfList(4) == ref->copyOfList(4))
+    DREAM3D_REQUIRE(copy->copyOfList(5) == ref->copyOfList(0))
+    DREAM3D_REQUIRE(copy->copyOfList(7) == ref->copyOfList(7))
+    DREAM3D_REQUIRE_EQUAL(copy->getOffsets().back(), copy->getValues().size())
+    DREAM3D_REQUIRE_EQUAL(copy->copyFromArray(7, csr, 0, 2), false)
+
+    // Replace a list in the middle
+    typename NeighborList<T>::VectorType replacement = {static_cast<T>(9), static_cast<T>(8), static_cast<T>(7)};
+    csr->setList(1, replacement);
+    ref->setList(1, typename NeighborList<T>::SharedVectorType(new typename NeighborList<T>::VectorType(replacement)));
+    DREAM3D_REQUIRE(csr->copyOfList(1) == replacement)
+    DREAM3D_REQUIRE(csr->copyOfList(2) == ref->copyOfList(2))
+
+    QVector<size_t> eraseElements = {0, 3};
+    DREAM3D_REQUIRE_EQUAL(csr->eraseTuples(eraseElements), 0)
+    ref->eraseTuples(eraseElements);
+    DREAM3D_REQUIRE_EQUAL(csr->getNumberOfTuples(), ref->getNumberOfTuples())
+    for(int i = 0; i < ref->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE(csr->copyOfList(i) == ref->copyOfList(i))
+    }
+
+    // The on-disk layout is shared with NeighborList so each class must read what the other wrote
+    QVector<size_t> tDims(1, csr->getNumberOfTuples());
+    hid_t fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    int err = csr->writeH5Data(fileId, tDims);
+    DREAM3D_REQUIRED(err, >=, 0)
+    typename NeighborList<T>::Pointer fromCsr = NeighborList<T>::CreateArray(0, "CSRNeighborList", false);
+    err = fromCsr->readH5Data(fileId);
+    DREAM3D_REQUIRED(err, >=, 0)
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRE_EQUAL(fromCsr->getNumberOfTuples(), ref->getNumberOfTuples())
+    for(int i = 0; i < ref->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE(fromCsr->copyOfList(i) == ref->copyOfList(i))
+    }
+
+    fileId = QH5Utilities::createFile(UnitTest::DataArrayTest::TestFile);
+    err = ref->writeH5Data(fileId, tDims);
+    DREAM3D_REQUIRED(err, >=, 0)
+    typename CSRNeighborList<T>::Pointer fromRef = CSRNeighborList<T>::CreateArray(0, "CSRNeighborList", false);
+    err = fromRef->readH5Data(fileId);
+    DREAM3D_REQUIRED(err, >=, 0)
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRE_EQUAL(fromRef->getNumberOfTuples(), ref->getNumberOfTuples())
+    for(int i = 0; i < ref->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE(fromRef->copyOfList(i) == ref->copyOfList(i))
+    }
+
+    // Conversions in both directions
+    typename CSRNeighborList<T>::Pointer converted = CSRNeighborList<T>::FromNeighborList(*ref);
+    typename NeighborList<T>::Pointer back = converted->toNeighborList();
+    for(int i = 0; i < ref->getNumberOfLists(); ++i)
+    {
+      DREAM3D_REQUIRE(back->copyOfList(i) == ref->copyOfList(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCSRNeighborList()
+  {
+    TestCSRNeighborListForType<int8_t>();
+    TestCSRNeighborListForType<uint16_t>();
+    TestCSRNeighborListForType<int32_t>();
+    TestCSRNeighborListForType<uint64_t>();
+    TestCSRNeighborListForType<float>();
+    TestCSRNeighborListForType<double>();
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1215,6 +1346,246 @@ public:
     TestSetTupleForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMemoryMappedStorage()
+  {
+    QVector<size_t> cDims(1, 3);
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(TEST_SIZE, cDims, "MemoryMapped", true);
+    DREAM3D_REQUIRE_EQUAL(data->getStorage()->getStorageType(), QString("Heap"))
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      data->setValue(i, static_cast<int32_t>(i));
+    }
+
+    // Move the existing data into a scratch file
+    MemoryMappedDataStorage::Pointer storage = MemoryMappedDataStorage::New(UnitTest::DataArrayTest::TestDir);
+    int32_t err = data->setStorage(storage);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(data->getStorage()->getStorageType(), QString("MemoryMapped"))
+    QString scratchFile = storage->getScratchFilePath(data->getVoidPointer(0));
+    DREAM3D_REQUIRE_EQUAL(QFile::exists(scratchFile), true)
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), static_cast<int32_t>(i))
+    }
+
+    // Growing and shrinking has to keep the contents of the scratch file
+    data->resize(TEST_SIZE * 4);
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), TEST_SIZE * 4)
+    for(size_t i = 0; i < TEST_SIZE * cDims[0]; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(data->getValue(i), static_cast<int32_t>(i))
+    }
+    data->resize(TEST_SIZE / 2);
+    DREAM3D_REQUIRE_EQUAL(data->getTuplePointer(TEST_SIZE / 2 - 1)[2], static_cast<int32_t>((TEST_SIZE / 2 - 1) * 3 + 2))
+
+    QVector<size_t> idxs = {0, 5, 10};
+    err = data->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), TEST_SIZE / 2 - 3)
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(0, 0), 3)
+
+    // Copies use the global policy which defaults to the heap
+    IDataArray::Pointer copy = data->deepCopy();
+    Int32ArrayType::Pointer typedCopy = std::dynamic_pointer_cast<Int32ArrayType>(copy);
+    DREAM3D_REQUIRE_VALID_POINTER(typedCopy.get())
+    DREAM3D_REQUIRE_EQUAL(typedCopy->getStorage()->getStorageType(), QString("Heap"))
+    DREAM3D_REQUIRE_EQUAL(typedCopy->getComponent(0, 0), 3)
+
+    // Releasing the array removes the scratch file
+    scratchFile = storage->getScratchFilePath(data->getVoidPointer(0));
+    data = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(QFile::exists(scratchFile), false)
+
+    // One storage object may be shared by arrays that are allocated and released on different threads
+    std::vector<std::thread> workers;
+    std::atomic<int> failures(0);
+    for(int t = 0; t < 4; t++)
+    {
+      workers.emplace_back([&storage, &failures, t] {
+        for(int i = 0; i < 20; i++)
+        {
+          Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(0, "Worker", false);
+          array->setStorage(storage);
+          array->resize(TEST_SIZE + static_cast<size_t>(i));
+          array->resize(TEST_SIZE * 2);
+          array->setValue(0, t);
+          if(array->getValue(0) != t || storage->getScratchFilePath(array->getVoidPointer(0)).isEmpty())
+          {
+            failures++;
+          }
+        }
+      });
+    }
+    for(auto& worker : workers)
+    {
+      worker.join();
+    }
+    DREAM3D_REQUIRE_EQUAL(failures.load(), 0)
+
+    // Arrays above the out-of-core threshold are memory mapped automatically
+    IDataStorage::SetScratchDirectory(UnitTest::DataArrayTest::TestDir);
+    IDataStorage::SetOutOfCoreThreshold(TEST_SIZE * sizeof(float));
+    FloatArrayType::Pointer small = FloatArrayType::CreateArray(TEST_SIZE - 1, "Small", true);
+    FloatArrayType::Pointer large = FloatArrayType::CreateArray(TEST_SIZE, "Large", true);
+    IDataStorage::SetOutOfCoreThreshold(0);
+    IDataStorage::SetScratchDirectory(QString());
+    DREAM3D_REQUIRE_EQUAL(small->getStorage()->getStorageType(), QString("Heap"))
+    DREAM3D_REQUIRE_EQUAL(large->getStorage()->getStorageType(), QString("MemoryMapped"))
+    large->initializeWithValue(1.5f);
+    DREAM3D_REQUIRE_EQUAL(large->getValue(TEST_SIZE - 1), 1.5f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGrowthAndPooling()
+  {
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(1, cDims, "Growing", true);
+    data->initializeWithValue(1.0f);
+
+    // Extending one tuple at a time only moves the data when the capacity runs out
+    size_t moves = 0;
+    float* ptr = data->getPointer(0);
+    for(size_t i = 2; i <= TEST_SIZE; i++)
+    {
+      data->resize(i);
+      data->setComponent(i - 1, 0, static_cast<float>(i));
+      if(data->getPointer(0) != ptr)
+      {
+        moves++;
+        ptr = data->getPointer(0);
+      }
+      DREAM3D_REQUIRE(data->getCapacity() >= data->getSize())
+    }
+    DREAM3D_REQUIRE(moves < 30)
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(0, 2), 1.0f)
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(TEST_SIZE - 1, 0), static_cast<float>(TEST_SIZE))
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(TEST_SIZE - 1, 1), 0.0f)
+
+    // Shrinking gives the memory back
+    data->resize(10);
+    DREAM3D_REQUIRE_EQUAL(data->getCapacity(), 30)
+
+    // Reserved room is used without moving the data
+    DREAM3D_REQUIRE_EQUAL(data->reserve(100), 1)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), 10)
+    ptr = data->getPointer(0);
+    data->resize(100);
+    DREAM3D_REQUIRE(data->getPointer(0) == ptr)
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(9, 2), 1.0f)
+    DREAM3D_REQUIRE_EQUAL(data->getComponent(99, 2), 0.0f)
+
+    // Small arrays come from the pool when it is enabled
+    IDataStorage::SetPooledAllocationLimit(1024);
+    Int32ArrayType::Pointer small = Int32ArrayType::CreateArray(16, "Small", true);
+    Int32ArrayType::Pointer large = Int32ArrayType::CreateArray(1024, "Large", true);
+    IDataStorage::SetPooledAllocationLimit(0);
+    DREAM3D_REQUIRE_EQUAL(small->getStorage()->getStorageType(), QString("Pooled"))
+    DREAM3D_REQUIRE_EQUAL(large->getStorage()->getStorageType(), QString("Heap"))
+    for(size_t i = 0; i < 16; i++)
+    {
+      small->setValue(i, static_cast<int32_t>(i));
+    }
+    // Growing past the largest size class moves the data to the heap
+    small->resize(PooledDataStorage::MaxPooledSize());
+    DREAM3D_REQUIRE_EQUAL(small->getValue(15), 15)
+    DREAM3D_REQUIRE_EQUAL(small->getValue(16), 0)
+    small = Int32ArrayType::NullPointer();
+    PooledDataStorage::ReleaseCachedBlocks();
+    DREAM3D_REQUIRE_EQUAL(PooledDataStorage::GetCachedBytes(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(TEST_SIZE, "Original", true);
+    for(size_t i = 0; i < TEST_SIZE; i++)
+    {
+      data->setValue(i, static_cast<int32_t>(i));
+    }
+
+    // Copies read from the buffer of the original until one of them is written to
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(data->deepCopy());
+    Int32ArrayType::Pointer copy2 = std::dynamic_pointer_cast<Int32ArrayType>(copy->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy2.get())
+    DREAM3D_REQUIRE(copy->getConstPointer(0) == data->getConstPointer(0))
+    DREAM3D_REQUIRE(copy2->getConstPointer(0) == data->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(TEST_SIZE - 1), static_cast<int32_t>(TEST_SIZE - 1))
+
+    copy->setValue(0, -1);
+    DREAM3D_REQUIRE(copy->getConstPointer(0) != data->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), -1)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1), 1)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(copy2->getValue(0), 0)
+
+    // Once the other copies are gone the last one takes the buffer back without copying it
+    const int32_t* shared = data->getConstPointer(0);
+    copy2 = Int32ArrayType::NullPointer();
+    data->getPointer(0)[5] = 50;
+    DREAM3D_REQUIRE(data->getConstPointer(0) == shared)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(5), 50)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5), 5)
+
+    // Resizing and erasing a copy leave the original alone
+    copy = std::dynamic_pointer_cast<Int32ArrayType>(data->deepCopy());
+    copy->resize(TEST_SIZE * 2);
+    QVector<size_t> idxs = {0, 1};
+    Int32ArrayType::Pointer copy3 = std::dynamic_pointer_cast<Int32ArrayType>(data->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(copy3->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5), 50)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(TEST_SIZE), 0)
+    DREAM3D_REQUIRE_EQUAL(copy3->getValue(0), 2)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), TEST_SIZE)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(0), 0)
+
+    // forceNoAllocate never shares the buffer
+    Int32ArrayType::Pointer empty = std::dynamic_pointer_cast<Int32ArrayType>(data->deepCopy(true));
+    DREAM3D_REQUIRE_EQUAL(empty->getNumberOfTuples(), TEST_SIZE)
+    DREAM3D_REQUIRE(empty->getConstPointer(0) != data->getConstPointer(0))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentDeepCopy()
+  {
+    const size_t numTuples = 100000;
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(numTuples, "Original", true);
+    data->initializeWithValue(7);
+
+    // Copies are taken from a second thread while the owning thread keeps growing and writing the array
+    std::atomic<bool> done(false);
+    bool copiesValid = true;
+    std::thread reader([&] {
+      while(!done.load())
+      {
+        Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(data->deepCopy());
+        if(nullptr == copy || copy->getNumberOfTuples() < numTuples || copy->getValue(0) != 7)
+        {
+          copiesValid = false;
+        }
+      }
+    });
+    for(size_t i = 0; i < 200; i++)
+    {
+      data->resize(numTuples + i * 10);
+      data->getPointer(0)[numTuples - 1] = static_cast<int32_t>(i);
+    }
+    done.store(true);
+    reader.join();
+
+    DREAM3D_REQUIRE_EQUAL(copiesValid, true)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(0), 7)
+    DREAM3D_REQUIRE_EQUAL(data->getValue(numTuples - 1), 199)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1236,9 +1607,14 @@ public:
     DREAM3D_REGISTER_TEST(TestcopyTuples())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
     DREAM3D_REGISTER_TEST(TestNeighborList())
+    DREAM3D_REGISTER_TEST(TestCSRNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
     DREAM3D_REGISTER_TEST(TestSetTuple())
+    DREAM3D_REGISTER_TEST(TestMemoryMappedStorage())
+    DREAM3D_REGISTER_TEST(TestGrowthAndPooling())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestConcurrentDeepCopy())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -39,6 +39,7 @@
 #include <string>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/Geometry/MeshStructs.h"
 #include "SIMPLib/SIMPLib.h"
@@ -379,6 +380,95 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPackedStorage()
+  {
+    StringDataArray::Pointer nodes = initializeStringDataArray();
+
+    // Overwrite the values enough times that the packed buffer gets compacted
+    for(int pass = 0; pass < 1000; pass++)
+    {
+      for(size_t i = 0; i < k_ArraySize; i++)
+      {
+        nodes->setValue(i, QString("pass %1 value %2").arg(pass).arg(i));
+      }
+    }
+    nodes->setValue(3, QString(""));
+    nodes->setValue(4, QString::fromUtf8("gr\xC3\xBC\xC3\x9F"));
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), QString("pass 999 value 0"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(3).isEmpty(), true)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(4), QString::fromUtf8("gr\xC3\xBC\xC3\x9F"))
+
+    // Copying a tuple onto another one must survive the buffer growing
+    nodes->copyTuple(4, 9);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(9), nodes->getValue(4))
+
+    std::vector<const char*> strings = nodes->getCStrings();
+    DREAM3D_REQUIRE_EQUAL(strings.size(), k_ArraySize)
+    DREAM3D_REQUIRE_EQUAL(std::string(strings[1]), std::string("pass 999 value 1"))
+    DREAM3D_REQUIRE_EQUAL(std::string(strings[3]), std::string(""))
+
+    QVector<size_t> idxs;
+    idxs.push_back(0);
+    idxs.push_back(3);
+    int err = nodes->eraseTuples(idxs);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE_EQUAL(nodes->getNumberOfTuples(), k_ArraySize - 2)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), QString("pass 999 value 1"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2), nodes->getValue(7))
+
+    std::vector<char> buffer = {'a', '\0', '\0', 'b', 'c', '\0'};
+    std::vector<size_t> offsets = {3, 0, 1};
+    nodes->setPackedStrings(buffer, offsets);
+    DREAM3D_REQUIRE_EQUAL(nodes->getNumberOfTuples(), 3)
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), QString("bc"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(1), QString("a"))
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(2).isEmpty(), true)
+
+    nodes->initializeWithValue(std::string("init"));
+    for(size_t i = 0; i < nodes->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), QString("init"))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLargeColumn()
+  {
+    const size_t numTuples = 200000;
+    StringDataArray::Pointer column = StringDataArray::CreateArray(numTuples, "Column");
+    auto expectedString = [](size_t row, int pass) { return QString("Row%1 pass %2").arg(row).arg(pass) + QString(static_cast<int>(row % 5), 'x'); };
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      column->setValue(i, expectedString(i, 0));
+    }
+    // Overwriting every other row in a strided order makes the buffer compact while rows are still being written
+    for(size_t start = 0; start < 4; start++)
+    {
+      for(size_t i = start; i < numTuples; i += 4)
+      {
+        if(i % 2 == 0)
+        {
+          column->setValue(i, expectedString(i, 1));
+        }
+      }
+    }
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(column->getValue(i), expectedString(i, (i % 2 == 0) ? 1 : 0))
+    }
+
+    // The ASCII importer relies on this to keep String columns out of its parallel pass
+    StringParserType::Pointer parser = StringParserType::New(column, "Column", 0);
+    DREAM3D_REQUIRE_EQUAL(parser->canParseConcurrently(), false)
+    DREAM3D_REQUIRE_EQUAL(Int32ParserType::New(Int32ArrayType::CreateArray(1, "Ints"), "Ints", 0)->canParseConcurrently(), true)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -397,6 +487,8 @@ public:
     DREAM3D_REGISTER_TEST(TestTupleCopy())
     DREAM3D_REGISTER_TEST(TestTupleErase())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestPackedStorage())
+    DREAM3D_REGISTER_TEST(TestLargeColumn())
 
 #if REMOVE_TEST_FILES
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -41,6 +41,13 @@
 #include <fstream>
 #include <iostream>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 // HDF5 Includes
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
@@ -56,6 +63,141 @@
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+namespace
+{
+/**
+ * @brief Reduces an array that was read in full down to the tuples inside a region of interest. This
+ * is the fallback for array types that can not be read through a hyperslab selection (String and
+ * NeighborList arrays), so the whole array has already been read from the file and held in memory
+ * before it is cropped here. The region's tuples are moved to the front in a single forward pass,
+ * which works in place because a tuple is never moved to a later position, and the rest is cut off.
+ * @param array Array holding every tuple of the volume
+ * @param volumeDims Tuple dimensions of the full volume (X, Y, Z)
+ * @param start First voxel of the region (X, Y, Z)
+ * @param stride Step between voxels of the region (X, Y, Z)
+ * @param count Number of voxels in the region (X, Y, Z)
+ * @return Array holding only the region's tuples
+ */
+IDataArray::Pointer extractTupleRegion(const IDataArray::Pointer& array, const QVector<size_t>& volumeDims, const QVector<size_t>& start, const QVector<size_t>& stride,
+                                       const QVector<size_t>& count)
+{
+  size_t numRegionTuples = count[0] * count[1] * count[2];
+  if(!array->isAllocated())
+  {
+    return array->createNewArray(numRegionTuples, array->getComponentDimensions(), array->getName(), false);
+  }
+
+  size_t destTuple = 0;
+  for(size_t z = 0; z < count[2]; z++)
+  {
+    for(size_t y = 0; y < count[1]; y++)
+    {
+      size_t rowOffset = ((start[2] + z * stride[2]) * volumeDims[1] + (start[1] + y * stride[1])) * volumeDims[0];
+      for(size_t x = 0; x < count[0]; x++)
+      {
+        size_t srcTuple = rowOffset + start[0] + x * stride[0];
+        if(srcTuple != destTuple && array->copyTuple(srcTuple, destTuple) < 0)
+        {
+          return IDataArray::NullPointer();
+        }
+        destTuple++;
+      }
+    }
+  }
+  if(array->resize(numRegionTuples) < 0)
+  {
+    return IDataArray::NullPointer();
+  }
+  return array;
+}
+
+/**
+ * @brief The GatherTuplesImpl class compacts a range of arrays with one table that lists, for every
+ * tuple that is kept, the tuple it is copied from. The table is increasing, so each array can be
+ * compacted in place with a single forward pass. Each array is compacted independently, so the
+ * arrays can be handed out to different threads.
+ */
+class GatherTuplesImpl
+{
+public:
+  GatherTuplesImpl(const QVector<IDataArray::Pointer>& arrays, const QVector<size_t>& keptTuples)
+  : m_Arrays(arrays)
+  , m_KeptTuples(keptTuples)
+  {
+  }
+  virtual ~GatherTuplesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const size_t numKept = static_cast<size_t>(m_KeptTuples.size());
+    const size_t* keptTuples = m_KeptTuples.data();
+    for(size_t i = start; i < end; i++)
+    {
+      IDataArray::Pointer array = m_Arrays[static_cast<int>(i)];
+      for(size_t t = 0; t < numKept; t++)
+      {
+        if(keptTuples[t] != t)
+        {
+          array->copyTuple(keptTuples[t], t);
+        }
+      }
+      array->resize(numKept);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const QVector<size_t>& m_KeptTuples;
+};
+
+/**
+ * @brief The RenumberFeatureIdsImpl class replaces each Feature Id in a range of elements with its
+ * new, compacted Id. Ids outside of the renumbering table are left alone.
+ */
+class RenumberFeatureIdsImpl
+{
+public:
+  RenumberFeatureIdsImpl(int32_t* featureIds, const QVector<int32_t>& newIds)
+  : m_FeatureIds(featureIds)
+  , m_NewIds(newIds)
+  {
+  }
+  virtual ~RenumberFeatureIdsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const int32_t* newIds = m_NewIds.data();
+    const int32_t numIds = m_NewIds.size();
+    for(size_t i = start; i < end; i++)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      if(featureId >= 0 && featureId < numIds)
+      {
+        m_FeatureIds[i] = newIds[featureId];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int32_t* m_FeatureIds;
+  const QVector<int32_t>& m_NewIds;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -445,52 +587,78 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
   size_t totalTuples = getNumberOfTuples();
   if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix)
   {
-    size_t goodcount = 1;
-    QVector<size_t> newNames(totalTuples, 0);
-    QVector<size_t> removeList;
+    // Build the renumbering table and the list of kept tuples in one pass. Tuple 0 is
+    // never removed.
+    int32_t goodcount = 1;
+    QVector<int32_t> newIds(activeObjects.size(), 0);
+    QVector<size_t> keptTuples;
+    keptTuples.reserve(activeObjects.size());
+    keptTuples.push_back(0);
 
     for(qint32 i = 1; i < activeObjects.size(); i++)
     {
-      if(!activeObjects[i])
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
-      }
-      else
+      if(activeObjects[i])
       {
-        newNames[i] = goodcount;
+        newIds[i] = goodcount;
         goodcount++;
+        keptTuples.push_back(static_cast<size_t>(i));
       }
     }
 
-    if(!removeList.empty())
+    if(static_cast<size_t>(keptTuples.size()) != totalTuples)
     {
+      // NeighborLists refer to Features by Id and cannot be compacted like the other arrays, so
+      // they are removed; the filters that need them recompute them
+      QVector<IDataArray::Pointer> arrays;
+      arrays.reserve(m_AttributeArrays.size());
       QList<QString> headers = getAttributeArrayNames();
       for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
       {
         IDataArray::Pointer p = getAttributeArray(*iter);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
+        if(p->getTypeAsString().compare("NeighborList<T>") == 0)
         {
           removeAttributeArray(*iter);
         }
         else
         {
-          p->eraseTuples(removeList);
+          arrays.push_back(p);
         }
       }
-      QVector<size_t> tDims(1, (totalTuples - removeList.size()));
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::task_scheduler_init init;
+      bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel)
+      {
+        // One array per task; the arrays are usually few and large
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(arrays.size()), 1), GatherTuplesImpl(arrays, keptTuples), tbb::simple_partitioner());
+      }
+      else
+#endif
+      {
+        GatherTuplesImpl serial(arrays, keptTuples);
+        serial.compute(0, static_cast<size_t>(arrays.size()));
+      }
+
+      QVector<size_t> tDims(1, static_cast<size_t>(keptTuples.size()));
       setTupleDimensions(tDims);
 
       // Loop over all the points and correct all the feature names
       size_t totalPoints = featureIds->getNumberOfTuples();
       int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      if(doParallel)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
-        {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
-        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), RenumberFeatureIdsImpl(featureIdPtr, newIds), tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        RenumberFeatureIdsImpl serial(featureIdPtr, newIds);
+        serial.compute(0, totalPoints);
       }
     }
   }
@@ -574,13 +742,13 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId)
+int AttributeMatrix::writeAttributeArraysToHDF5(hid_t parentId, const H5DatasetCompression& compression)
 {
   int err;
   for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
   {
     IDataArray::Pointer d = iter.value();
-    err = d->writeH5Data(parentId, m_TupleDims);
+    err = d->writeH5Data(parentId, m_TupleDims, compression);
     if(err < 0)
     {
       return err;
@@ -651,8 +819,18 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, QString name, bool
 //
 // -----------------------------------------------------------------------------
 int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy)
+{
+  return readAttributeArrayRegionsFromHDF5(amGid, preflight, attrMatProxy, QVector<size_t>(), QVector<size_t>(), QVector<size_t>(), QVector<size_t>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::readAttributeArrayRegionsFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& volumeDims, const QVector<size_t>& start,
+                                                       const QVector<size_t>& stride, const QVector<size_t>& count)
 {
   int err = 0;
+  bool readRegion = (volumeDims.size() == 3 && start.size() == 3 && stride.size() == 3 && count.size() == 3);
   QMap<QString, DataArrayProxy> dasToRead = attrMatProxy->dataArrays;
   QString classType;
   for(QMap<QString, DataArrayProxy>::iterator iter = dasToRead.begin(); iter != dasToRead.end(); ++iter)
@@ -666,7 +844,16 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     //   qDebug() << groupName << " Array: " << *iter << " with C++ ClassType of " << classType << "\n";
     IDataArray::Pointer dPtr = IDataArray::NullPointer();
 
-    if(classType.startsWith("DataArray"))
+    if(classType.startsWith("DataArray") && readRegion)
+    {
+      dPtr = H5DataArrayReader::ReadIDataArrayRegion(amGid, iter->name, start, stride, count, preflight);
+      if(nullptr == dPtr.get())
+      {
+        // The stored tuple dimensions do not describe the volume, so read everything and reduce it below
+        dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight);
+      }
+    }
+    else if(classType.startsWith("DataArray"))
     {
       dPtr = H5DataArrayReader::ReadIDataArray(amGid, iter->name, preflight);
     }
@@ -696,6 +883,17 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     //      dPtr = statsData;
     //    }
 
+    // Arrays that were read in full still have to be cut down to the region
+    if(readRegion && nullptr != dPtr.get() && dPtr->getNumberOfTuples() != count[0] * count[1] * count[2])
+    {
+      if(dPtr->getNumberOfTuples() != volumeDims[0] * volumeDims[1] * volumeDims[2])
+      {
+        H5Gclose(amGid);
+        return -1;
+      }
+      dPtr = extractTupleRegion(dPtr, volumeDims, start, stride, count);
+    }
+
     if(nullptr != dPtr.get())
     {
       addAttributeArray(dPtr->getName(), dPtr);
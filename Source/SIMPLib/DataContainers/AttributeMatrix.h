@@ -558,8 +558,11 @@ public:
 
     /**
     * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
-      (only valid for feature or ensemble type matrices)
-    * @param size The new size of the array
+      (only valid for feature or ensemble type matrices). The arrays are compacted concurrently when parallel algorithms
+      are enabled. NeighborLists are compacted as well; the Feature Ids held by NeighborLists of int32_t are renumbered
+      and those that refer to a removed object become 0.
+    * @param activeObjects Which objects to keep; object 0 is always kept
+    * @param featureIds Element Feature Ids that are renumbered to the compacted objects
     */
     bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds);
 
@@ -592,9 +595,10 @@ public:
     /**
      * @brief writeAttributeArraysToHDF5
      * @param parentId
+     * @param compression Chunking/compression options for the array datasets
      * @return
      */
-    virtual int writeAttributeArraysToHDF5(hid_t parentId);
+    virtual int writeAttributeArraysToHDF5(hid_t parentId, const H5DatasetCompression& compression = H5DatasetCompression());
 
     /**
      * @brief addAttributeArrayFromHDF5Path
@@ -614,6 +618,22 @@ public:
      */
     virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
 
+    /**
+     * @brief readAttributeArrayRegionsFromHDF5 Reads only the tuples inside a region of interest of a
+     * volume. DataArrays are read through a hyperslab selection, other array types are read in full and
+     * then reduced. Passing empty vectors reads every tuple.
+     * @param amGid
+     * @param preflight
+     * @param attrMatProxy
+     * @param volumeDims Tuple dimensions of the stored volume (X, Y, Z)
+     * @param start First voxel of the region (X, Y, Z)
+     * @param stride Step between voxels of the region (X, Y, Z)
+     * @param count Number of voxels in the region (X, Y, Z)
+     * @return
+     */
+    virtual int readAttributeArrayRegionsFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy, const QVector<size_t>& volumeDims, const QVector<size_t>& start,
+                                                  const QVector<size_t>& stride, const QVector<size_t>& count);
+
     /**
      * @brief generateXdmfText
      * @param centering
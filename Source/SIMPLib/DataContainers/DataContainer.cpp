@@ -35,6 +35,10 @@
 
 #include "DataContainer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <tuple>
+
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
@@ -45,6 +49,7 @@
 #include "SIMPLib/Geometry/EdgeGeom.h"
 #include "SIMPLib/Geometry/HexahedralGeom.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/QuadGeom.h"
 #include "SIMPLib/Geometry/RectGridGeom.h"
@@ -56,6 +61,11 @@
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Utilities.h"
 
+namespace
+{
+std::atomic<uint64_t> s_RenameCount(0);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -150,9 +160,21 @@ void DataContainer::ReadDataContainerStructure(hid_t dcArrayGroupId, DataContain
 // -----------------------------------------------------------------------------
 void DataContainer::setName(const QString& name)
 {
+  if(m_Name != name)
+  {
+    s_RenameCount.fetch_add(1, std::memory_order_relaxed);
+  }
   m_Name = name;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DataContainer::GetRenameCount()
+{
+  return s_RenameCount.load(std::memory_order_relaxed);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -329,7 +351,7 @@ int DataContainer::getNumAttributeMatrices()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
+int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId, const H5DatasetCompression& compression)
 {
   int err;
   hid_t attributeMatrixId;
@@ -357,7 +379,7 @@ int DataContainer::writeAttributeMatricesToHDF5(hid_t parentId)
     {
       return err;
     }
-    err = (*iter)->writeAttributeArraysToHDF5(attributeMatrixId);
+    err = (*iter)->writeAttributeArraysToHDF5(attributeMatrixId, compression);
     if(err < 0)
     {
       return err;
@@ -377,6 +399,28 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
   QMap<QString, AttributeMatrixProxy> attrMatsToRead = dcProxy.attributeMatricies;
   AttributeMatrix::Type amType = AttributeMatrix::Type::Unknown;
   QString amName;
+
+  // The cell data of Image and RectGrid geometries can be restricted to a region of interest
+  QVector<size_t> volumeDims;
+  QVector<size_t> roiStart;
+  QVector<size_t> roiStride;
+  QVector<size_t> roiCount;
+  bool readRegion = false;
+  if(dcProxy.hasRegionOfInterest())
+  {
+    IGeometryGrid::Pointer grid = std::dynamic_pointer_cast<IGeometryGrid>(m_Geometry);
+    if(nullptr == grid)
+    {
+      return -1;
+    }
+    volumeDims.resize(3);
+    std::tie(volumeDims[0], volumeDims[1], volumeDims[2]) = grid->getDimensions();
+    if(!dcProxy.computeRegionOfInterest(volumeDims, roiStart, roiStride, roiCount))
+    {
+      return -1;
+    }
+    readRegion = true;
+  }
   for(QMap<QString, AttributeMatrixProxy>::iterator iter = attrMatsToRead.begin(); iter != attrMatsToRead.end(); ++iter)
   {
     if(iter.value().flag == Qt::Unchecked)
@@ -404,15 +448,23 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
       return -1;
     }
 
+    amType = static_cast<AttributeMatrix::Type>(amTypeTmp);
+    bool cellRegion = readRegion && amType == AttributeMatrix::Type::Cell && tDims == volumeDims;
     if(getAttributeMatrix(amName) == nullptr)
     {
-      amType = static_cast<AttributeMatrix::Type>(amTypeTmp);
-      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, amName, amType);
+      AttributeMatrix::Pointer am = AttributeMatrix::New(cellRegion ? roiCount : tDims, amName, amType);
       addAttributeMatrix(amName, am);
     }
 
     AttributeMatrixProxy amProxy = iter.value();
-    err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    if(cellRegion)
+    {
+      err = getAttributeMatrix(amName)->readAttributeArrayRegionsFromHDF5(amGid, preflight, &amProxy, volumeDims, roiStart, roiStride, roiCount);
+    }
+    else
+    {
+      err = getAttributeMatrix(amName)->readAttributeArraysFromHDF5(amGid, preflight, &amProxy);
+    }
     if(err < 0)
     {
       err |= H5Gclose(dcGid);
@@ -421,11 +473,69 @@ int DataContainer::readAttributeMatricesFromHDF5(bool preflight, hid_t dcGid, co
     }
   }
 
+  if(readRegion)
+  {
+    cropGeometryToRegion(roiStart, roiStride, roiCount);
+  }
+
   err |= H5Gclose(dcGid);
 
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainer::cropGeometryToRegion(const QVector<size_t>& start, const QVector<size_t>& stride, const QVector<size_t>& count)
+{
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(m_Geometry);
+  if(nullptr != image)
+  {
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    image->getResolution(res);
+    image->getOrigin(origin);
+    for(size_t i = 0; i < 3; i++)
+    {
+      origin[i] += static_cast<float>(start[i]) * res[i];
+      res[i] *= static_cast<float>(stride[i]);
+    }
+    image->setOrigin(origin);
+    image->setResolution(res);
+    image->setDimensions(count[0], count[1], count[2]);
+    return;
+  }
+
+  RectGridGeom::Pointer rectGrid = std::dynamic_pointer_cast<RectGridGeom>(m_Geometry);
+  if(nullptr != rectGrid)
+  {
+    FloatArrayType::Pointer bounds[3] = {rectGrid->getXBounds(), rectGrid->getYBounds(), rectGrid->getZBounds()};
+    size_t dims[3] = {0, 0, 0};
+    std::tie(dims[0], dims[1], dims[2]) = rectGrid->getDimensions();
+    for(size_t i = 0; i < 3; i++)
+    {
+      QString name = (nullptr != bounds[i]) ? bounds[i]->getName() : QString();
+      bool allocate = (nullptr != bounds[i] && bounds[i]->isAllocated());
+      FloatArrayType::Pointer cropped = FloatArrayType::CreateArray(count[i] + 1, name, allocate);
+      if(allocate)
+      {
+        // Each strided cell spans from its own lower bound to the lower bound of the next kept cell
+        for(size_t j = 0; j < count[i]; j++)
+        {
+          cropped->setValue(j, bounds[i]->getValue(start[i] + j * stride[i]));
+        }
+        cropped->setValue(count[i], bounds[i]->getValue(std::min(start[i] + count[i] * stride[i], dims[i])));
+      }
+      bounds[i] = cropped;
+    }
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    rectGrid->setDimensions(count[0], count[1], count[2]);
+    rectGrid->deleteElementSizes();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -137,6 +137,13 @@ public:
    */
   virtual void setName(const QString& name);
 
+  /**
+   * @brief GetRenameCount Returns how many times any DataContainer has been renamed. DataContainerArray
+   * compares it against the count its name index was built at to notice renames that bypass it.
+   * @return
+   */
+  static uint64_t GetRenameCount();
+
   /**
    * @brief Gets the name of the data container
    */
@@ -322,9 +329,11 @@ public:
 
   /**
    * @brief Writes all the Attribute Matrices to HDF5 file
+   * @param parentId
+   * @param compression Chunking/compression options for the attribute array datasets
    * @return
    */
-  virtual int writeAttributeMatricesToHDF5(hid_t parentId);
+  virtual int writeAttributeMatricesToHDF5(hid_t parentId, const H5DatasetCompression& compression = H5DatasetCompression());
 
   /**
    * @brief Reads desired Attribute Matrices from HDF5 file
@@ -368,6 +377,14 @@ protected:
   explicit DataContainer(const QString& name);
 
 private:
+  /**
+   * @brief Moves an Image or RectGrid geometry onto the region of interest that was read from file
+   * @param start First voxel of the region (X, Y, Z)
+   * @param stride Step between voxels of the region (X, Y, Z)
+   * @param count Number of voxels in the region (X, Y, Z)
+   */
+  void cropGeometryToRegion(const QVector<size_t>& start, const QVector<size_t>& stride, const QVector<size_t>& count);
+
   AttributeMatrixMap_t m_AttributeMatrices;
   IGeometry::Pointer m_Geometry;
   QString m_Name;
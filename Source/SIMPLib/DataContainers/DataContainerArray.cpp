@@ -34,8 +34,11 @@
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "DataContainerArray.h"
 
+#include <tuple>
+
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
+#include "SIMPLib/Geometry/IGeometryGrid.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -53,6 +56,10 @@ DataContainerArray::~DataContainerArray() = default;
 void DataContainerArray::addDataContainer(DataContainer::Pointer f)
 {
   m_Array.push_back(f);
+  if(nullptr != f.get() && !m_NameIndex.contains(f->getName()))
+  {
+    m_NameIndex.insert(f->getName(), f);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -69,6 +76,7 @@ int DataContainerArray::getNumDataContainers()
 void DataContainerArray::clearDataContainers()
 {
   m_Array.clear();
+  m_NameIndex.clear();
 }
 
 #if 0
@@ -129,6 +137,11 @@ DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& na
     {
       f = *it;
       m_Array.erase(it);
+      // Another DataContainer may carry the same name, so the index is built again if it refers to this one
+      if(m_NameIndex.value(name) == f)
+      {
+        rebuildNameIndex();
+      }
       return f;
     }
   }
@@ -142,32 +155,20 @@ DataContainer::Pointer DataContainerArray::removeDataContainer(const QString& na
 // -----------------------------------------------------------------------------
 bool DataContainerArray::renameDataContainer(const QString& oldName, const QString& newName)
 {
-  DataContainer::Pointer dc = DataContainer::NullPointer();
-
   // Make sure we do not already have a DataContainer with the newname
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-  {
-    if((*it)->getName().compare(newName) == 0)
-    {
-      dc = *it;
-      break;
-    }
-  }
+  DataContainer::Pointer dc = findDataContainer(newName);
 
   if(nullptr == dc)
   {
     // We did not find any data container that matches the new name so we can rename if we find one that matches
     // the 'oldname' argument
     // Now find the data container we want to rename
-    for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+    dc = findDataContainer(oldName);
+    if(nullptr != dc)
     {
-      if((*it)->getName().compare(oldName) == 0)
-      {
-        // we have an existing DataContainer that matches our "oldname" that we want to rename so all is good.
-        dc = *it;
-        dc->setName(newName);
-        return true;
-      }
+      // we have an existing DataContainer that matches our "oldname" that we want to rename so all is good.
+      dc->setName(newName);
+      return true;
     }
   }
   else if(nullptr != dc)
@@ -184,17 +185,39 @@ bool DataContainerArray::renameDataContainer(const QString& oldName, const QStri
 // -----------------------------------------------------------------------------
 DataContainer::Pointer DataContainerArray::getDataContainer(const QString& name)
 {
-  DataContainer::Pointer f = DataContainer::NullPointer();
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+  return findDataContainer(name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer DataContainerArray::findDataContainer(const QString& name)
+{
+  // A DataContainer was renamed, possibly through DataContainer::setName() directly
+  if(DataContainer::GetRenameCount() != m_IndexedRenameCount)
   {
-    if((*it)->getName().compare(name) == 0)
+    rebuildNameIndex();
+  }
+  return m_NameIndex.value(name, DataContainer::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArray::rebuildNameIndex()
+{
+  m_IndexedRenameCount = DataContainer::GetRenameCount();
+  m_NameIndex.clear();
+  m_NameIndex.reserve(m_Array.size());
+  const QList<DataContainer::Pointer>& containers = m_Array;
+  for(const DataContainer::Pointer& dc : containers)
+  {
+    // The first DataContainer with a given name wins, as with a linear search
+    if(!m_NameIndex.contains(dc->getName()))
     {
-      f = *it;
-      break;
+      m_NameIndex.insert(dc->getName(), dc);
     }
   }
-
-  return f;
 }
 
 // -----------------------------------------------------------------------------
@@ -225,15 +248,7 @@ AttributeMatrix::Pointer DataContainerArray::getAttributeMatrix(const DataArrayP
 // -----------------------------------------------------------------------------
 void DataContainerArray::duplicateDataContainer(const QString& name, const QString& newName)
 {
-  DataContainer::Pointer f = DataContainer::NullPointer();
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-  {
-    if((*it)->getName().compare(name) == 0)
-    {
-      f = *it;
-      break;
-    }
-  }
+  DataContainer::Pointer f = findDataContainer(name);
 
   if(f == nullptr)
   {
@@ -261,7 +276,7 @@ QList<QString> DataContainerArray::getDataContainerNames()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QList<DataContainer::Pointer>& DataContainerArray::getDataContainers()
+const QList<DataContainer::Pointer>& DataContainerArray::getDataContainers()
 {
   return m_Array;
 }
@@ -332,6 +347,32 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
       }
       return -198745603;
     }
+
+    if(dcProxy.hasRegionOfInterest())
+    {
+      IGeometryGrid::Pointer grid = this->getDataContainer(dcProxy.name)->getGeometryAs<IGeometryGrid>();
+      QVector<size_t> volumeDims(3, 0);
+      QVector<size_t> start;
+      QVector<size_t> stride;
+      QVector<size_t> count;
+      if(nullptr != grid)
+      {
+        std::tie(volumeDims[0], volumeDims[1], volumeDims[2]) = grid->getDimensions();
+      }
+      if(nullptr == grid || !dcProxy.computeRegionOfInterest(volumeDims, start, stride, count))
+      {
+        if(nullptr != obs)
+        {
+          QString ss = QObject::tr("The region of interest requested for '%1' is not valid. Regions of interest can only be read from Image and RectGrid geometries and must lie "
+                                   "inside the stored volume with a non-zero stride.")
+                           .arg(dcProxy.name);
+          obs->notifyErrorMessage(getNameOfClass(), ss, -198745605);
+        }
+        H5Gclose(dcGid);
+        return -198745605;
+      }
+    }
+
     err = this->getDataContainer(dcProxy.name)->readAttributeMatricesFromHDF5(preflight, dcGid, dcProxy);
     if(err < 0)
     {
@@ -351,14 +392,7 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesDataContainerExist(const QString& name)
 {
-  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
-  {
-    if((*it)->getName().compare(name) == 0)
-    {
-      return true;
-    }
-  }
-  return false;
+  return nullptr != findDataContainer(name).get();
 }
 
 // -----------------------------------------------------------------------------
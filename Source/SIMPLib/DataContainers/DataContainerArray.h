@@ -39,6 +39,7 @@
 #include <cstddef>       // for nullptr
 
 #include <QtCore/QObject> // for Q_OBJECT
+#include <QtCore/QHash>
 #include <QtCore/QString>
 #include <QtCore/QList>
 
@@ -108,10 +109,12 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
     virtual DataContainerShPtr getDataContainer(const QString& name);
 
     /**
-     * @brief getDataContainers
+     * @brief getDataContainers Returns the DataContainers in the order they were added. The list is
+     * read only so that the name index stays in step with it; use addDataContainer() and
+     * removeDataContainer() to change it.
      * @return
      */
-    QList<DataContainerShPtr>& getDataContainers();
+    const QList<DataContainerShPtr>& getDataContainers();
 
     /**
      * @brief Returns if a DataContainer with the give name is in the array
@@ -740,6 +743,22 @@ class SIMPLib_EXPORT DataContainerArray : public QObject
 
   private:
     QList<DataContainerShPtr>  m_Array;
+    QHash<QString, DataContainerShPtr> m_NameIndex;
+    // DataContainer::GetRenameCount() at the time m_NameIndex was built
+    uint64_t m_IndexedRenameCount = 0;
+
+    /**
+     * @brief findDataContainer Looks a DataContainer up by name through the hash index, which is
+     * kept in step with the list and rebuilt only after a DataContainer has been renamed
+     * @param name
+     * @return
+     */
+    DataContainerShPtr findDataContainer(const QString& name);
+
+    /**
+     * @brief rebuildNameIndex
+     */
+    void rebuildNameIndex();
     QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
 
   public:
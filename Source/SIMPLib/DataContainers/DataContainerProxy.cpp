@@ -35,6 +35,8 @@
 
 #include "DataContainerProxy.h"
 
+#include <algorithm>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -62,6 +64,9 @@ DataContainerProxy::DataContainerProxy(const DataContainerProxy& amp)
   name = amp.name;
   dcType = amp.dcType;
   attributeMatricies = amp.attributeMatricies;
+  roiMin = amp.roiMin;
+  roiMax = amp.roiMax;
+  roiStride = amp.roiStride;
 }
 
 // -----------------------------------------------------------------------------
@@ -74,7 +79,8 @@ DataContainerProxy& DataContainerProxy::operator=(const DataContainerProxy& amp)
 // -----------------------------------------------------------------------------
 bool DataContainerProxy::operator==(const DataContainerProxy& amp) const
 {
-  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies;
+  return flag == amp.flag && name == amp.name && dcType == amp.dcType && attributeMatricies == amp.attributeMatricies && roiMin == amp.roiMin && roiMax == amp.roiMax &&
+         roiStride == amp.roiStride;
 }
 
 // -----------------------------------------------------------------------------
@@ -108,6 +114,21 @@ void DataContainerProxy::writeJson(QJsonObject& json)
   json["Name"] = name;
   json["Type"] = static_cast<double>(dcType);
   json["Attribute Matricies"] = writeMap(attributeMatricies);
+  if(hasRegionOfInterest())
+  {
+    QJsonArray minArray;
+    QJsonArray maxArray;
+    QJsonArray strideArray;
+    for(int i = 0; i < 3; i++)
+    {
+      minArray.push_back(static_cast<double>(roiMin[i]));
+      maxArray.push_back(static_cast<double>(roiMax[i]));
+      strideArray.push_back(static_cast<double>(roiStride[i]));
+    }
+    json["ROI Min"] = minArray;
+    json["ROI Max"] = maxArray;
+    json["ROI Stride"] = strideArray;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -127,6 +148,20 @@ bool DataContainerProxy::readJson(QJsonObject& json)
       dcType = static_cast<unsigned int>(json["Type"].toDouble());
     }
     attributeMatricies = readMap(json["Attribute Matricies"].toArray());
+    clearRegionOfInterest();
+    if(json["ROI Min"].isArray() && json["ROI Max"].isArray() && json["ROI Stride"].isArray())
+    {
+      QVector<size_t> min;
+      QVector<size_t> max;
+      QVector<size_t> stride;
+      for(int i = 0; i < 3; i++)
+      {
+        min.push_back(static_cast<size_t>(json["ROI Min"].toArray().at(i).toDouble()));
+        max.push_back(static_cast<size_t>(json["ROI Max"].toArray().at(i).toDouble()));
+        stride.push_back(static_cast<size_t>(json["ROI Stride"].toArray().at(i).toDouble(1.0)));
+      }
+      setRegionOfInterest(min, max, stride);
+    }
     return true;
   }
   return false;
@@ -235,3 +270,62 @@ void DataContainerProxy::setFlags(uint8_t flag, AttributeMatrixProxy::AMTypeFlag
     }
   }
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerProxy::setRegionOfInterest(const QVector<size_t>& min, const QVector<size_t>& max, const QVector<size_t>& stride)
+{
+  if(min.size() != 3 || max.size() != 3 || stride.size() != 3)
+  {
+    clearRegionOfInterest();
+    return;
+  }
+  roiMin = min;
+  roiMax = max;
+  roiStride = stride;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerProxy::clearRegionOfInterest()
+{
+  roiMin.clear();
+  roiMax.clear();
+  roiStride.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerProxy::hasRegionOfInterest() const
+{
+  return roiMin.size() == 3 && roiMax.size() == 3 && roiStride.size() == 3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataContainerProxy::computeRegionOfInterest(const QVector<size_t>& dims, QVector<size_t>& start, QVector<size_t>& stride, QVector<size_t>& count) const
+{
+  if(!hasRegionOfInterest() || dims.size() != 3)
+  {
+    return false;
+  }
+  start.resize(3);
+  stride.resize(3);
+  count.resize(3);
+  for(int i = 0; i < 3; i++)
+  {
+    if(dims[i] == 0 || roiStride[i] == 0 || roiMin[i] > roiMax[i] || roiMin[i] >= dims[i])
+    {
+      return false;
+    }
+    size_t max = std::min(roiMax[i], dims[i] - 1);
+    start[i] = roiMin[i];
+    stride[i] = roiStride[i];
+    count[i] = (max - roiMin[i]) / roiStride[i] + 1;
+  }
+  return true;
+}
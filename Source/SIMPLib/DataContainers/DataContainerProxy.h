@@ -39,6 +39,7 @@
 #include <QtCore/QMetaType>
 #include <QtCore/QString>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtCore/QJsonArray>
 
 #include "SIMPLib/SIMPLib.h"
@@ -143,11 +144,46 @@ class SIMPLib_EXPORT DataContainerProxy
      */
     void updatePath(DataArrayPath::RenameType renamePath);
 
+    /**
+     * @brief setRegionOfInterest Restricts the cell data of an Image or RectGrid geometry to the voxels
+     * from roiMin to roiMax (inclusive) along X, Y and Z, keeping every stride'th voxel. Only that box is
+     * read from the file and the geometry is adjusted to match.
+     * @param min
+     * @param max
+     * @param stride
+     */
+    void setRegionOfInterest(const QVector<size_t>& min, const QVector<size_t>& max, const QVector<size_t>& stride = QVector<size_t>(3, 1));
+
+    /**
+     * @brief clearRegionOfInterest Reads the whole volume again
+     */
+    void clearRegionOfInterest();
+
+    /**
+     * @brief hasRegionOfInterest
+     * @return
+     */
+    bool hasRegionOfInterest() const;
+
+    /**
+     * @brief computeRegionOfInterest Clamps the region of interest to a volume with the given dimensions
+     * and returns the first voxel, the stride and the number of voxels along X, Y and Z.
+     * @param dims
+     * @param start
+     * @param stride
+     * @param count
+     * @return false if the region is malformed or does not overlap the volume
+     */
+    bool computeRegionOfInterest(const QVector<size_t>& dims, QVector<size_t>& start, QVector<size_t>& stride, QVector<size_t>& count) const;
+
     //----- Our variables, publicly available
     uint8_t flag;
     QString name;
     unsigned int dcType;
     QMap<QString, AttributeMatrixProxy> attributeMatricies;
+    QVector<size_t> roiMin;
+    QVector<size_t> roiMax;
+    QVector<size_t> roiStride;
 
   private:
 
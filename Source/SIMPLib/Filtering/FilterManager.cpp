@@ -35,6 +35,8 @@
 
 #include "FilterManager.h"
 
+#include <QtCore/QMutexLocker>
+
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/CorePlugin.h"
 
@@ -46,6 +48,7 @@ FilterManager* FilterManager::s_Self = nullptr;
 //
 // -----------------------------------------------------------------------------
 FilterManager::FilterManager()
+: m_DeferredMutex(QMutex::Recursive)
 {
   Q_ASSERT_X(!s_Self, "FilterManager", "there should be only one FilterManager object");
   FilterManager::s_Self = this;
@@ -96,6 +99,8 @@ void FilterManager::RegisterKnownFilters(FilterManager* /* fm */)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories() const
 {
+  QMutexLocker locker(&m_DeferredMutex);
+  loadDeferredPlugins();
   return m_Factories;
 }
 
@@ -104,6 +109,8 @@ FilterManager::Collection FilterManager::getFactories() const
 // -----------------------------------------------------------------------------
 void FilterManager::printFactoryNames() const
 {
+  QMutexLocker locker(&m_DeferredMutex);
+  loadDeferredPlugins();
   QList<QString> keys = m_Factories.keys();
   for(auto const key : keys)
   {
@@ -116,6 +123,8 @@ void FilterManager::printFactoryNames() const
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 {
+  QMutexLocker locker(&m_DeferredMutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -134,6 +143,8 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName, const QString& subGroupName)
 {
+  QMutexLocker locker(&m_DeferredMutex);
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
   for(FilterManager::Collection::iterator factoryIter = m_Factories.begin(); factoryIter != m_Factories.end(); ++factoryIter)
   {
@@ -152,6 +163,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName,
 void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointer factory)
 {
   // std::cout << this << " - Registering Filter: " << name.toStdString() << std::endl;
+  QMutexLocker locker(&m_DeferredMutex);
   m_Factories[name] = factory;
   m_UuidFactories[factory->getUuid()] = factory;
 }
@@ -204,11 +216,13 @@ QSet<QString> FilterManager::getSubGroupNames(const QString& groupName)
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName) const
 {
-  if(m_Factories.contains(filterName))
+  // Another thread may be adding the factories of a deferred plugin
+  QMutexLocker locker(&m_DeferredMutex);
+  if(!m_Factories.contains(filterName) && m_DeferredClassNames.contains(filterName))
   {
-    return m_Factories[filterName];
+    loadDeferredPlugin(m_DeferredClassNames[filterName]);
   }
-  return IFilterFactory::NullPointer();
+  return m_Factories.value(filterName, IFilterFactory::NullPointer());
 }
 
 
@@ -217,11 +231,13 @@ IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& fi
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) const
 {
-  if(m_UuidFactories.contains(uuid))
+  // Another thread may be adding the factories of a deferred plugin
+  QMutexLocker locker(&m_DeferredMutex);
+  if(!m_UuidFactories.contains(uuid) && m_DeferredUuids.contains(uuid))
   {
-    return m_UuidFactories[uuid];
+    loadDeferredPlugin(m_DeferredUuids[uuid]);
   }
-  return IFilterFactory::NullPointer();
+  return m_UuidFactories.value(uuid, IFilterFactory::NullPointer());
 }
 
 // -----------------------------------------------------------------------------
@@ -229,6 +245,8 @@ IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) con
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromHumanName(const QString& humanName)
 {
+  QMutexLocker locker(&m_DeferredMutex);
+  loadDeferredPlugins();
   IFilterFactory::Pointer Factory;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -268,3 +286,78 @@ QJsonArray FilterManager::toJsonArray() const
   }
   return filterArray;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::setDeferredPluginLoader(const DeferredPluginLoader& loader)
+{
+  QMutexLocker locker(&m_DeferredMutex);
+  m_DeferredPluginLoader = loader;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::addDeferredFilter(const QString& className, const QUuid& uuid, const QString& pluginPath)
+{
+  QMutexLocker locker(&m_DeferredMutex);
+  m_DeferredClassNames[className] = pluginPath;
+  m_DeferredUuids[uuid] = pluginPath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManager::hasDeferredFilters() const
+{
+  QMutexLocker locker(&m_DeferredMutex);
+  return !m_DeferredClassNames.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugins() const
+{
+  QMutexLocker locker(&m_DeferredMutex);
+  while(!m_DeferredClassNames.isEmpty())
+  {
+    loadDeferredPlugin(m_DeferredClassNames.first());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugin(const QString& pluginPath) const
+{
+  // Deferred plugins only add factories, so the lookup methods stay logically const
+  FilterManager* self = const_cast<FilterManager*>(this);
+  for(auto iter = self->m_DeferredClassNames.begin(); iter != self->m_DeferredClassNames.end();)
+  {
+    if(iter.value() == pluginPath)
+    {
+      iter = self->m_DeferredClassNames.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+  for(auto iter = self->m_DeferredUuids.begin(); iter != self->m_DeferredUuids.end();)
+  {
+    if(iter.value() == pluginPath)
+    {
+      iter = self->m_DeferredUuids.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+  if(m_DeferredPluginLoader)
+  {
+    m_DeferredPluginLoader(pluginPath);
+  }
+}
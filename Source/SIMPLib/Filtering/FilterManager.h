@@ -35,8 +35,11 @@
 
 #pragma once
 
+#include <functional>
+
 #include <QtCore/QMap>
 #include <QtCore/QMapIterator>
+#include <QtCore/QMutex>
 #include <QtCore/QString>
 #include <QtCore/QUuid>
 #include <QtCore/QJsonArray>
@@ -62,7 +65,12 @@ public:
 
   typedef QMap<QUuid, IFilterFactory::Pointer> UuidCollection;
   typedef QMapIterator<QUuid, IFilterFactory::Pointer> UuidCollectionIterator;
-  
+
+  /**
+   * @brief DeferredPluginLoader loads the plugin file at the given path and registers its filters
+   */
+  using DeferredPluginLoader = std::function<void(const QString& pluginPath)>;
+
   /**
    * @brief Static instance to retrieve the global instance of this class
    * @return
@@ -157,12 +165,53 @@ public:
    */
   QJsonArray toJsonArray() const;
 
+  /**
+   * @brief setDeferredPluginLoader Sets the function that loads a plugin whose filters were added
+   * with addDeferredFilter()
+   * @param loader
+   */
+  void setDeferredPluginLoader(const DeferredPluginLoader& loader);
+
+  /**
+   * @brief addDeferredFilter Records that the filter is provided by a plugin that has not been loaded yet.
+   * The plugin is loaded the first time the filter is looked up by class name or UUID, and every
+   * deferred plugin is loaded before the complete set of factories is enumerated.
+   * @param className
+   * @param uuid
+   * @param pluginPath
+   */
+  void addDeferredFilter(const QString& className, const QUuid& uuid, const QString& pluginPath);
+
+  /**
+   * @brief hasDeferredFilters Returns true while any plugin registered through addDeferredFilter() is still unloaded
+   * @return
+   */
+  bool hasDeferredFilters() const;
+
+  /**
+   * @brief loadDeferredPlugins Loads every plugin that is still deferred
+   */
+  void loadDeferredPlugins() const;
+
 protected:
   FilterManager();
 
 private:
   Collection m_Factories;
   UuidCollection m_UuidFactories;
+
+  DeferredPluginLoader m_DeferredPluginLoader;
+  QMap<QString, QString> m_DeferredClassNames;
+  QMap<QUuid, QString> m_DeferredUuids;
+  // Guards the factories and the deferred filters. Recursive, a plugin may look up filters while it registers its own
+  mutable QMutex m_DeferredMutex;
+
+  /**
+   * @brief loadDeferredPlugin Loads the plugin and removes all of its deferred filters. The
+   * caller must hold m_DeferredMutex.
+   * @param pluginPath
+   */
+  void loadDeferredPlugin(const QString& pluginPath) const;
   
   static FilterManager* s_Self;
 
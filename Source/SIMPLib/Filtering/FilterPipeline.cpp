@@ -35,22 +35,193 @@
 
 #include "FilterPipeline.h"
 
+#include <atomic>
+#include <functional>
+
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMetaProperty>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSet>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_group.h>
+#endif
+
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Collects the path of every DataContainer, AttributeMatrix and DataArray in dca that does not exist in other.
+// Called both ways round on the structure before and after a filter's preflight, this yields the paths
+// the filter created and the paths it removed, which also covers renames.
+// -----------------------------------------------------------------------------
+void CollectMissingPaths(const DataContainerArray::Pointer& dca, const DataContainerArray::Pointer& other, std::list<DataArrayPath>& paths)
+{
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    if(!other->doesDataContainerExist(dc->getName()))
+    {
+      paths.push_back(DataArrayPath(dc->getName(), "", ""));
+      continue;
+    }
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      DataArrayPath amPath(dc->getName(), am->getName(), "");
+      if(!other->doesAttributeMatrixExist(amPath))
+      {
+        paths.push_back(amPath);
+        continue;
+      }
+      for(const QString& daName : am->getAttributeArrayNames())
+      {
+        DataArrayPath daPath(dc->getName(), am->getName(), daName);
+        if(!other->doesAttributeArrayExist(daPath))
+        {
+          paths.push_back(daPath);
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Collects the paths a filter was configured to read or write. These are its DataArrayPath and proxy
+// properties, plus any QString property that names a DataContainer existing when the filter runs.
+// -----------------------------------------------------------------------------
+void CollectRequiredPaths(AbstractFilter* filter, const DataContainerArray::Pointer& incomingDca, std::list<DataArrayPath>& paths)
+{
+  const QMetaObject* metaObject = filter->metaObject();
+  for(int i = 0; i < metaObject->propertyCount(); i++)
+  {
+    QVariant var = metaObject->property(i).read(filter);
+    if(!var.isValid())
+    {
+      continue;
+    }
+    if(var.userType() == qMetaTypeId<DataArrayPath>())
+    {
+      paths.push_back(var.value<DataArrayPath>());
+    }
+    else if(var.userType() == qMetaTypeId<QVector<DataArrayPath>>())
+    {
+      for(const DataArrayPath& path : var.value<QVector<DataArrayPath>>())
+      {
+        paths.push_back(path);
+      }
+    }
+    else if(var.userType() == qMetaTypeId<DataContainerArrayProxy>())
+    {
+      DataContainerArrayProxy proxy = var.value<DataContainerArrayProxy>();
+      for(const DataContainerProxy& dcProxy : proxy.dataContainers)
+      {
+        if(dcProxy.flag != Qt::Unchecked)
+        {
+          paths.push_back(DataArrayPath(dcProxy.name, "", ""));
+        }
+      }
+    }
+    else if(var.userType() == QMetaType::QString && incomingDca->doesDataContainerExist(var.toString()))
+    {
+      paths.push_back(DataArrayPath(var.toString(), "", ""));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// A rename whose original path is created again by a later filter no longer applies downstream
+// -----------------------------------------------------------------------------
+void ForgetRenamesOfCreatedPaths(const std::list<DataArrayPath>& createdPaths, DataArrayPath::RenameContainer& renamedPaths, DataArrayPath::RenameContainer& filterRenamedPaths)
+{
+  for(const DataArrayPath& createdPath : createdPaths)
+  {
+    // Filter Parameter changes
+    for(const DataArrayPath::RenameType& rename : renamedPaths)
+    {
+      DataArrayPath originalPath;
+      DataArrayPath renamePath;
+      std::tie(originalPath, renamePath) = rename;
+      if(originalPath == createdPath)
+      {
+        renamedPaths.remove(rename);
+        break;
+      }
+    }
+    // Rename Filters
+    for(const DataArrayPath::RenameType& rename : filterRenamedPaths)
+    {
+      DataArrayPath originalPath;
+      DataArrayPath renamePath;
+      std::tie(originalPath, renamePath) = rename;
+      if(originalPath == createdPath)
+      {
+        filterRenamedPaths.remove(rename);
+        break;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Emits the filter's updateFilterParameters() signal so that any widgets connected to it push
+// their values down to the filter. Filters declare the signal themselves, so it is looked up by name.
+// -----------------------------------------------------------------------------
+void RequestWidgetValues(AbstractFilter* filter)
+{
+  const QMetaObject* metaObject = filter->metaObject();
+  int index = metaObject->indexOfSignal(QMetaObject::normalizedSignature("updateFilterParameters(AbstractFilter*)"));
+  if(index >= 0)
+  {
+    metaObject->method(index).invoke(filter, Qt::DirectConnection, Q_ARG(AbstractFilter*, filter));
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Reports loads of deferred array data that failed while the filter was running as an error of that
+// filter. The arrays themselves are zero filled by then, so the results are not usable. Failures are
+// recorded by the LazyLoadStatistics of the reader that deferred the arrays, so sources collects the
+// statistics of every reader that has run and only their failure lists are drained.
+// -----------------------------------------------------------------------------
+void ReportLazyLoadFailures(AbstractFilter* filter, QVector<LazyLoadStatistics::Pointer>& sources)
+{
+  DataContainerReader* reader = dynamic_cast<DataContainerReader*>(filter);
+  if(nullptr != reader && nullptr != reader->getLazyLoadStatistics() && !sources.contains(reader->getLazyLoadStatistics()))
+  {
+    sources.push_back(reader->getLazyLoadStatistics());
+  }
+  for(const LazyLoadStatistics::Pointer& statistics : sources)
+  {
+    for(const QString& error : statistics->takeFailures())
+    {
+      if(filter->getErrorCondition() >= 0)
+      {
+        filter->setErrorCondition(-85650);
+        filter->notifyErrorMessage(filter->getHumanLabel(), error, filter->getErrorCondition());
+      }
+    }
+  }
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 FilterPipeline::FilterPipeline()
 : m_ErrorCondition(0)
+, m_ExecuteInParallel(false)
 , m_Cancel(false)
 , m_PipelineName("")
 , m_Dca(nullptr)
+, m_Profile(nullptr)
 {
 }
 
@@ -291,6 +462,14 @@ void FilterPipeline::setCancel(bool value)
   {
     m_CurrentFilter->setCancel(value);
   }
+  // Filters running concurrently are not tracked through the CurrentFilter
+  if(m_ExecuteInParallel)
+  {
+    for(const auto& filter : m_Pipeline)
+    {
+      filter->setCancel(value);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -533,10 +712,41 @@ int FilterPipeline::preflightPipeline()
   DataArrayPath::RenameContainer renamedPaths;
   DataArrayPath::RenameContainer filterRenamedPaths;
 
+  // With a cache, filters are skipped for as long as they and everything upstream of them are unchanged
+  QByteArray signature;
+  bool upstreamChanged = (nullptr == m_PreflightCache.get());
+  DataContainerArray::Pointer cachedDca;
+  int index = -1;
+
   // Start looping through each filter in the Pipeline and preflight everything
   // for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
   for(const auto& filter : m_Pipeline)
   {
+    index++;
+    if(nullptr != m_PreflightCache.get())
+    {
+      // Values edited in the widgets only reach the filter when it asks for them, which preflight()
+      // does. Ask before computing the signature or an edit would look like a cache hit.
+      RequestWidgetValues(filter.get());
+      signature = PreflightCache::ComputeSignature(filter, signature);
+      const PreflightCache::Entry* entry = upstreamChanged ? nullptr : m_PreflightCache->find(index, signature);
+      if(nullptr != entry)
+      {
+        restoreCachedPreflight(filter, *entry, renamedPaths, filterRenamedPaths);
+        preflightError |= entry->errorCondition;
+        cachedDca = entry->dataContainerArray;
+        continue;
+      }
+      if(!upstreamChanged && nullptr != cachedDca.get())
+      {
+        // Continue from the structure the last unchanged filter left behind
+        dca = cachedDca->deepCopy(false);
+      }
+      upstreamChanged = true;
+    }
+
+    QVector<PipelineMessage> messages;
+
     // Do not preflight disabled filters
     if(filter->getEnabled())
     {
@@ -552,7 +762,13 @@ int FilterPipeline::preflightPipeline()
       filter->renameDataArrayPaths(renamedPaths);
       setCurrentFilter(filter);
       connectFilterNotifications(filter.get());
+      QMetaObject::Connection recorder;
+      if(nullptr != m_PreflightCache.get())
+      {
+        recorder = connect(filter.get(), &AbstractFilter::filterGeneratedMessage, [&messages](const PipelineMessage& msg) { messages.push_back(msg); });
+      }
       filter->preflight();
+      disconnect(recorder);
       disconnectFilterNotifications(filter.get());
 
       filter->setCancel(false); // Reset the cancel flag
@@ -561,33 +777,7 @@ int FilterPipeline::preflightPipeline()
       std::list<DataArrayPath> currentCreatedPaths = filter->getCreatedPaths();
 
       // Check if an existing renamed path was created by this filter
-      for(const DataArrayPath& createdPath : currentCreatedPaths)
-      {
-        // Filter Parameter changes
-        for(const DataArrayPath::RenameType& rename : renamedPaths)
-        {
-          DataArrayPath originalPath;
-          DataArrayPath renamePath;
-          std::tie(originalPath, renamePath) = rename;
-          if(originalPath == createdPath)
-          {
-            renamedPaths.remove(rename);
-            break;
-          }
-        }
-        // Rename Filters
-        for(const DataArrayPath::RenameType& rename : filterRenamedPaths)
-        {
-          DataArrayPath originalPath;
-          DataArrayPath renamePath;
-          std::tie(originalPath, renamePath) = rename;
-          if(originalPath == createdPath)
-          {
-            filterRenamedPaths.remove(rename);
-            break;
-          }
-        }
-      }
+      ForgetRenamesOfCreatedPaths(currentCreatedPaths, renamedPaths, filterRenamedPaths);
 
       DataArrayPath::RenameContainer newRenamedPaths = DataArrayPath::CheckForRenamedPaths(oldDca, dca, oldCreatedPaths, currentCreatedPaths);
       for(const DataArrayPath::RenameType& renameType : newRenamedPaths)
@@ -621,25 +811,405 @@ int FilterPipeline::preflightPipeline()
         renamedPaths.push_back(renameType);
       }
     }
+
+    if(nullptr != m_PreflightCache.get())
+    {
+      PreflightCache::Entry entry;
+      entry.signature = signature;
+      entry.dataContainerArray = filter->getDataContainerArray();
+      entry.errorCondition = filter->getErrorCondition();
+      entry.warningCondition = filter->getWarningCondition();
+      entry.messages = messages;
+      m_PreflightCache->store(index, entry);
+    }
   }
   setCurrentFilter(AbstractFilter::NullPointer());
 
+  if(nullptr != m_PreflightCache.get())
+  {
+    m_PreflightCache->truncate(m_Pipeline.size());
+  }
+
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::restoreCachedPreflight(const AbstractFilter::Pointer& filter, const PreflightCache::Entry& entry, DataArrayPath::RenameContainer& renamedPaths,
+                                            DataArrayPath::RenameContainer& filterRenamedPaths)
+{
+  // The filter may have been handed the real data while executing since it was preflighted
+  if(filter->getDataContainerArray() != entry.dataContainerArray)
+  {
+    filter->setDataContainerArray(entry.dataContainerArray);
+  }
+  filter->setErrorCondition(entry.errorCondition);
+  filter->setWarningCondition(entry.warningCondition);
+
+  // Report the messages of the skipped preflight again so listeners see the same issues
+  connectFilterNotifications(filter.get());
+  for(const PipelineMessage& msg : entry.messages)
+  {
+    filter->broadcastPipelineMessage(msg);
+  }
+  disconnectFilterNotifications(filter.get());
+
+  if(filter->getEnabled())
+  {
+    // An unchanged filter creates the same paths as before, so only the renames it performs itself carry on
+    if(!renamedPaths.empty() || !filterRenamedPaths.empty())
+    {
+      ForgetRenamesOfCreatedPaths(filter->getCreatedPaths(), renamedPaths, filterRenamedPaths);
+    }
+    DataArrayPath::RenameContainer hardRenamePaths = filter->getRenamedPaths();
+    for(const DataArrayPath::RenameType& renameType : hardRenamePaths)
+    {
+      renamedPaths.push_back(renameType);
+      filterRenamedPaths.push_back(renameType);
+    }
+  }
+  else
+  {
+    // Undo filter renaming
+    DataArrayPath::RenameContainer disabledRenamePaths = filter->getRenamedPaths();
+    for(const DataArrayPath::RenameType& renameType : disabledRenamePaths)
+    {
+      DataArrayPath oldPath;
+      DataArrayPath newPath;
+      std::tie(oldPath, newPath) = renameType;
+      renamedPaths.push_back(std::make_pair(newPath, oldPath));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::collectDataContainerReferences(QVector<QSet<QString>>& references, QVector<bool>& barriers)
+{
+  int count = m_Pipeline.size();
+  references = QVector<QSet<QString>>(count);
+  barriers = QVector<bool>(count, false);
+
+  // Each filter keeps the structure its preflight produced, so the structure a filter starts from is
+  // the one the filter before it left behind
+  DataContainerArray::Pointer incomingDca = DataContainerArray::New();
+  for(int i = 0; i < count; i++)
+  {
+    const AbstractFilter::Pointer& filter = m_Pipeline.at(i);
+    DataContainerArray::Pointer outgoingDca = filter->getDataContainerArray();
+    if(nullptr == outgoingDca.get())
+    {
+      // Without a preflighted structure nothing is known about the filter, so it may touch anything
+      barriers[i] = filter->getEnabled();
+      continue;
+    }
+    if(!filter->getEnabled())
+    {
+      incomingDca = outgoingDca;
+      continue;
+    }
+
+    std::list<DataArrayPath> paths;
+    CollectMissingPaths(outgoingDca, incomingDca, paths);
+    CollectMissingPaths(incomingDca, outgoingDca, paths);
+    CollectRequiredPaths(filter.get(), incomingDca, paths);
+    for(const DataArrayPath::RenameType& rename : filter->getRenamedPaths())
+    {
+      paths.push_back(std::get<0>(rename));
+      paths.push_back(std::get<1>(rename));
+    }
+
+    for(const DataArrayPath& path : paths)
+    {
+      references[i].insert(path.getDataContainerName());
+    }
+    references[i].remove(QString(""));
+
+    // A filter that does not name any DataContainer may touch all of them
+    barriers[i] = references[i].isEmpty();
+    incomingDca = outgoingDca;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QVector<int>> FilterPipeline::computeFilterDependencies()
+{
+  QVector<QSet<QString>> references;
+  QVector<bool> barriers;
+  collectDataContainerReferences(references, barriers);
+  return computeFilterDependencies(references, barriers);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QVector<int>> FilterPipeline::computeFilterDependencies(const QVector<QSet<QString>>& references, const QVector<bool>& barriers)
+{
+  int count = m_Pipeline.size();
+  QVector<QVector<int>> dependencies(count);
+  for(int j = 0; j < count; j++)
+  {
+    if(!m_Pipeline.at(j)->getEnabled())
+    {
+      continue;
+    }
+    for(int i = 0; i < j; i++)
+    {
+      if(!m_Pipeline.at(i)->getEnabled())
+      {
+        continue;
+      }
+      if(barriers[i] || barriers[j] || references[i].intersects(references[j]))
+      {
+        dependencies[j].push_back(i);
+      }
+    }
+  }
+
+  return dependencies;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 DataContainerArray::Pointer FilterPipeline::execute()
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(m_ExecuteInParallel)
+  {
+    return executeInParallel();
+  }
+#endif
+  return executeSerially();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::Pointer FilterPipeline::getProfile()
+{
+  return m_Profile;
+}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::executeInParallel()
+{
+  // The dependency graph is derived from the structure each filter produces during
+  // preflight. If the pipeline does not preflight cleanly, let the serial path report the errors.
+  if(preflightPipeline() < 0)
+  {
+    return executeSerially();
+  }
+  QVector<QSet<QString>> references;
+  QVector<bool> barriers;
+  collectDataContainerReferences(references, barriers);
+  QVector<QVector<int>> dependencies = computeFilterDependencies(references, barriers);
+
+  // Clear pipeline cancel state
+  setCancel(false);
+  setErrorCondition(0);
+
+  connectSignalsSlots();
+
+  m_Dca = DataContainerArray::New();
+  m_LazyLoadStatistics.clear();
+  m_Profile = PipelineProfile::New();
+  m_Profile->start();
+
+  // Connect this object to anything that wants to know about PipelineMessages
+  for(const auto& messageReceiver : m_MessageReceivers)
+  {
+    connect(this, SIGNAL(pipelineGeneratedMessage(const PipelineMessage&)), messageReceiver, SLOT(processPipelineMessage(const PipelineMessage&)));
+  }
+
+  int count = m_Pipeline.size();
+  QVector<QVector<int>> successors(count);
+  std::vector<std::atomic<int>> pendingCounts(static_cast<size_t>(count));
+  for(int j = 0; j < count; j++)
+  {
+    pendingCounts[j].store(dependencies[j].size());
+    for(int i : dependencies[j])
+    {
+      successors[i].push_back(j);
+    }
+  }
+
+  // Guards m_Dca, the progress counter and the error state
+  QMutex mutex;
+  int completed = 0;
+  AbstractFilter::Pointer failedFilter = AbstractFilter::NullPointer();
+  std::atomic<bool> abort(false);
+
+  tbb::task_group taskGroup;
+  std::function<void(int)> runFilter;
+  runFilter = [&](int index) {
+    const AbstractFilter::Pointer& filt = m_Pipeline.at(index);
+    QString ss = QObject::tr("[%1/%2] %3 ").arg(index + 1).arg(count).arg(filt->getHumanLabel());
+
+    bool executed = filt->getEnabled() && !abort.load() && !getCancel();
+    if(executed)
+    {
+      // Build a private DataContainerArray that only holds the DataContainers this filter references.
+      // No other running filter shares any of them, so the DataContainers themselves need no locking.
+      // A barrier filter always runs alone and so gets the full DataContainerArray.
+      DataContainerArray::Pointer view = m_Dca;
+      QList<DataContainer::Pointer> initialContainers;
+      if(!barriers[index])
+      {
+        view = DataContainerArray::New();
+        QMutexLocker locker(&mutex);
+        for(const QString& name : references[index])
+        {
+          DataContainer::Pointer dc = m_Dca->getDataContainer(name);
+          if(nullptr != dc.get())
+          {
+            view->addDataContainer(dc);
+            initialContainers.push_back(dc);
+          }
+        }
+      }
+
+      emit filt->filterInProgress(filt.get());
+      filt->setMessagePrefix(ss);
+      connectFilterNotifications(filt.get());
+      filt->setDataContainerArray(view);
+      PipelineProfile::Sample before = m_Profile->sample();
+      filt->execute();
+      PipelineProfile::FilterRecord record = m_Profile->record(filt.get(), before);
+
+      QMutexLocker locker(&mutex);
+      // A failed load of an array shared with a filter that is still running is reported by whichever finishes first
+      ReportLazyLoadFailures(filt.get(), m_LazyLoadStatistics);
+      disconnectFilterNotifications(filt.get());
+      filt->setDataContainerArray(DataContainerArray::NullPointer());
+      emit pipelineGeneratedMessage(record.toMessage());
+      if(!barriers[index])
+      {
+        // Publish removed, replaced and newly created DataContainers back into the pipeline's array
+        const QList<DataContainer::Pointer>& finalContainers = view->getDataContainers();
+        for(const DataContainer::Pointer& dc : initialContainers)
+        {
+          if(!finalContainers.contains(dc))
+          {
+            m_Dca->removeDataContainer(dc->getName());
+          }
+        }
+        for(const DataContainer::Pointer& dc : finalContainers)
+        {
+          if(!m_Dca->getDataContainers().contains(dc))
+          {
+            m_Dca->removeDataContainer(dc->getName());
+            m_Dca->addDataContainer(dc);
+          }
+        }
+      }
+
+      if(filt->getErrorCondition() < 0 && nullptr == failedFilter.get())
+      {
+        failedFilter = filt;
+        abort.store(true);
+      }
+    }
+
+    {
+      QMutexLocker locker(&mutex);
+      completed++;
+      PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::ProgressValue, -1);
+      progValue.setProgressValue(static_cast<int>(static_cast<float>(completed) / (count + 1) * 100.0f));
+      emit pipelineGeneratedMessage(progValue);
+      progValue.setType(PipelineMessage::MessageType::StatusMessage);
+      progValue.setText(ss);
+      emit pipelineGeneratedMessage(progValue);
+    }
+    // Disabled filters and filters skipped after an error or a cancel never started
+    if(executed)
+    {
+      emit filt->filterCompleted(filt.get());
+    }
+
+    // Release every filter that was only waiting on this one. Successors are still visited after
+    // an error or a cancel so that the task group drains, they just skip their execute().
+    for(int next : successors[index])
+    {
+      if(pendingCounts[next].fetch_sub(1) == 1)
+      {
+        taskGroup.run([&runFilter, next] { runFilter(next); });
+      }
+    }
+  };
+
+  for(int j = 0; j < count; j++)
+  {
+    if(dependencies[j].isEmpty())
+    {
+      taskGroup.run([&runFilter, j] { runFilter(j); });
+    }
+  }
+  taskGroup.wait();
+
+  if(getCancel())
+  {
+    for(const auto& filt : m_Pipeline)
+    {
+      filt->setCancel(false);
+    }
+  }
+
+  if(nullptr != failedFilter.get())
+  {
+    setErrorCondition(failedFilter->getErrorCondition());
+    PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::Error, -1);
+    progValue.setFilterClassName(failedFilter->getNameOfClass());
+    progValue.setFilterHumanLabel(failedFilter->getHumanLabel());
+    progValue.setProgressValue(100);
+    QString ss = QObject::tr("[%1/%2] %3 caused an error during execution.").arg(failedFilter->getPipelineIndex() + 1).arg(count).arg(failedFilter->getHumanLabel());
+    progValue.setText(ss);
+    progValue.setPipelineIndex(failedFilter->getPipelineIndex());
+    progValue.setCode(failedFilter->getErrorCondition());
+    emit pipelineGeneratedMessage(progValue);
+    m_Profile->finish();
+    emit pipelineFinished();
+    disconnectSignalsSlots();
+
+    return m_Dca;
+  }
+
+  m_Profile->finish();
+  emit pipelineFinished();
+
+  disconnectSignalsSlots();
+
+  PipelineMessage completeMessage("", "Pipeline Complete", 0, PipelineMessage::MessageType::StatusMessage, -1);
+  emit pipelineGeneratedMessage(completeMessage);
+
+  return m_Dca;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer FilterPipeline::executeSerially()
 {
   int err = 0;
 
   // Clear pipeline cancel state
   setCancel(false);
+  setErrorCondition(0);
 
   connectSignalsSlots();
 
   m_Dca = DataContainerArray::New();
+  m_LazyLoadStatistics.clear();
+  m_Profile = PipelineProfile::New();
+  m_Profile->start();
 
   // Start looping through the Pipeline
   float progress = 0.0f;
@@ -672,7 +1242,10 @@ DataContainerArray::Pointer FilterPipeline::execute()
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
       setCurrentFilter(filt);
+      PipelineProfile::Sample before = m_Profile->sample();
       filt->execute();
+      ReportLazyLoadFailures(filt.get(), m_LazyLoadStatistics);
+      emit pipelineGeneratedMessage(m_Profile->record(filt.get(), before).toMessage());
       disconnectFilterNotifications(filt.get());
       filt->setDataContainerArray(DataContainerArray::NullPointer());
       err = filt->getErrorCondition();
@@ -689,6 +1262,7 @@ DataContainerArray::Pointer FilterPipeline::execute()
         progValue.setCode(filt->getErrorCondition());
         emit pipelineGeneratedMessage(progValue);
         emit filt->filterCompleted(filt.get());
+        m_Profile->finish();
         emit pipelineFinished();
         disconnectSignalsSlots();
 
@@ -707,6 +1281,7 @@ DataContainerArray::Pointer FilterPipeline::execute()
     emit filt->filterCompleted(filt.get());
   }
 
+  m_Profile->finish();
   emit pipelineFinished();
 
   disconnectSignalsSlots();
@@ -759,3 +1334,11 @@ DataContainerArray::Pointer FilterPipeline::getDataContainerArray()
 {
   return m_Dca;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::releaseDataContainerArray()
+{
+  m_Dca = DataContainerArray::NullPointer();
+}
@@ -38,12 +38,16 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/LazyLoadStatistics.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
@@ -66,6 +70,7 @@ class SIMPLib_EXPORT FilterPipeline : public QObject
   PYB11_PROPERTY(AbstractFilter CurrentFilter READ getCurrentFilter WRITE setCurrentFilter)
   PYB11_PROPERTY(bool Cancel READ getCancel WRITE setCancel)
   PYB11_PROPERTY(QString Name READ getName WRITE setName)
+  PYB11_PROPERTY(bool ExecuteInParallel READ getExecuteInParallel WRITE setExecuteInParallel)
   
   PYB11_METHOD(DataContainerArray::Pointer run)
   PYB11_METHOD(void preflightPipeline)
@@ -90,6 +95,23 @@ public:
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief When enabled, execute() preflights the pipeline, builds a dependency graph from the
+   * DataContainers each filter references or creates and runs filters that do not share any
+   * DataContainer concurrently. Filters that reference no DataContainer at all (writers, external
+   * processes, etc) act as barriers. This mode requires SIMPLib to be compiled with
+   * SIMPL_USE_PARALLEL_ALGORITHMS, otherwise the filters are executed serially.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, ExecuteInParallel)
+
+  /**
+   * @brief When set, preflightPipeline() only preflights from the first filter whose parameters,
+   * enabled state or upstream filters changed since the cache was last filled. The filters before it
+   * get their DataContainerArray, error/warning conditions and messages back from the cache. The
+   * cache should be kept by the owner of the filters, since FilterPipelines are cheap to rebuild.
+   */
+  SIMPL_INSTANCE_PROPERTY(PreflightCache::Pointer, PreflightCache)
+
   /**
    * @brief Cancel the operation
    */
@@ -108,6 +130,23 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief Returns the timing and memory measurements of the most recent execute(). Each record is
+   * also sent as a PipelineMessage::MessageType::FilterProfile message right after its filter finishes.
+   * @return The profile or nullptr if the pipeline has not been executed
+   */
+  virtual PipelineProfile::Pointer getProfile();
+
+  /**
+   * @brief Computes, for each filter in the pipeline, the indices of the earlier filters that
+   * must finish executing before that filter may start. Two filters depend on each other if the
+   * paths they require, create, remove or rename share a DataContainer or if either of them is a barrier filter. Disabled
+   * filters have no dependencies and nothing depends on them. This method requires preflightPipeline()
+   * to have been run.
+   * @return One list of predecessor indices per filter
+   */
+  virtual QVector<QVector<int>> computeFilterDependencies();
+
   /**
    * @brief
    */
@@ -125,6 +164,12 @@ public:
 
   virtual DataContainerArray::Pointer getDataContainerArray();
 
+  /**
+   * @brief releaseDataContainerArray Drops the DataContainerArray created by the last execution so a
+   * pipeline that is kept around to be run again does not hold on to its data in between.
+   */
+  virtual void releaseDataContainerArray();
+
   /**
    * @brief
    */
@@ -232,10 +277,43 @@ private:
   QVector<QObject*> m_MessageReceivers;
 
   DataContainerArray::Pointer m_Dca;
+  PipelineProfile::Pointer m_Profile;
+  QVector<LazyLoadStatistics::Pointer> m_LazyLoadStatistics;
 
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Executes every filter in pipeline order against a single DataContainerArray
+   */
+  DataContainerArray::Pointer executeSerially();
+
+  /**
+   * @brief Collects the names of the DataContainers holding the paths each enabled filter requires
+   * through its DataArrayPath properties, or creates, removes or renames according to its preflighted
+   * structure. Filters that name no DataContainer are flagged as barriers.
+   */
+  void collectDataContainerReferences(QVector<QSet<QString>>& references, QVector<bool>& barriers);
+
+  /**
+   * @brief Builds the graph of computeFilterDependencies() from references collected by collectDataContainerReferences()
+   */
+  QVector<QVector<int>> computeFilterDependencies(const QVector<QSet<QString>>& references, const QVector<bool>& barriers);
+
+  /**
+   * @brief Puts a filter back into the state its cached preflight left it in and carries the
+   * renames it performs on to the filters downstream of it
+   */
+  void restoreCachedPreflight(const AbstractFilter::Pointer& filter, const PreflightCache::Entry& entry, DataArrayPath::RenameContainer& renamedPaths,
+                              DataArrayPath::RenameContainer& filterRenamedPaths);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  /**
+   * @brief Executes independent filters concurrently using the graph from computeFilterDependencies()
+   */
+  DataContainerArray::Pointer executeInParallel();
+#endif
+
 public:
   FilterPipeline(const FilterPipeline&) = delete; // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;      // Move Constructor Not Implemented
@@ -0,0 +1,365 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineProfile.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+#include "SIMPLib/DataArrays/IDataStorage.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+/**
+ * @brief WriteJsonFile Writes a JSON object to a file, replacing its contents
+ */
+bool WriteJsonFile(const QString& filePath, const QJsonObject& json)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  QJsonDocument doc(json);
+  return file.write(doc.toJson()) >= 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::PipelineProfile() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::~PipelineProfile() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::start()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Records.clear();
+  m_TotalWallTime = 0;
+  m_TotalCPUTime = 0;
+  m_TotalAllocatedBytes = 0;
+  m_StartCPUTime = ProcessCPUTime();
+  m_StartAllocatedBytes = IDataStorage::GetTotalAllocatedBytes();
+  m_Timer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProfile::finish()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_TotalWallTime = m_Timer.nsecsElapsed() / 1000;
+  m_TotalCPUTime = ProcessCPUTime() - m_StartCPUTime;
+  m_TotalAllocatedBytes = IDataStorage::GetTotalAllocatedBytes() - m_StartAllocatedBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::Sample PipelineProfile::sample() const
+{
+  Sample sample;
+  sample.wallTime = m_Timer.nsecsElapsed() / 1000;
+  sample.cpuTime = ProcessCPUTime();
+  sample.allocatedBytes = IDataStorage::GetTotalAllocatedBytes();
+  return sample;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::FilterRecord PipelineProfile::record(AbstractFilter* filter, const Sample& before)
+{
+  Sample after = sample();
+
+  FilterRecord record;
+  record.pipelineIndex = filter->getPipelineIndex();
+  record.filterClassName = filter->getNameOfClass();
+  record.filterHumanLabel = filter->getHumanLabel();
+  record.startTime = before.wallTime;
+  record.wallTime = after.wallTime - before.wallTime;
+  record.cpuTime = after.cpuTime - before.cpuTime;
+  record.allocatedBytes = after.allocatedBytes - before.allocatedBytes;
+  record.peakMemory = PeakMemory();
+  record.threadId = static_cast<quint64>(reinterpret_cast<quintptr>(QThread::currentThreadId()));
+  record.errorCondition = filter->getErrorCondition();
+
+  QMutexLocker locker(&m_Mutex);
+  m_Records.push_back(record);
+  return record;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PipelineProfile::FilterRecord> PipelineProfile::getFilterRecords() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Records;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineProfile::getTotalWallTime() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_TotalWallTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::toJson() const
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonArray filters;
+  for(const FilterRecord& record : m_Records)
+  {
+    filters.append(record.toJson());
+  }
+
+  QJsonObject json;
+  json["WallTime"] = static_cast<double>(m_TotalWallTime);
+  json["CPUTime"] = static_cast<double>(m_TotalCPUTime);
+  json["AllocatedBytes"] = static_cast<double>(m_TotalAllocatedBytes);
+  json["PeakMemory"] = static_cast<double>(PeakMemory());
+  json["Filters"] = filters;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::toChromeTrace() const
+{
+  QMutexLocker locker(&m_Mutex);
+  const qint64 pid = QCoreApplication::applicationPid();
+
+  // Number the threads in the order they first ran a filter so the lanes stay readable
+  QHash<quint64, int> lanes;
+  QJsonArray events;
+  for(const FilterRecord& record : m_Records)
+  {
+    if(!lanes.contains(record.threadId))
+    {
+      int lane = lanes.size();
+      lanes.insert(record.threadId, lane);
+
+      QJsonObject laneArgs;
+      laneArgs["name"] = QString("Pipeline Thread %1").arg(lane);
+      QJsonObject laneName;
+      laneName["name"] = QString("thread_name");
+      laneName["ph"] = QString("M");
+      laneName["pid"] = pid;
+      laneName["tid"] = lane;
+      laneName["args"] = laneArgs;
+      events.append(laneName);
+    }
+
+    QJsonObject args;
+    args["FilterClassName"] = record.filterClassName;
+    args["PipelineIndex"] = record.pipelineIndex;
+    args["CPUTime"] = static_cast<double>(record.cpuTime);
+    args["AllocatedBytes"] = static_cast<double>(record.allocatedBytes);
+    args["PeakMemory"] = static_cast<double>(record.peakMemory);
+    args["ErrorCondition"] = record.errorCondition;
+
+    QJsonObject event;
+    event["name"] = record.filterHumanLabel;
+    event["cat"] = QString("Filter");
+    event["ph"] = QString("X");
+    event["ts"] = static_cast<double>(record.startTime);
+    event["dur"] = static_cast<double>(record.wallTime);
+    event["pid"] = pid;
+    event["tid"] = lanes.value(record.threadId);
+    event["args"] = args;
+    events.append(event);
+
+    QJsonObject memoryArgs;
+    memoryArgs["Peak Memory"] = static_cast<double>(record.peakMemory);
+    QJsonObject memory;
+    memory["name"] = QString("Memory");
+    memory["ph"] = QString("C");
+    memory["ts"] = static_cast<double>(record.startTime + record.wallTime);
+    memory["pid"] = pid;
+    memory["args"] = memoryArgs;
+    events.append(memory);
+  }
+
+  QJsonObject trace;
+  trace["traceEvents"] = events;
+  trace["displayTimeUnit"] = QString("ms");
+  return trace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProfile::writeJson(const QString& filePath) const
+{
+  return WriteJsonFile(filePath, toJson());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProfile::writeChromeTrace(const QString& filePath) const
+{
+  return WriteJsonFile(filePath, toChromeTrace());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineProfile::ProcessCPUTime()
+{
+#if defined(_WIN32)
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if(!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+  {
+    return 0;
+  }
+  ULARGE_INTEGER kernel, user;
+  kernel.LowPart = kernelTime.dwLowDateTime;
+  kernel.HighPart = kernelTime.dwHighDateTime;
+  user.LowPart = userTime.dwLowDateTime;
+  user.HighPart = userTime.dwHighDateTime;
+  // FILETIME counts 100 nanosecond intervals
+  return static_cast<qint64>((kernel.QuadPart + user.QuadPart) / 10);
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+  qint64 seconds = static_cast<qint64>(usage.ru_utime.tv_sec) + static_cast<qint64>(usage.ru_stime.tv_sec);
+  qint64 microseconds = static_cast<qint64>(usage.ru_utime.tv_usec) + static_cast<qint64>(usage.ru_stime.tv_usec);
+  return seconds * 1000000 + microseconds;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 PipelineProfile::PeakMemory()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return 0;
+  }
+  return static_cast<quint64>(counters.PeakWorkingSetSize);
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return static_cast<quint64>(usage.ru_maxrss);
+#else
+  // Linux reports kilobytes
+  return static_cast<quint64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineProfile::FilterRecord::toJson() const
+{
+  QJsonObject json;
+  json["PipelineIndex"] = pipelineIndex;
+  json["FilterClassName"] = filterClassName;
+  json["FilterHumanLabel"] = filterHumanLabel;
+  json["StartTime"] = static_cast<double>(startTime);
+  json["WallTime"] = static_cast<double>(wallTime);
+  json["CPUTime"] = static_cast<double>(cpuTime);
+  json["AllocatedBytes"] = static_cast<double>(allocatedBytes);
+  json["PeakMemory"] = static_cast<double>(peakMemory);
+  json["ErrorCondition"] = errorCondition;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessage PipelineProfile::FilterRecord::toMessage() const
+{
+  return PipelineMessage::CreateProfileMessage(filterClassName, filterHumanLabel, pipelineIndex, toJson());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProfile::FilterRecord PipelineProfile::FilterRecord::FromJson(const QJsonObject& json)
+{
+  FilterRecord record;
+  record.pipelineIndex = json["PipelineIndex"].toInt(-1);
+  record.filterClassName = json["FilterClassName"].toString();
+  record.filterHumanLabel = json["FilterHumanLabel"].toString();
+  record.startTime = static_cast<qint64>(json["StartTime"].toDouble());
+  record.wallTime = static_cast<qint64>(json["WallTime"].toDouble());
+  record.cpuTime = static_cast<qint64>(json["CPUTime"].toDouble());
+  record.allocatedBytes = static_cast<quint64>(json["AllocatedBytes"].toDouble());
+  record.peakMemory = static_cast<quint64>(json["PeakMemory"].toDouble());
+  record.errorCondition = json["ErrorCondition"].toInt();
+  return record;
+}
@@ -0,0 +1,209 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+class AbstractFilter;
+
+/**
+ * @brief The PipelineProfile class records, for each filter of an executing pipeline, the wall and
+ * CPU time it took, the number of bytes it requested for DataArrays and the peak memory of the process
+ * when it finished. FilterPipeline fills in a new profile on every execute() and also sends each record
+ * as a PipelineMessage::MessageType::FilterProfile message. A profile can be saved as a JSON report or
+ * in the Chrome trace event format that chrome://tracing and Perfetto show as a timeline.
+ *
+ * CPU time and allocated bytes are process wide counters that are sampled before and after each filter,
+ * so when filters run concurrently (see FilterPipeline::setExecuteInParallel()) the numbers of
+ * overlapping filters include each other's work. All times are in microseconds.
+ */
+class SIMPLib_EXPORT PipelineProfile
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineProfile)
+  SIMPL_STATIC_NEW_MACRO(PipelineProfile)
+  SIMPL_TYPE_MACRO(PipelineProfile)
+
+  virtual ~PipelineProfile();
+
+  /**
+   * @brief The Sample struct holds the counters read just before a filter starts
+   */
+  struct Sample
+  {
+    qint64 wallTime = 0; // Since start()
+    qint64 cpuTime = 0;
+    quint64 allocatedBytes = 0;
+  };
+
+  /**
+   * @brief The FilterRecord struct holds the measurements of one executed filter
+   */
+  struct SIMPLib_EXPORT FilterRecord
+  {
+    int pipelineIndex = -1;
+    QString filterClassName;
+    QString filterHumanLabel;
+    qint64 startTime = 0; // Since the pipeline started
+    qint64 wallTime = 0;
+    qint64 cpuTime = 0;
+    quint64 allocatedBytes = 0;
+    quint64 peakMemory = 0;
+    quint64 threadId = 0;
+    int errorCondition = 0;
+
+    /**
+     * @brief toJson
+     * @return
+     */
+    QJsonObject toJson() const;
+
+    /**
+     * @brief toMessage Returns the FilterProfile message that reports this record
+     * @return
+     */
+    PipelineMessage toMessage() const;
+
+    /**
+     * @brief FromJson Reads back a record written by toJson()
+     * @param json
+     * @return
+     */
+    static FilterRecord FromJson(const QJsonObject& json);
+  };
+
+  /**
+   * @brief start Clears the records and starts the pipeline clock
+   */
+  void start();
+
+  /**
+   * @brief finish Stops the pipeline clock
+   */
+  void finish();
+
+  /**
+   * @brief sample Reads the counters. Call this just before a filter executes and pass the result to record().
+   * @return
+   */
+  Sample sample() const;
+
+  /**
+   * @brief record Adds the record of a filter that just finished executing. This method is thread safe.
+   * @param filter
+   * @param before The counters from just before the filter started
+   * @return The new record
+   */
+  FilterRecord record(AbstractFilter* filter, const Sample& before);
+
+  /**
+   * @brief getFilterRecords Returns the records in the order the filters finished
+   * @return
+   */
+  QVector<FilterRecord> getFilterRecords() const;
+
+  /**
+   * @brief getTotalWallTime Returns the time between start() and finish()
+   * @return
+   */
+  qint64 getTotalWallTime() const;
+
+  /**
+   * @brief toJson Returns the pipeline totals and the list of filter records
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief toChromeTrace Returns the profile in the Chrome trace event format. Each filter is a
+   * complete ("X") event on the lane of the thread that executed it and the peak memory is a counter.
+   * @return
+   */
+  QJsonObject toChromeTrace() const;
+
+  /**
+   * @brief writeJson Writes toJson() to a file
+   * @param filePath
+   * @return false if the file could not be written
+   */
+  bool writeJson(const QString& filePath) const;
+
+  /**
+   * @brief writeChromeTrace Writes toChromeTrace() to a file
+   * @param filePath
+   * @return false if the file could not be written
+   */
+  bool writeChromeTrace(const QString& filePath) const;
+
+  /**
+   * @brief ProcessCPUTime Returns the user and system time used by every thread of the process
+   * @return
+   */
+  static qint64 ProcessCPUTime();
+
+  /**
+   * @brief PeakMemory Returns the largest resident set size the process has reached, in bytes
+   * @return
+   */
+  static quint64 PeakMemory();
+
+protected:
+  PipelineProfile();
+
+private:
+  mutable QMutex m_Mutex;
+  QElapsedTimer m_Timer;
+  QVector<FilterRecord> m_Records;
+  qint64 m_TotalWallTime = 0;
+  qint64 m_StartCPUTime = 0;
+  qint64 m_TotalCPUTime = 0;
+  quint64 m_StartAllocatedBytes = 0;
+  quint64 m_TotalAllocatedBytes = 0;
+
+public:
+  PipelineProfile(const PipelineProfile&) = delete; // Copy Constructor Not Implemented
+  PipelineProfile(PipelineProfile&&) = delete;      // Move Constructor Not Implemented
+  PipelineProfile& operator=(const PipelineProfile&) = delete; // Copy Assignment Not Implemented
+  PipelineProfile& operator=(PipelineProfile&&) = delete;      // Move Assignment Not Implemented
+};
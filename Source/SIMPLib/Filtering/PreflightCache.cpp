@@ -0,0 +1,198 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PreflightCache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Utilities/SIMPLDataPathValidator.h"
+
+namespace
+{
+/**
+ * @brief Adds the size and modification time of every existing file or directory named in the filter
+ * parameters, so that readers preflight again when their input changes on disk. Relative paths are
+ * resolved the way the readers resolve them. For a directory, i.e. an image stack, the files directly
+ * inside it are stamped as well.
+ */
+void addFileStamps(const QJsonValue& value, QCryptographicHash& hash)
+{
+  if(value.isString())
+  {
+    QString path = value.toString();
+    if(path.isEmpty())
+    {
+      return;
+    }
+    QFileInfo fi(path);
+    if(fi.isRelative())
+    {
+      fi.setFile(SIMPLDataPathValidator::Instance()->convertToAbsolutePath(path));
+    }
+    if(fi.isFile())
+    {
+      hash.addData(QByteArray::number(fi.size()));
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+    }
+    else if(fi.isDir())
+    {
+      hash.addData(QByteArray::number(fi.lastModified().toMSecsSinceEpoch()));
+      QFileInfoList entries = QDir(fi.absoluteFilePath()).entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+      for(const QFileInfo& entry : entries)
+      {
+        hash.addData(entry.fileName().toUtf8());
+        hash.addData(QByteArray::number(entry.size()));
+        hash.addData(QByteArray::number(entry.lastModified().toMSecsSinceEpoch()));
+      }
+    }
+  }
+  else if(value.isArray())
+  {
+    for(const QJsonValue& item : value.toArray())
+    {
+      addFileStamps(item, hash);
+    }
+  }
+  else if(value.isObject())
+  {
+    for(const QJsonValue& item : value.toObject())
+    {
+      addFileStamps(item, hash);
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightCache::PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PreflightCache::~PreflightCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PreflightCache::ComputeSignature(const AbstractFilter::Pointer& filter, const QByteArray& upstreamSignature)
+{
+  QJsonObject parameters;
+  filter->writeFilterParameters(parameters);
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(upstreamSignature);
+  hash.addData(filter->getNameOfClass().toUtf8());
+  hash.addData(filter->getEnabled() ? "1" : "0", 1);
+  hash.addData(QJsonDocument(parameters).toJson(QJsonDocument::Compact));
+  addFileStamps(parameters, hash);
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PreflightCache::Entry* PreflightCache::find(int index, const QByteArray& signature)
+{
+  if(index < m_Entries.size() && m_Entries[index].signature == signature)
+  {
+    m_Hits++;
+    return &(m_Entries[index]);
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::store(int index, const Entry& entry)
+{
+  m_Misses++;
+  if(index >= m_Entries.size())
+  {
+    m_Entries.resize(index + 1);
+  }
+  m_Entries[index] = entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::truncate(int size)
+{
+  if(size < m_Entries.size())
+  {
+    m_Entries.resize(size);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PreflightCache::clear()
+{
+  m_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PreflightCache::size() const
+{
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PreflightCache::getHitCount() const
+{
+  return m_Hits;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PreflightCache::getMissCount() const
+{
+  return m_Misses;
+}
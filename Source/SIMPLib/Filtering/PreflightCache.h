@@ -0,0 +1,143 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+/**
+ * @brief The PreflightCache class remembers the outcome of preflighting each position of a pipeline
+ * so that FilterPipeline::preflightPipeline() only has to preflight from the first filter that
+ * changed. Each entry is keyed by a signature that chains the signature of the previous position
+ * with the filter's class, enabled state and parameters, plus the modification time of any file
+ * or directory the parameters point to. A change anywhere upstream therefore invalidates every entry after it.
+ *
+ * The cache lives with whoever owns the pipeline (the GUI keeps one per pipeline view) since a
+ * FilterPipeline is usually rebuilt for each preflight.
+ */
+class SIMPLib_EXPORT PreflightCache
+{
+public:
+  SIMPL_SHARED_POINTERS(PreflightCache)
+  SIMPL_STATIC_NEW_MACRO(PreflightCache)
+  SIMPL_TYPE_MACRO(PreflightCache)
+
+  virtual ~PreflightCache();
+
+  /**
+   * @brief The Entry struct holds what a filter left behind after it was preflighted
+   */
+  struct Entry
+  {
+    QByteArray signature;
+    DataContainerArray::Pointer dataContainerArray; // Structure after the filter, shared with the filter
+    int errorCondition = 0;
+    int warningCondition = 0;
+    QVector<PipelineMessage> messages;
+  };
+
+  /**
+   * @brief ComputeSignature Hashes a filter together with the signature of everything upstream of it
+   * @param filter
+   * @param upstreamSignature Signature of the previous position, empty for the first filter
+   * @return
+   */
+  static QByteArray ComputeSignature(const AbstractFilter::Pointer& filter, const QByteArray& upstreamSignature);
+
+  /**
+   * @brief find Returns the entry at a pipeline position if it was stored with the same signature
+   * @param index
+   * @param signature
+   * @return nullptr on a miss
+   */
+  const Entry* find(int index, const QByteArray& signature);
+
+  /**
+   * @brief store Replaces the entry at a pipeline position
+   * @param index
+   * @param entry
+   */
+  void store(int index, const Entry& entry);
+
+  /**
+   * @brief truncate Drops the entries of positions past the end of a pipeline with the given size
+   * @param size
+   */
+  void truncate(int size);
+
+  /**
+   * @brief clear Forces the next preflight to run every filter
+   */
+  void clear();
+
+  /**
+   * @brief size
+   * @return
+   */
+  int size() const;
+
+  /**
+   * @brief getHitCount Returns how many filters were skipped since the cache was created
+   * @return
+   */
+  size_t getHitCount() const;
+
+  /**
+   * @brief getMissCount Returns how many filters had to be preflighted since the cache was created
+   * @return
+   */
+  size_t getMissCount() const;
+
+protected:
+  PreflightCache();
+
+private:
+  QVector<Entry> m_Entries;
+  size_t m_Hits = 0;
+  size_t m_Misses = 0;
+
+public:
+  PreflightCache(const PreflightCache&) = delete; // Copy Constructor Not Implemented
+  PreflightCache(PreflightCache&&) = delete;      // Move Constructor Not Implemented
+  PreflightCache& operator=(const PreflightCache&) = delete; // Copy Assignment Not Implemented
+  PreflightCache& operator=(PreflightCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -33,17 +33,32 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
 #include <QtCore/QPluginLoader>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
 
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/CoreFilters/Breakpoint.h"
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/RenameDataContainer.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataStorage.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineProfile.h"
+#include "SIMPLib/Filtering/PreflightCache.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -154,6 +169,332 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer createAttributeMatrix(const QString& dcName)
+  {
+    CreateAttributeMatrix::Pointer filter = CreateAttributeMatrix::New();
+    filter->setCreatedAttributeMatrix(DataArrayPath(dcName, "CellData", ""));
+    std::vector<std::vector<double>> tableDims = {{10}};
+    filter->setTupleDimensions(DynamicTableData(tableDims));
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFilterDependencies()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer ebsdDc = CreateDataContainer::New();
+    ebsdDc->setDataContainerName("EBSD");
+    pipeline->pushBack(ebsdDc);
+
+    CreateDataContainer::Pointer bseDc = CreateDataContainer::New();
+    bseDc->setDataContainerName("BSE");
+    pipeline->pushBack(bseDc);
+
+    pipeline->pushBack(createAttributeMatrix("EBSD"));
+    pipeline->pushBack(createAttributeMatrix("BSE"));
+
+    // Breakpoint does not reference any DataContainer so it must act as a barrier
+    pipeline->pushBack(Breakpoint::New());
+
+    CreateDataContainer::Pointer otherDc = CreateDataContainer::New();
+    otherDc->setDataContainerName("Other");
+    pipeline->pushBack(otherDc);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    QVector<QVector<int>> deps = pipeline->computeFilterDependencies();
+    DREAM3D_REQUIRE_EQUAL(deps.size(), 6)
+    DREAM3D_REQUIRE_EQUAL(deps[0].size(), 0)
+    DREAM3D_REQUIRE_EQUAL(deps[1].size(), 0)
+    DREAM3D_REQUIRE(deps[2] == QVector<int>({0}))
+    DREAM3D_REQUIRE(deps[3] == QVector<int>({1}))
+    DREAM3D_REQUIRE(deps[4] == QVector<int>({0, 1, 2, 3}))
+    DREAM3D_REQUIRE(deps[5] == QVector<int>({4}))
+
+    // Disabled filters take no part in the graph
+    bseDc->setEnabled(false);
+    pipeline->preflightPipeline();
+    deps = pipeline->computeFilterDependencies();
+    DREAM3D_REQUIRE_EQUAL(deps[1].size(), 0)
+    DREAM3D_REQUIRE(deps[4] == QVector<int>({0, 2, 3}))
+
+    // Executing in parallel must produce the same structure as the serial pipeline
+    bseDc->setEnabled(true);
+    pipeline->setExecuteInParallel(true);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRED(pipeline->getErrorCondition(), >=, 0)
+    DREAM3D_REQUIRE(dca->doesAttributeMatrixExist(DataArrayPath("EBSD", "CellData", "")))
+    DREAM3D_REQUIRE(dca->doesAttributeMatrixExist(DataArrayPath("BSE", "CellData", "")))
+    DREAM3D_REQUIRE(dca->doesDataContainerExist("Other"))
+    DREAM3D_REQUIRE_EQUAL(dca->getNumDataContainers(), 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRenamedDataContainerDependencies()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer ebsdDc = CreateDataContainer::New();
+    ebsdDc->setDataContainerName("EBSD");
+    pipeline->pushBack(ebsdDc);
+
+    CreateDataContainer::Pointer bseDc = CreateDataContainer::New();
+    bseDc->setDataContainerName("BSE");
+    pipeline->pushBack(bseDc);
+
+    // The rename removes "BSE" and creates "SEM", which is only known from the preflighted structure
+    RenameDataContainer::Pointer rename = RenameDataContainer::New();
+    rename->setSelectedDataContainerName("BSE");
+    rename->setNewDataContainerName("SEM");
+    pipeline->pushBack(rename);
+
+    pipeline->pushBack(createAttributeMatrix("SEM"));
+    AbstractFilter::Pointer ebsdAm = createAttributeMatrix("EBSD");
+    pipeline->pushBack(ebsdAm);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    QVector<QVector<int>> deps = pipeline->computeFilterDependencies();
+    DREAM3D_REQUIRE_EQUAL(deps.size(), 5)
+    DREAM3D_REQUIRE(deps[2] == QVector<int>({1}))
+    DREAM3D_REQUIRE(deps[3] == QVector<int>({2}))
+    DREAM3D_REQUIRE(deps[4] == QVector<int>({0}))
+
+    // Only filters that actually execute report that they completed
+    ebsdAm->setEnabled(false);
+    // The signals come from the worker threads
+    std::atomic<int> completedCount(0);
+    std::atomic<bool> disabledCompleted(false);
+    AbstractFilter* disabledFilter = ebsdAm.get();
+    for(int i = 0; i < pipeline->size(); i++)
+    {
+      AbstractFilter::Pointer filter = pipeline->getFilterContainer().at(i);
+      QObject::connect(filter.get(), &AbstractFilter::filterCompleted, [&completedCount, &disabledCompleted, disabledFilter](AbstractFilter* f) {
+        completedCount++;
+        if(f == disabledFilter)
+        {
+          disabledCompleted = true;
+        }
+      });
+    }
+    pipeline->setExecuteInParallel(true);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRED(pipeline->getErrorCondition(), >=, 0)
+    DREAM3D_REQUIRE(dca->doesAttributeMatrixExist(DataArrayPath("SEM", "CellData", "")))
+    DREAM3D_REQUIRE_EQUAL(dca->doesDataContainerExist("BSE"), false)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    DREAM3D_REQUIRE_EQUAL(completedCount.load(), 4)
+    DREAM3D_REQUIRE_EQUAL(disabledCompleted.load(), false)
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPreflightCache()
+  {
+    CreateDataContainer::Pointer ebsdDc = CreateDataContainer::New();
+    ebsdDc->setDataContainerName("EBSD");
+    AbstractFilter::Pointer ebsdAm = createAttributeMatrix("EBSD");
+    CreateDataContainer::Pointer otherDc = CreateDataContainer::New();
+    otherDc->setDataContainerName("Other");
+
+    PreflightCache::Pointer cache = PreflightCache::New();
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(ebsdDc);
+    pipeline->pushBack(ebsdAm);
+    pipeline->pushBack(otherDc);
+    pipeline->setPreflightCache(cache);
+
+    int err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 3)
+
+    // A rebuilt pipeline holding the same filters preflights nothing
+    pipeline = FilterPipeline::New();
+    pipeline->pushBack(ebsdDc);
+    pipeline->pushBack(ebsdAm);
+    pipeline->pushBack(otherDc);
+    pipeline->setPreflightCache(cache);
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 3)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 3)
+    DREAM3D_REQUIRE(otherDc->getDataContainerArray()->doesAttributeMatrixExist(DataArrayPath("EBSD", "CellData", "")))
+
+    // Editing the last filter only preflights that filter
+    otherDc->setDataContainerName("BSE");
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 5)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 4)
+    DREAM3D_REQUIRE(otherDc->getDataContainerArray()->doesDataContainerExist("BSE"))
+    DREAM3D_REQUIRE(otherDc->getDataContainerArray()->doesAttributeMatrixExist(DataArrayPath("EBSD", "CellData", "")))
+    DREAM3D_REQUIRE_EQUAL(otherDc->getDataContainerArray()->doesDataContainerExist("Other"), false)
+
+    // An edit made in a widget only reaches the filter through updateFilterParameters(), which must
+    // be pulled before the cache is consulted
+    QString widgetValue = "SEM";
+    QMetaObject::Connection widget = QObject::connect(otherDc.get(), &CreateDataContainer::updateFilterParameters, [&widgetValue](AbstractFilter* filter) {
+      dynamic_cast<CreateDataContainer*>(filter)->setDataContainerName(widgetValue);
+    });
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 7)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 5)
+    DREAM3D_REQUIRE(otherDc->getDataContainerArray()->doesDataContainerExist("SEM"))
+    DREAM3D_REQUIRE_EQUAL(otherDc->getDataContainerArray()->doesDataContainerExist("BSE"), false)
+    QObject::disconnect(widget);
+
+    // Disabling a filter preflights it and everything downstream of it again
+    ebsdAm->setEnabled(false);
+    err = pipeline->preflightPipeline();
+    DREAM3D_REQUIRED(err, >=, 0)
+    DREAM3D_REQUIRE_EQUAL(cache->getHitCount(), 8)
+    DREAM3D_REQUIRE_EQUAL(cache->getMissCount(), 7)
+    DREAM3D_REQUIRE_EQUAL(otherDc->getDataContainerArray()->doesAttributeMatrixExist(DataArrayPath("EBSD", "CellData", "")), false)
+
+    // Removing a filter drops the entries past the end of the pipeline
+    pipeline->popBack();
+    pipeline->preflightPipeline();
+    DREAM3D_REQUIRE_EQUAL(cache->size(), 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeferredPluginLoading()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    QUuid deferredUuid = QUuid::createUuid();
+    QStringList loadedPlugins;
+    fm->setDeferredPluginLoader([fm, &loadedPlugins](const QString& pluginPath) {
+      loadedPlugins << pluginPath;
+      fm->addFilterFactory("DeferredTestFilter", FilterFactory<CreateDataContainer>::New());
+    });
+    fm->addDeferredFilter("DeferredTestFilter", deferredUuid, "DeferredTest.plugin");
+    DREAM3D_REQUIRE(fm->hasDeferredFilters())
+
+    // Unknown filters do not load any plugin
+    DREAM3D_REQUIRE(nullptr == fm->getFactoryFromClassName("NotAFilter").get())
+    DREAM3D_REQUIRE_EQUAL(loadedPlugins.size(), 0)
+
+    // The first lookup loads the plugin that provides the filter, later lookups do not load it again
+    DREAM3D_REQUIRE(nullptr != fm->getFactoryFromClassName("DeferredTestFilter").get())
+    DREAM3D_REQUIRE(nullptr != fm->getFactoryFromClassName("DeferredTestFilter").get())
+    fm->getFactoryFromUuid(deferredUuid);
+    DREAM3D_REQUIRE_EQUAL(loadedPlugins.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(loadedPlugins[0], QString("DeferredTest.plugin"))
+    DREAM3D_REQUIRE(!fm->hasDeferredFilters())
+
+    // Enumerating the factories loads every remaining deferred plugin
+    fm->addDeferredFilter("OtherDeferredTestFilter", QUuid::createUuid(), "OtherDeferredTest.plugin");
+    fm->getFactories();
+    DREAM3D_REQUIRE_EQUAL(loadedPlugins.size(), 2)
+    DREAM3D_REQUIRE(!fm->hasDeferredFilters())
+
+    // Lookups from several threads wait for the one that loads the plugin instead of reading the factories while they change
+    fm->setDeferredPluginLoader([fm, &loadedPlugins](const QString& pluginPath) {
+      loadedPlugins << pluginPath;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      fm->addFilterFactory("ConcurrentDeferredTestFilter", FilterFactory<CreateDataContainer>::New());
+    });
+    fm->addDeferredFilter("ConcurrentDeferredTestFilter", QUuid::createUuid(), "ConcurrentDeferredTest.plugin");
+    std::atomic<int> foundCount(0);
+    std::vector<std::thread> lookups;
+    for(int i = 0; i < 4; i++)
+    {
+      lookups.emplace_back([fm, &foundCount] {
+        if(nullptr != fm->getFactoryFromClassName("ConcurrentDeferredTestFilter").get())
+        {
+          foundCount++;
+        }
+      });
+    }
+    for(std::thread& lookup : lookups)
+    {
+      lookup.join();
+    }
+    DREAM3D_REQUIRE_EQUAL(foundCount.load(), 4)
+    DREAM3D_REQUIRE_EQUAL(loadedPlugins.size(), 3)
+
+    fm->setDeferredPluginLoader(FilterManager::DeferredPluginLoader());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPipelineProfile()
+  {
+    // Every buffer a DataArray allocates is counted
+    uint64_t allocatedBefore = IDataStorage::GetTotalAllocatedBytes();
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(1000, "Array");
+    DREAM3D_REQUIRED(IDataStorage::GetTotalAllocatedBytes() - allocatedBefore, >=, 1000 * sizeof(float))
+
+    // Growing a buffer only counts the growth
+    size_t capacityBefore = array->getCapacity();
+    allocatedBefore = IDataStorage::GetTotalAllocatedBytes();
+    DREAM3D_REQUIRE(array->resize(1500) > 0)
+    DREAM3D_REQUIRE_EQUAL(IDataStorage::GetTotalAllocatedBytes() - allocatedBefore, (array->getCapacity() - capacityBefore) * sizeof(float))
+
+    CreateDataContainer::Pointer ebsdDc = CreateDataContainer::New();
+    ebsdDc->setDataContainerName("EBSD");
+    CreateDataContainer::Pointer disabledDc = CreateDataContainer::New();
+    disabledDc->setDataContainerName("Disabled");
+    disabledDc->setEnabled(false);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    DREAM3D_REQUIRE(nullptr == pipeline->getProfile().get())
+    pipeline->pushBack(ebsdDc);
+    pipeline->pushBack(disabledDc);
+    pipeline->pushBack(createAttributeMatrix("EBSD"));
+    pipeline->execute();
+    DREAM3D_REQUIRED(pipeline->getErrorCondition(), >=, 0)
+
+    // Disabled filters are not profiled
+    PipelineProfile::Pointer profile = pipeline->getProfile();
+    DREAM3D_REQUIRE_VALID_POINTER(profile.get())
+    QVector<PipelineProfile::FilterRecord> records = profile->getFilterRecords();
+    DREAM3D_REQUIRE_EQUAL(records.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(records[0].pipelineIndex, 0)
+    DREAM3D_REQUIRE_EQUAL(records[1].pipelineIndex, 2)
+    DREAM3D_REQUIRE(records[1].filterClassName == "CreateAttributeMatrix")
+    DREAM3D_REQUIRED(records[1].startTime, >=, records[0].startTime + records[0].wallTime)
+    DREAM3D_REQUIRED(profile->getTotalWallTime(), >=, records[1].startTime + records[1].wallTime)
+    DREAM3D_REQUIRED(records[1].peakMemory, >, 0)
+
+    PipelineMessage message = records[1].toMessage();
+    DREAM3D_REQUIRE(message.getType() == PipelineMessage::MessageType::FilterProfile)
+    DREAM3D_REQUIRE_EQUAL(message.getPipelineIndex(), 2)
+    PipelineProfile::FilterRecord readBack = PipelineProfile::FilterRecord::FromJson(message.getProfileData());
+    DREAM3D_REQUIRE(readBack.filterHumanLabel == records[1].filterHumanLabel)
+    DREAM3D_REQUIRE_EQUAL(readBack.wallTime, records[1].wallTime)
+    DREAM3D_REQUIRE_EQUAL(readBack.allocatedBytes, records[1].allocatedBytes)
+
+    DREAM3D_REQUIRE_EQUAL(profile->toJson()["Filters"].toArray().size(), 2)
+    int completeEvents = 0;
+    for(const QJsonValue& event : profile->toChromeTrace()["traceEvents"].toArray())
+    {
+      if(event.toObject()["ph"].toString() == "X")
+      {
+        completeEvents++;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(completeEvents, 2)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -168,6 +509,11 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestFilterDependencies());
+    DREAM3D_REGISTER_TEST(TestRenamedDataContainerDependencies());
+    DREAM3D_REGISTER_TEST(TestPreflightCache());
+    DREAM3D_REGISTER_TEST(TestDeferredPluginLoading());
+    DREAM3D_REGISTER_TEST(TestPipelineProfile());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -0,0 +1,146 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdMask.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ThresholdMaskTest
+{
+public:
+  ThresholdMaskTest() = default;
+
+  virtual ~ThresholdMaskTest() = default;
+
+  // Not a multiple of the word size so the partial last word is exercised
+  static const size_t k_NumValues = 150;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMaskOperations()
+  {
+    ThresholdMask::Pointer mask = ThresholdMask::New(k_NumValues);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 3)
+    DREAM3D_REQUIRE_EQUAL(mask->getValidBits(2), (ThresholdMask::WordType(1) << 22) - 1)
+
+    ThresholdMask::Pointer other = ThresholdMask::New(k_NumValues);
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      mask->setValue(i, i % 2 == 0);
+      other->setValue(i, i % 3 == 0);
+    }
+
+    mask->combine(*other, ThresholdMask::Combine::And);
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), i % 6 == 0)
+    }
+
+    mask->combine(*other, ThresholdMask::Combine::Or, true);
+    mask->invert();
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), i % 3 == 0 && i % 6 != 0)
+    }
+    // Inverting must not leak into the unused bits of the last word
+    DREAM3D_REQUIRE_EQUAL(mask->getWordPointer()[2] & ~mask->getValidBits(2), 0)
+
+    BoolArrayType::Pointer unpacked = BoolArrayType::CreateArray(k_NumValues, "Unpacked");
+    mask->copyTo(unpacked->getPointer(0));
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(unpacked->getValue(i), mask->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestThresholdIntoMask()
+  {
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(k_NumValues, "Values");
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      values->setValue(i, static_cast<float>(i));
+    }
+
+    ThresholdMask::Pointer mask = ThresholdMask::New(k_NumValues);
+    {
+      ThresholdFilterHelper filter(SIMPL::Comparison::Operator_GreaterThan, 20.0, mask.get());
+      DREAM3D_REQUIRE(filter.execute(values.get(), nullptr) >= 0)
+    }
+    {
+      ThresholdFilterHelper filter(SIMPL::Comparison::Operator_LessThan, 100.0, mask.get(), ThresholdMask::Combine::And);
+      DREAM3D_REQUIRE(filter.execute(values.get(), nullptr) >= 0)
+    }
+    {
+      ThresholdFilterHelper filter(SIMPL::Comparison::Operator_NotEqual, 5.0, mask.get(), ThresholdMask::Combine::Or, true);
+      DREAM3D_REQUIRE(filter.execute(values.get(), nullptr) >= 0)
+    }
+
+    // The bool array path must agree with the mask path
+    BoolArrayType::Pointer expected = BoolArrayType::CreateArray(k_NumValues, "Expected");
+    ThresholdFilterHelper filter(SIMPL::Comparison::Operator_GreaterThan, 20.0, expected.get());
+    DREAM3D_REQUIRE(filter.execute(values.get(), expected.get()) >= 0)
+    for(size_t i = 0; i < k_NumValues; i++)
+    {
+      bool result = (expected->getValue(i) && i < 100) || i == 5;
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), result)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ThresholdMaskTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestMaskOperations());
+    DREAM3D_REGISTER_TEST(TestThresholdIntoMask());
+  }
+
+private:
+  ThresholdMaskTest(const ThresholdMaskTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ThresholdMaskTest&) = delete;    // Move assignment Not Implemented
+};
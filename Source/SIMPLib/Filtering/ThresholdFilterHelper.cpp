@@ -45,6 +45,18 @@ ThresholdFilterHelper::ThresholdFilterHelper(SIMPL::Comparison::Enumeration comp
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdFilterHelper::ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, ThresholdMask* output, ThresholdMask::Combine combine, bool inverse)
+: comparisonOperator(compType)
+, comparisonValue(compValue)
+, m_Mask(output)
+, m_Combine(combine)
+, m_Inverse(inverse)
+{
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -56,7 +68,9 @@ ThresholdFilterHelper::~ThresholdFilterHelper() = default;
 #define FILTER_DATA_HELPER(dType, ops, Type)                                                                                                                                                           \
   if(dType.compare(#Type) == 0)                                                                                                                                                                        \
   {                                                                                                                                                                                                    \
-    if(ops == SIMPL::Comparison::Operator_LessThan)                                                                                                                                                    \
+    if(nullptr != m_Mask)                                                                                                                                                                              \
+      filterDataMask<Type>(input);                                                                                                                                                                     \
+    else if(ops == SIMPL::Comparison::Operator_LessThan)                                                                                                                                               \
       filterDataLessThan<Type>(input);                                                                                                                                                                 \
     else if(ops == SIMPL::Comparison::Operator_GreaterThan)                                                                                                                                            \
       filterDataGreaterThan<Type>(input);                                                                                                                                                              \
@@ -76,7 +90,14 @@ int ThresholdFilterHelper::execute(IDataArray* input, IDataArray* output)
   {
     return -1;
   }
-  m_Output->initializeWithZeros();
+  if(nullptr != m_Output)
+  {
+    m_Output->initializeWithZeros();
+  }
+  else if(nullptr == m_Mask)
+  {
+    return -1;
+  }
   QString dType = input->getTypeAsString();
 
   FILTER_DATA_HELPER(dType, comparisonOperator, float);
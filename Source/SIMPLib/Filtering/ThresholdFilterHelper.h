@@ -35,12 +35,89 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/IDataArrayFilter.h"
+#include "SIMPLib/Filtering/ThresholdMask.h"
 #include "SIMPLib/SIMPLib.h"
 
+/**
+ * @brief The ThresholdMaskCompareImpl class compares a range of values against a constant and packs
+ * the results 64 at a time into the words of a ThresholdMask. Full words use a fixed trip count and
+ * branch free packing so the compiler can vectorize the compares. Each word is written by exactly one
+ * range, so ranges may be evaluated in parallel.
+ */
+template <typename T, typename Compare> class ThresholdMaskCompareImpl
+{
+public:
+  ThresholdMaskCompareImpl(const T* data, size_t numValues, T value, ThresholdMask* mask, ThresholdMask::Combine op, bool inverse)
+  : m_Data(data)
+  , m_NumValues(numValues)
+  , m_Value(value)
+  , m_Mask(mask)
+  , m_Op(op)
+  , m_Inverse(inverse)
+  {
+  }
+  virtual ~ThresholdMaskCompareImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    using WordType = ThresholdMask::WordType;
+    Compare compare;
+    WordType* words = m_Mask->getWordPointer();
+    WordType flip = m_Inverse ? ~WordType(0) : 0;
+    for(size_t w = start; w < end; w++)
+    {
+      size_t offset = w * ThresholdMask::k_BitsPerWord;
+      const T* data = m_Data + offset;
+      WordType word = 0;
+      if(offset + ThresholdMask::k_BitsPerWord <= m_NumValues)
+      {
+        for(size_t b = 0; b < ThresholdMask::k_BitsPerWord; b++)
+        {
+          word |= static_cast<WordType>(compare(data[b], m_Value)) << b;
+        }
+      }
+      else if(offset < m_NumValues)
+      {
+        size_t count = m_NumValues - offset;
+        for(size_t b = 0; b < count; b++)
+        {
+          word |= static_cast<WordType>(compare(data[b], m_Value)) << b;
+        }
+      }
+      ThresholdMask::CombineWord(words[w], (word ^ flip) & m_Mask->getValidBits(w), m_Op);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Data;
+  size_t m_NumValues;
+  T m_Value;
+  ThresholdMask* m_Mask;
+  ThresholdMask::Combine m_Op;
+  bool m_Inverse;
+};
+
 /**
  * @brief The ThresholdFilterHelper class
  */
@@ -49,6 +126,16 @@ class SIMPLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
 public:
   ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, BoolArrayType* output);
 
+  /**
+   * @brief Creates a helper that writes its results straight into a bit packed mask
+   * @param compType Comparison operator
+   * @param compValue Value to compare against
+   * @param output Mask that receives the results
+   * @param combine How each result is merged into the current contents of output
+   * @param inverse Should the results be flipped before they are merged
+   */
+  ThresholdFilterHelper(SIMPL::Comparison::Enumeration compType, double compValue, ThresholdMask* output, ThresholdMask::Combine combine = ThresholdMask::Combine::Replace, bool inverse = false);
+
   ~ThresholdFilterHelper() override;
 
   /**
@@ -59,10 +146,10 @@ public:
     size_t m_NumValues = m_Input->getNumberOfTuples();
     T v = static_cast<T>(comparisonValue);
     T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    bool* out = m_Output->getPointer(0);
     for(size_t i = 0; i < m_NumValues; ++i)
     {
-      bool b = (data[i] < v);
-      m_Output->setValue(i, b);
+      out[i] = (data[i] < v);
     }
   }
 
@@ -74,10 +161,10 @@ public:
     size_t m_NumValues = m_Input->getNumberOfTuples();
     T v = static_cast<T>(comparisonValue);
     T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    bool* out = m_Output->getPointer(0);
     for(size_t i = 0; i < m_NumValues; ++i)
     {
-      bool b = (data[i] > v);
-      m_Output->setValue(i, b);
+      out[i] = (data[i] > v);
     }
   }
 
@@ -89,10 +176,10 @@ public:
     size_t m_NumValues = m_Input->getNumberOfTuples();
     T v = static_cast<T>(comparisonValue);
     T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    bool* out = m_Output->getPointer(0);
     for(size_t i = 0; i < m_NumValues; ++i)
     {
-      bool b = (data[i] == v);
-      m_Output->setValue(i, b);
+      out[i] = (data[i] == v);
     }
   }
 
@@ -104,10 +191,35 @@ public:
     size_t m_NumValues = m_Input->getNumberOfTuples();
     T v = static_cast<T>(comparisonValue);
     T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    bool* out = m_Output->getPointer(0);
     for(size_t i = 0; i < m_NumValues; ++i)
     {
-      bool b = (data[i] != v);
-      m_Output->setValue(i, b);
+      out[i] = (data[i] != v);
+    }
+  }
+
+  /**
+   * @brief Compares the input against the comparison value and merges the packed results into the mask
+   */
+  template <typename T> void filterDataMask(IDataArray* m_Input)
+  {
+    switch(comparisonOperator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      filterDataMask<T, std::less<T>>(m_Input);
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      filterDataMask<T, std::greater<T>>(m_Input);
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      filterDataMask<T, std::equal_to<T>>(m_Input);
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      filterDataMask<T, std::not_equal_to<T>>(m_Input);
+      break;
+    default:
+      filterDataMask<T, NoComparison<T>>(m_Input);
+      break;
     }
   }
 
@@ -119,10 +231,50 @@ public:
   */
   int execute(IDataArray* input, IDataArray* output);
 
+protected:
+  /**
+   * @brief Comparison used for an unknown operator; every value fails it
+   */
+  template <typename T> struct NoComparison
+  {
+    bool operator()(const T&, const T&) const
+    {
+      return false;
+    }
+  };
+
+  template <typename T, typename Compare> void filterDataMask(IDataArray* m_Input)
+  {
+    size_t numValues = std::min(m_Input->getNumberOfTuples(), m_Mask->getNumberOfValues());
+    T v = static_cast<T>(comparisonValue);
+    T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+    size_t numWords = m_Mask->getNumberOfWords();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numWords), ThresholdMaskCompareImpl<T, Compare>(data, numValues, v, m_Mask, m_Combine, m_Inverse), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      ThresholdMaskCompareImpl<T, Compare> serial(data, numValues, v, m_Mask, m_Combine, m_Inverse);
+      serial.compute(0, numWords);
+    }
+  }
+
 private:
   SIMPL::Comparison::Enumeration comparisonOperator;
   double comparisonValue;
-  BoolArrayType* m_Output;
+  BoolArrayType* m_Output = nullptr;
+  ThresholdMask* m_Mask = nullptr;
+  ThresholdMask::Combine m_Combine = ThresholdMask::Combine::Replace;
+  bool m_Inverse = false;
 
 public:
   ThresholdFilterHelper(const ThresholdFilterHelper&) = delete; // Copy Constructor Not Implemented
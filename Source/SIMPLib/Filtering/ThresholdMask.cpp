@@ -0,0 +1,308 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ThresholdMask.h"
+
+#include <algorithm>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+/**
+ * @brief The CombineThresholdMaskImpl class merges a range of words from one mask into another
+ */
+class CombineThresholdMaskImpl
+{
+public:
+  CombineThresholdMaskImpl(const ThresholdMask* source, ThresholdMask* dest, ThresholdMask::Combine op, bool invert)
+  : m_Source(source)
+  , m_Dest(dest)
+  , m_Op(op)
+  , m_Invert(invert)
+  {
+  }
+  virtual ~CombineThresholdMaskImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const ThresholdMask::WordType* source = m_Source->getWordPointer();
+    ThresholdMask::WordType* dest = m_Dest->getWordPointer();
+    ThresholdMask::WordType flip = m_Invert ? ~ThresholdMask::WordType(0) : 0;
+    for(size_t w = start; w < end; w++)
+    {
+      ThresholdMask::CombineWord(dest[w], (source[w] ^ flip) & m_Dest->getValidBits(w), m_Op);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ThresholdMask* m_Source;
+  ThresholdMask* m_Dest;
+  ThresholdMask::Combine m_Op;
+  bool m_Invert;
+};
+
+/**
+ * @brief The InvertThresholdMaskImpl class flips a range of words of a mask
+ */
+class InvertThresholdMaskImpl
+{
+public:
+  InvertThresholdMaskImpl(ThresholdMask* mask)
+  : m_Mask(mask)
+  {
+  }
+  virtual ~InvertThresholdMaskImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    ThresholdMask::WordType* words = m_Mask->getWordPointer();
+    for(size_t w = start; w < end; w++)
+    {
+      words[w] = ~words[w] & m_Mask->getValidBits(w);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  ThresholdMask* m_Mask;
+};
+
+/**
+ * @brief The UnpackThresholdMaskImpl class expands a range of words into a bool array
+ */
+class UnpackThresholdMaskImpl
+{
+public:
+  UnpackThresholdMaskImpl(const ThresholdMask* mask, bool* destination)
+  : m_Mask(mask)
+  , m_Destination(destination)
+  {
+  }
+  virtual ~UnpackThresholdMaskImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const ThresholdMask::WordType* words = m_Mask->getWordPointer();
+    size_t numValues = m_Mask->getNumberOfValues();
+    for(size_t w = start; w < end; w++)
+    {
+      size_t offset = w * ThresholdMask::k_BitsPerWord;
+      size_t count = std::min(ThresholdMask::k_BitsPerWord, numValues - offset);
+      ThresholdMask::WordType word = words[w];
+      bool* dest = m_Destination + offset;
+      for(size_t b = 0; b < count; b++)
+      {
+        dest[b] = ((word >> b) & 1) != 0;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ThresholdMask* m_Mask;
+  bool* m_Destination;
+};
+
+const size_t ThresholdMask::k_BitsPerWord;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdMask::ThresholdMask(size_t numValues)
+: m_NumValues(numValues)
+, m_Words((numValues + k_BitsPerWord - 1) / k_BitsPerWord, 0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdMask::~ThresholdMask() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdMask::getNumberOfValues() const
+{
+  return m_NumValues;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdMask::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdMask::WordType* ThresholdMask::getWordPointer()
+{
+  return m_Words.data();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const ThresholdMask::WordType* ThresholdMask::getWordPointer() const
+{
+  return m_Words.data();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdMask::WordType ThresholdMask::getValidBits(size_t wordIndex) const
+{
+  size_t offset = wordIndex * k_BitsPerWord;
+  if(offset + k_BitsPerWord <= m_NumValues)
+  {
+    return ~WordType(0);
+  }
+  if(offset >= m_NumValues)
+  {
+    return 0;
+  }
+  return (WordType(1) << (m_NumValues - offset)) - 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdMask::initializeWithZeros()
+{
+  std::fill(m_Words.begin(), m_Words.end(), 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdMask::invert()
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_Words.size()), InvertThresholdMaskImpl(this), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    InvertThresholdMaskImpl serial(this);
+    serial.compute(0, m_Words.size());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdMask::combine(const ThresholdMask& other, Combine op, bool invertOther)
+{
+  size_t numWords = std::min(m_Words.size(), other.getNumberOfWords());
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numWords), CombineThresholdMaskImpl(&other, this, op, invertOther), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CombineThresholdMaskImpl serial(&other, this, op, invertOther);
+    serial.compute(0, numWords);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdMask::copyTo(bool* destination) const
+{
+  if(nullptr == destination)
+  {
+    return;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_Words.size()), UnpackThresholdMaskImpl(this, destination), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    UnpackThresholdMaskImpl serial(this, destination);
+    serial.compute(0, m_Words.size());
+  }
+}
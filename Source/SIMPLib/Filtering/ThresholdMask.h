@@ -0,0 +1,193 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ThresholdMask class is a bit packed boolean mask that stores 64 threshold results
+ * per machine word. Comparisons write into it a whole word at a time and masks are merged with
+ * word level AND / OR / NOT operations instead of one bool at a time. Bits past the last value
+ * are always kept cleared.
+ */
+class SIMPLib_EXPORT ThresholdMask
+{
+public:
+  SIMPL_SHARED_POINTERS(ThresholdMask)
+
+  using WordType = uint64_t;
+
+  static const size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief The Combine enum selects how a new word is merged into the existing contents of the mask
+   */
+  enum class Combine : int
+  {
+    Replace = 0,
+    And,
+    Or
+  };
+
+  /**
+   * @brief Creates a mask holding numValues bits, all initialized to false
+   * @param numValues
+   * @return
+   */
+  static Pointer New(size_t numValues)
+  {
+    return Pointer(new ThresholdMask(numValues));
+  }
+
+  virtual ~ThresholdMask();
+
+  /**
+   * @brief Returns the number of boolean values stored in the mask
+   * @return
+   */
+  size_t getNumberOfValues() const;
+
+  /**
+   * @brief Returns the number of words backing the mask
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Returns a pointer to the backing words
+   * @return
+   */
+  WordType* getWordPointer();
+  const WordType* getWordPointer() const;
+
+  /**
+   * @brief Returns the bits of the given word that hold actual values
+   * @param wordIndex
+   * @return
+   */
+  WordType getValidBits(size_t wordIndex) const;
+
+  /**
+   * @brief getValue
+   * @param i
+   * @return
+   */
+  bool getValue(size_t i) const
+  {
+    return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+  }
+
+  /**
+   * @brief setValue
+   * @param i
+   * @param value
+   */
+  void setValue(size_t i, bool value)
+  {
+    WordType bit = WordType(1) << (i % k_BitsPerWord);
+    if(value)
+    {
+      m_Words[i / k_BitsPerWord] |= bit;
+    }
+    else
+    {
+      m_Words[i / k_BitsPerWord] &= ~bit;
+    }
+  }
+
+  /**
+   * @brief Sets every value in the mask to false
+   */
+  void initializeWithZeros();
+
+  /**
+   * @brief Flips every value in the mask
+   */
+  void invert();
+
+  /**
+   * @brief Merges another mask of the same size into this one
+   * @param other The mask to merge in
+   * @param op How the values are merged
+   * @param invertOther Should the values of other be flipped before they are merged
+   */
+  void combine(const ThresholdMask& other, Combine op, bool invertOther = false);
+
+  /**
+   * @brief Unpacks the mask into a plain bool array that can hold getNumberOfValues() values
+   * @param destination
+   */
+  void copyTo(bool* destination) const;
+
+  /**
+   * @brief Merges a single word into dest
+   * @param dest
+   * @param word
+   * @param op
+   */
+  static inline void CombineWord(WordType& dest, WordType word, Combine op)
+  {
+    switch(op)
+    {
+    case Combine::Replace:
+      dest = word;
+      break;
+    case Combine::And:
+      dest &= word;
+      break;
+    case Combine::Or:
+      dest |= word;
+      break;
+    }
+  }
+
+protected:
+  ThresholdMask(size_t numValues);
+
+private:
+  size_t m_NumValues = 0;
+  std::vector<WordType> m_Words;
+
+public:
+  ThresholdMask(const ThresholdMask&) = delete;            // Copy Constructor Not Implemented
+  ThresholdMask(ThresholdMask&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdMask& operator=(const ThresholdMask&) = delete; // Copy Assignment Not Implemented
+  ThresholdMask& operator=(ThresholdMask&&) = delete;      // Move Assignment Not Implemented
+};
@@ -31,9 +31,19 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
-#include <map>
-#include <set>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include <QtCore/QString>
 
@@ -196,15 +206,12 @@ public:
     }
     int32_t rank = 0;
     hsize_t dims[2] = {0, 2ULL};
-    size_t total = 0;
-    for(size_t v = 0; v < numElems; ++v)
-    {
-      total += dynamicList->getNumberOfElements(v);
-    }
+    size_t total = dynamicList->getTotalNumberOfElements();
 
     size_t totalBytes = numElems * sizeof(T) + total * sizeof(K);
 
-    // Allocate a flat array to copy the data into
+    // Allocate a flat array to copy the data into. The on-disk layout interleaves the count of each list
+    // with its cells, so this is a single pass over the packed lists followed by a single write.
     QVector<uint8_t> buffer(totalBytes, 0);
     uint8_t* bufPtr = &(buffer.front());
     size_t offset = 0;
@@ -227,6 +234,226 @@ public:
   }
 };
 
+/**
+ * @brief The FindElementsContainingVertImpl class fills the element lists of each vertex once the lists
+ * have been sized. Each vertex owns a cursor into its list so any number of threads can place elements at
+ * the same time; the lists are sorted afterwards by SortElementListsImpl so the result does not depend on
+ * the order the threads ran in.
+ */
+template <typename T, typename K> class FindElementsContainingVertImpl
+{
+public:
+  FindElementsContainingVertImpl(DataArray<K>* elemList, DynamicListArray<T, K>* dynamicList, std::atomic<size_t>* cursors)
+  : m_ElemList(elemList)
+  , m_DynamicList(dynamicList)
+  , m_Cursors(cursors)
+  {
+  }
+  virtual ~FindElementsContainingVertImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numVertsPerElem = m_ElemList->getNumberOfComponents();
+    for(size_t elemId = start; elemId < end; elemId++)
+    {
+      const K* verts = m_ElemList->getConstPointer(elemId * numVertsPerElem);
+      for(size_t j = 0; j < numVertsPerElem; j++)
+      {
+        size_t pos = m_Cursors[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        m_DynamicList->insertCellReference(verts[j], pos, elemId);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DataArray<K>* m_ElemList;
+  DynamicListArray<T, K>* m_DynamicList;
+  std::atomic<size_t>* m_Cursors;
+};
+
+/**
+ * @brief The SortElementListsImpl class sorts each list of a DynamicListArray in place
+ */
+template <typename T, typename K> class SortElementListsImpl
+{
+public:
+  SortElementListsImpl(DynamicListArray<T, K>* dynamicList)
+  : m_DynamicList(dynamicList)
+  {
+  }
+  virtual ~SortElementListsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      K* cells = m_DynamicList->getElementListPointer(i);
+      std::sort(cells, cells + m_DynamicList->getNumberOfElements(i));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The FindElementNeighborsImpl class finds the neighbors of a range of elements. It runs in two passes:
+ * the first pass only counts the neighbors of each element so the lists can be allocated in one block, the
+ * second pass finds them again and writes them straight into their lists. Two elements are neighbors when
+ * they share numSharedVerts vertices, which is the number of times the candidate shows up in the element
+ * lists of the seed element's vertices. All the scratch space is local to each range so no state is shared
+ * between threads.
+ */
+template <typename T, typename K> class FindElementNeighborsImpl
+{
+public:
+  FindElementNeighborsImpl(DataArray<K>* elemList, DynamicListArray<T, K>* elemsContainingVert, size_t numSharedVerts, T* linkCount, DynamicListArray<T, K>* dynamicList)
+  : m_ElemList(elemList)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_NumSharedVerts(numSharedVerts)
+  , m_LinkCount(linkCount)
+  , m_DynamicList(dynamicList)
+  {
+  }
+  virtual ~FindElementNeighborsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numVertsPerElem = m_ElemList->getNumberOfComponents();
+
+    // Reused for every element in this range
+    std::vector<K> candidates;
+    std::vector<K> sorted;
+    std::vector<bool> emitted;
+
+    for(size_t t = start; t < end; ++t)
+    {
+      const K* seedElem = m_ElemList->getConstPointer(t * numVertsPerElem);
+
+      // Gather every element touching a vertex of the seed, in the order they are discovered
+      candidates.clear();
+      for(size_t v = 0; v < numVertsPerElem; ++v)
+      {
+        T nEs = m_ElemsContainingVert->getNumberOfElements(seedElem[v]);
+        K* vertIdxs = m_ElemsContainingVert->getElementListPointer(seedElem[v]);
+        for(T vt = 0; vt < nEs; ++vt)
+        {
+          if(vertIdxs[vt] != static_cast<K>(t))
+          {
+            candidates.push_back(vertIdxs[vt]);
+          }
+        }
+      }
+
+      sorted.assign(candidates.begin(), candidates.end());
+      std::sort(sorted.begin(), sorted.end());
+      emitted.assign(sorted.size(), false);
+
+      // Keep the candidates that share exactly numSharedVerts vertices with the seed, in discovery order
+      K* neighbors = (nullptr == m_DynamicList) ? nullptr : m_DynamicList->getElementListPointer(t);
+      size_t count = 0;
+      for(const K& candidate : candidates)
+      {
+        auto range = std::equal_range(sorted.begin(), sorted.end(), candidate);
+        size_t first = static_cast<size_t>(range.first - sorted.begin());
+        if(static_cast<size_t>(range.second - range.first) != m_NumSharedVerts || emitted[first])
+        {
+          continue;
+        }
+        emitted[first] = true;
+        if(nullptr != neighbors)
+        {
+          neighbors[count] = candidate;
+        }
+        count++;
+      }
+
+      if(nullptr == m_DynamicList)
+      {
+        m_LinkCount[t] = static_cast<T>(count);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DataArray<K>* m_ElemList;
+  DynamicListArray<T, K>* m_ElemsContainingVert;
+  size_t m_NumSharedVerts;
+  T* m_LinkCount;
+  DynamicListArray<T, K>* m_DynamicList;
+};
+
+/**
+ * @brief The GatherElementFacetsImpl class writes the sorted vertex ids of every facet (edge or face) of a
+ * range of elements into a flat array. Each element owns a fixed block of that array so ranges can be
+ * processed in parallel without any locking.
+ */
+template <typename T, size_t N> class GatherElementFacetsImpl
+{
+public:
+  using FacetType = std::array<T, N>;
+
+  GatherElementFacetsImpl(DataArray<T>* elemList, const std::vector<std::array<size_t, N>>& facetVerts, FacetType* facets)
+  : m_ElemList(elemList)
+  , m_FacetVerts(facetVerts)
+  , m_Facets(facets)
+  {
+  }
+  virtual ~GatherElementFacetsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numFacetsPerElem = m_FacetVerts.size();
+    size_t numVertsPerElem = m_ElemList->getNumberOfComponents();
+    for(size_t i = start; i < end; i++)
+    {
+      const T* verts = m_ElemList->getConstPointer(i * numVertsPerElem);
+      for(size_t f = 0; f < numFacetsPerElem; f++)
+      {
+        FacetType& facet = m_Facets[i * numFacetsPerElem + f];
+        for(size_t k = 0; k < N; k++)
+        {
+          facet[k] = verts[m_FacetVerts[f][k]];
+        }
+        std::sort(facet.begin(), facet.end());
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  DataArray<T>* m_ElemList;
+  const std::vector<std::array<size_t, N>>& m_FacetVerts;
+  FacetType* m_Facets;
+};
+
 /**
  * @brief The Connectivity class
  */
@@ -247,37 +474,68 @@ public:
     size_t numElems = elemList->getNumberOfTuples();
     size_t numVertsPerElem = elemList->getNumberOfComponents();
 
-    // Allocate the basic structures
-    QVector<T> linkCount(numVerts, 0);
-    size_t elemId = 0;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
 
-    // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, "_INTERNAL_USE_ONLY_Vertices");
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
-    K* verts = nullptr;
+    // Counting sort of the elements by vertex: count the uses of each vertex, size all the lists
+    // in one block, then drop each element into the next free slot of each of its vertices
+    std::vector<std::atomic<size_t>> counts(numVerts);
+    for(auto& count : counts)
+    {
+      count.store(0, std::memory_order_relaxed);
+    }
 
-    // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
-    // Traverse data to determine number of uses of each point
-    for(elemId = 0; elemId < numElems; elemId++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), [&](const tbb::blocked_range<size_t>& r) {
+        for(size_t elemId = r.begin(); elemId < r.end(); elemId++)
+        {
+          const K* verts = elemList->getConstPointer(elemId * numVertsPerElem);
+          for(size_t j = 0; j < numVertsPerElem; j++)
+          {
+            counts[verts[j]].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      for(size_t elemId = 0; elemId < numElems; elemId++)
       {
-        linkCount[verts[j]]++;
+        const K* verts = elemList->getConstPointer(elemId * numVertsPerElem);
+        for(size_t j = 0; j < numVertsPerElem; j++)
+        {
+          counts[verts[j]].fetch_add(1, std::memory_order_relaxed);
+        }
       }
     }
 
-    // Now allocate storage for the links
+    // Now allocate storage for the links and reuse the counts as the fill cursors
+    std::vector<T> linkCount(numVerts, 0);
+    for(size_t v = 0; v < numVerts; v++)
+    {
+      linkCount[v] = static_cast<T>(counts[v].load(std::memory_order_relaxed));
+      counts[v].store(0, std::memory_order_relaxed);
+    }
     dynamicList->allocateLists(linkCount);
 
-    for(elemId = 0; elemId < numElems; elemId++)
+    FindElementsContainingVertImpl<T, K> fillImpl(elemList.get(), dynamicList.get(), counts.data());
+    SortElementListsImpl<T, K> sortImpl(dynamicList.get());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
     {
-      verts = elemList->getTuplePointer(elemId);
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        dynamicList->insertCellReference(verts[j], (linkLoc[verts[j]])++, elemId);
-      }
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), fillImpl, tbb::auto_partitioner());
+      // Threads fill the lists in any order; sort them so each list is in element order like the serial fill
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numVerts), sortImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      fillImpl.compute(0, numElems);
     }
   }
 
@@ -294,7 +552,6 @@ public:
                                   IGeometry::Type geometryType)
   {
     size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
     size_t numSharedVerts = 0;
     QVector<T> linkCount(numElems, 0);
     int err = 0;
@@ -336,148 +593,103 @@ public:
       return -1;
     }
 
-    dynamicList->allocateLists(linkCount);
-
-    // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, "_INTERNAL_USE_ONLY_Visited");
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
 
-    // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
-    QVector<K> loop_neighbors(32, 0);
-
-    // Build up the element adjacency list now that we have the element links
-    for(size_t t = 0; t < numElems; ++t)
+    // First pass counts the neighbors of each element, second pass writes them into the allocated lists
+    FindElementNeighborsImpl<T, K> countImpl(elemList.get(), elemsContainingVert.get(), numSharedVerts, linkCount.data(), nullptr);
+    FindElementNeighborsImpl<T, K> fillImpl(elemList.get(), elemsContainingVert.get(), numSharedVerts, linkCount.data(), dynamicList.get());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
     {
-      //   qDebug() << "Analyzing Cell " << t << "\n";
-      K* seedElem = elemList->getTuplePointer(t);
-      for(size_t v = 0; v < numVertsPerElem; ++v)
-      {
-        //   qDebug() << " vert " << v << "\n";
-        T nEs = elemsContainingVert->getNumberOfElements(seedElem[v]);
-        K* vertIdxs = elemsContainingVert->getElementListPointer(seedElem[v]);
-
-        for(T vt = 0; vt < nEs; ++vt)
-        {
-          if(vertIdxs[vt] == static_cast<K>(t))
-          {
-            continue;
-          } // This is the same element as our "source"
-          if(visited[vertIdxs[vt]] == true)
-          {
-            continue;
-          } // We already added this element so loop again
-          //      qDebug() << "   Comparing Element " << vertIdxs[vt] << "\n";
-          K* vertCell = elemList->getTuplePointer(vertIdxs[vt]);
-          size_t vCount = 0;
-          // Loop over all the vertex indices of this element and try to match numSharedVerts of them to the current loop element
-          // If there is numSharedVerts match then that element is a neighbor of the source. If there are more than numVertsPerElem
-          // matches then there is a real problem with the mesh and the program is going to return an error.
-          for(size_t i = 0; i < numVertsPerElem; i++)
-          {
-            for(size_t j = 0; j < numVertsPerElem; j++)
-            {
-              if(seedElem[i] == vertCell[j])
-              {
-                vCount++;
-              }
-            }
-          }
-
-          // So if our vertex match count is numSharedVerts and we have not visited the element in question then add this element index
-          // into the list of vertex indices as neighbors for the source element.
-          if(vCount == numSharedVerts)
-          {
-            // qDebug() << "       Neighbor: " << vertIdxs[vt] << "\n";
-            // Use the current count of neighbors as the index
-            // into the loop_neighbors vector and place the value of the vertex element at that index
-            loop_neighbors[linkCount[t]] = vertIdxs[vt];
-            linkCount[t]++; // Increment the count for the next time through
-            if(linkCount[t] >= loop_neighbors.size())
-            {
-              loop_neighbors.resize(loop_neighbors.size() + 10);
-            }
-            visited[vertIdxs[vt]] = true; // Set this element as visited so we do NOT add it again
-          }
-        }
-      }
-      // Reset all the visited cell indexs back to false (zero)
-      for(int64_t k = 0; k < linkCount[t]; ++k)
-      {
-        visited[loop_neighbors[k]] = false;
-      }
-      // Allocate the array storage for the current edge to hold its vertex list
-      dynamicList->setElementList(t, linkCount[t], &(loop_neighbors[0]));
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), countImpl, tbb::auto_partitioner());
+      dynamicList->allocateLists(linkCount);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), fillImpl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      countImpl.compute(0, numElems);
+      dynamicList->allocateLists(linkCount);
+      fillImpl.compute(0, numElems);
     }
 
     return err;
   }
 
   /**
-   * @brief Find2DElementEdges
+   * @brief FindUniqueElementFacets Collects the facets (edges or faces) of every element, where each facet is
+   * given by the element-local vertex indices in facetVerts. The facets are sorted and reduced to the unique ones,
+   * or to the ones used by exactly one element when unsharedOnly is true. The result is written to facetList in
+   * ascending order of the sorted vertex ids.
    * @param elemList
-   * @param edgeList
+   * @param facetVerts
+   * @param unsharedOnly
+   * @param facetList
    */
-  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  template <typename T, size_t N>
+  static void FindUniqueElementFacets(typename DataArray<T>::Pointer elemList, const std::vector<std::array<size_t, N>>& facetVerts, bool unsharedOnly, typename DataArray<T>::Pointer facetList)
   {
+    using FacetType = std::array<T, N>;
     size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
 
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
 
-    for(size_t i = 0; i < numElems; i++)
+    // One slot per facet occurrence; the sort brings duplicates next to each other
+    std::vector<FacetType> facets(numElems * facetVerts.size());
+    GatherElementFacetsImpl<T, N> gatherImpl(elemList.get(), facetVerts, facets.data());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems), gatherImpl, tbb::auto_partitioner());
+      tbb::parallel_sort(facets.begin(), facets.end());
+    }
+    else
+#endif
     {
-      T* verts = elemList->getTuplePointer(i);
+      gatherImpl.compute(0, numElems);
+      std::sort(facets.begin(), facets.end());
+    }
 
-      for(size_t j = 0; j < numVertsPerElem; j++)
+    size_t numFacets = 0;
+    size_t i = 0;
+    while(i < facets.size())
+    {
+      size_t runEnd = i + 1;
+      while(runEnd < facets.size() && facets[runEnd] == facets[i])
       {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeSet.insert(edge);
+        ++runEnd;
+      }
+      if(!unsharedOnly || runEnd - i == 1)
+      {
+        facets[numFacets++] = facets[i];
       }
+      i = runEnd;
     }
 
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
+    facetList->resize(numFacets);
+    T* uFacets = facetList->getPointer(0);
+    for(size_t f = 0; f < numFacets; f++)
     {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
+      std::copy(facets[f].begin(), facets[f].end(), uFacets + N * f);
     }
   }
 
+  /**
+   * @brief Find2DElementEdges
+   * @param elemList
+   * @param edgeList
+   */
+  template <typename T> static void Find2DElementEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
+  {
+    FindUniqueElementFacets<T, 2>(elemList, Get2DElementEdgeVerts(elemList->getNumberOfComponents()), false, edgeList);
+  }
+
   /**
    * @brief FindTetEdges
    * @param tetList
@@ -485,42 +697,7 @@ public:
    */
   template <typename T> static void FindTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueElementFacets<T, 2>(tetList, GetTetEdgeVerts(), false, edgeList);
   }
 
   /**
@@ -530,52 +707,7 @@ public:
   */
   template <typename T> static void FindHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::set<std::pair<T, T>> edgeSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 =  {verts[4], verts[5]};
-      std::vector<T> edge9 =  {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeSet.insert(edge);
-      }
-    }
-
-    typename std::set<std::pair<T, T>>::iterator setIter;
-    edgeList->resize(edgeSet.size());
-    T* uEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(setIter = edgeSet.begin(); setIter != edgeSet.end(); ++setIter)
-    {
-      uEdges[2 * index] = (*setIter).first;
-      uEdges[2 * index + 1] = (*setIter).second;
-      ++index;
-    }
+    FindUniqueElementFacets<T, 2>(hexList, GetHexEdgeVerts(), false, edgeList);
   }
 
   /**
@@ -585,41 +717,7 @@ public:
    */
   template <typename T> static void FindTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::set<std::tuple<T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[3 * index] = std::get<0>(*setIter);
-      uFaces[3 * index + 1] = std::get<1>(*setIter);
-      uFaces[3 * index + 2] = std::get<2>(*setIter);
-      ++index;
-    }
+    FindUniqueElementFacets<T, 3>(tetList, GetTetFaceVerts(), false, faceList);
   }
 
   /**
@@ -629,45 +727,7 @@ public:
   */
   template <typename T> static void FindHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::set<std::tuple<T, T, T, T>> faceSet;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceSet.insert(face);
-      }
-    }
-
-    typename std::set<std::tuple<T, T, T, T>>::iterator setIter;
-    faceList->resize(faceSet.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(setIter = faceSet.begin(); setIter != faceSet.end(); ++setIter)
-    {
-      uFaces[4 * index] = std::get<0>(*setIter);
-      uFaces[4 * index + 1] = std::get<1>(*setIter);
-      uFaces[4 * index + 2] = std::get<2>(*setIter);
-      uFaces[4 * index + 3] = std::get<3>(*setIter);
-      ++index;
-    }
+    FindUniqueElementFacets<T, 4>(hexList, GetHexFaceVerts(), false, faceList);
   }
 
   /**
@@ -677,75 +737,7 @@ public:
    */
   template <typename T> static void Find2DUnsharedEdges(typename DataArray<T>::Pointer elemList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    T v0 = 0;
-    T v1 = 0;
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = elemList->getTuplePointer(i);
-
-      for(size_t j = 0; j < numVertsPerElem; j++)
-      {
-        if(j == (numVertsPerElem - 1))
-        {
-          if(verts[j] > verts[0])
-          {
-            v0 = verts[0];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[0];
-          }
-        }
-        else
-        {
-          if(verts[j] > verts[j + 1])
-          {
-            v0 = verts[j + 1];
-            v1 = verts[j];
-          }
-          else
-          {
-            v0 = verts[j];
-            v1 = verts[j + 1];
-          }
-        }
-        edge = std::make_pair(v0, v1);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueElementFacets<T, 2>(elemList, Get2DElementEdgeVerts(elemList->getNumberOfComponents()), true, edgeList);
   }
 
   /**
@@ -755,55 +747,7 @@ public:
   */
   template <typename T> static void FindUnsharedTetEdges(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[0], verts[2]};
-      std::vector<T> edge2 = {verts[1], verts[2]};
-      std::vector<T> edge3 = {verts[0], verts[3]};
-      std::vector<T> edge4 = {verts[1], verts[3]};
-      std::vector<T> edge5 = {verts[2], verts[3]};
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueElementFacets<T, 2>(tetList, GetTetEdgeVerts(), true, edgeList);
   }
 
   /**
@@ -813,65 +757,7 @@ public:
   */
   template <typename T> static void FindUnsharedHexEdges(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer edgeList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::pair<T, T> edge;
-    std::map<std::pair<T, T>, T> edgeMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> edge0 = {verts[0], verts[1]};
-      std::vector<T> edge1 = {verts[1], verts[2]};
-      std::vector<T> edge2 = {verts[2], verts[3]};
-      std::vector<T> edge3 = {verts[3], verts[0]};
-
-      std::vector<T> edge4 = {verts[0], verts[4]};
-      std::vector<T> edge5 = {verts[1], verts[5]};
-      std::vector<T> edge6 = {verts[2], verts[6]};
-      std::vector<T> edge7 = {verts[3], verts[7]};
-
-      std::vector<T> edge8 = {verts[4], verts[5]};
-      std::vector<T> edge9 = {verts[5], verts[6]};
-      std::vector<T> edge10 = {verts[6], verts[7]};
-      std::vector<T> edge11 = {verts[7], verts[4]};
-
-      std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5,
-                                            edge6, edge7, edge8, edge9, edge10, edge11};
-
-      for(auto&& uEdge : edgeList)
-      {
-        std::sort(uEdge.begin(), uEdge.end());
-        edge = std::make_pair(uEdge[0], uEdge[1]);
-        edgeMap[edge]++;
-      }
-    }
-
-    typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-    while(mapIter != edgeMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        edgeMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    edgeList->resize(edgeMap.size());
-    T* bEdges = edgeList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = edgeMap.begin(); mapIter != edgeMap.end(); ++mapIter)
-    {
-      bEdges[2 * index] = (*mapIter).first.first;
-      bEdges[2 * index + 1] = (*mapIter).first.second;
-      ++index;
-    }
+    FindUniqueElementFacets<T, 2>(hexList, GetHexEdgeVerts(), true, edgeList);
   }
 
   /**
@@ -881,54 +767,7 @@ public:
    */
   template <typename T> static void FindUnsharedTetFaces(typename DataArray<T>::Pointer tetList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = tetList->getNumberOfTuples();
-
-    std::tuple<T, T, T> face;
-    std::map<std::tuple<T, T, T>, T> faceMap;
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      T* verts = tetList->getTuplePointer(i);
-
-      std::vector<T> tri0 = {verts[0], verts[1], verts[2]};
-      std::vector<T> tri1 = {verts[1], verts[2], verts[3]};
-      std::vector<T> tri2 = {verts[0], verts[2], verts[3]};
-      std::vector<T> tri3 = {verts[0], verts[1], verts[3]};
-      std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-      for(auto&& tri : triList)
-      {
-        std::sort(tri.begin(), tri.end());
-        face = std::make_tuple(tri[0], tri[1], tri[2]);
-        faceMap[face]++;
-      }
-    }
-
-    typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
-
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
-
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[3 * index] = std::get<0>((*mapIter).first);
-      uFaces[3 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[3 * index + 2] = std::get<2>((*mapIter).first);
-      ++index;
-    }
+    FindUniqueElementFacets<T, 3>(tetList, GetTetFaceVerts(), true, faceList);
   }
 
   /**
@@ -938,58 +777,59 @@ public:
   */
   template <typename T> static void FindUnsharedHexFaces(typename DataArray<T>::Pointer hexList, typename DataArray<T>::Pointer faceList)
   {
-    size_t numElems = hexList->getNumberOfTuples();
-
-    std::tuple<T, T, T, T> face;
-    std::map<std::tuple<T, T, T, T>, T> faceMap;
+    FindUniqueElementFacets<T, 4>(hexList, GetHexFaceVerts(), true, faceList);
+  }
 
-    for(size_t i = 0; i < numElems; i++)
+protected:
+  /**
+   * @brief Get2DElementEdgeVerts Returns the edges of a triangle or quadrilateral, which connect each vertex to the next one
+   * @param numVertsPerElem
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> Get2DElementEdgeVerts(size_t numVertsPerElem)
+  {
+    std::vector<std::array<size_t, 2>> edges(numVertsPerElem);
+    for(size_t j = 0; j < numVertsPerElem; j++)
     {
-      T* verts = hexList->getTuplePointer(i);
-
-      std::vector<T> quad0 = {verts[0], verts[1], verts[5], verts[4]};
-      std::vector<T> quad1 = {verts[1], verts[2], verts[6], verts[5]};
-      std::vector<T> quad2 = {verts[2], verts[3], verts[7], verts[6]};
-      std::vector<T> quad3 = {verts[3], verts[0], verts[4], verts[7]};
-      std::vector<T> quad4 = {verts[0], verts[1], verts[2], verts[3]};
-      std::vector<T> quad5 = {verts[4], verts[5], verts[6], verts[7]};
-
-      std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-      for(auto&& quad : quadList)
-      {
-        std::sort(quad.begin(), quad.end());
-        face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-        faceMap[face]++;
-      }
+      edges[j] = {{j, (j + 1) % numVertsPerElem}};
     }
+    return edges;
+  }
 
-    typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
+  /**
+   * @brief GetTetEdgeVerts
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> GetTetEdgeVerts()
+  {
+    return {{{0, 1}}, {{0, 2}}, {{1, 2}}, {{0, 3}}, {{1, 3}}, {{2, 3}}};
+  }
 
-    while(mapIter != faceMap.end())
-    {
-      if((*mapIter).second > 1)
-      {
-        faceMap.erase(mapIter++);
-      }
-      else
-      {
-        ++mapIter;
-      }
-    }
+  /**
+   * @brief GetHexEdgeVerts
+   * @return
+   */
+  static std::vector<std::array<size_t, 2>> GetHexEdgeVerts()
+  {
+    return {{{0, 1}}, {{1, 2}}, {{2, 3}}, {{3, 0}}, {{0, 4}}, {{1, 5}}, {{2, 6}}, {{3, 7}}, {{4, 5}}, {{5, 6}}, {{6, 7}}, {{7, 4}}};
+  }
 
-    faceList->resize(faceMap.size());
-    T* uFaces = faceList->getPointer(0);
-    T index = 0;
+  /**
+   * @brief GetTetFaceVerts
+   * @return
+   */
+  static std::vector<std::array<size_t, 3>> GetTetFaceVerts()
+  {
+    return {{{0, 1, 2}}, {{1, 2, 3}}, {{0, 2, 3}}, {{0, 1, 3}}};
+  }
 
-    for(mapIter = faceMap.begin(); mapIter != faceMap.end(); ++mapIter)
-    {
-      uFaces[4 * index] = std::get<0>((*mapIter).first);
-      uFaces[4 * index + 1] = std::get<1>((*mapIter).first);
-      uFaces[4 * index + 2] = std::get<2>((*mapIter).first);
-      uFaces[4 * index + 3] = std::get<3>((*mapIter).first);
-      ++index;
-    }
+  /**
+   * @brief GetHexFaceVerts
+   * @return
+   */
+  static std::vector<std::array<size_t, 4>> GetHexFaceVerts()
+  {
+    return {{{0, 1, 5, 4}}, {{1, 2, 6, 5}}, {{2, 3, 7, 6}}, {{3, 0, 4, 7}}, {{0, 1, 2, 3}}, {{4, 5, 6, 7}}};
   }
 };
 
@@ -0,0 +1,258 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+public:
+  GeometryHelpersTest() = default;
+
+  virtual ~GeometryHelpersTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Two tetrahedra sharing the face (1, 2, 3)
+  // -----------------------------------------------------------------------------
+  Int64ArrayType::Pointer CreateTets()
+  {
+    QVector<size_t> cDims(1, 4);
+    Int64ArrayType::Pointer tets = Int64ArrayType::CreateArray(2, cDims, "Tets");
+    int64_t verts[8] = {0, 1, 2, 3, 1, 2, 3, 4};
+    for(size_t i = 0; i < 8; i++)
+    {
+      tets->setValue(i, verts[i]);
+    }
+    return tets;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindTetEdgesAndFaces()
+  {
+    Int64ArrayType::Pointer tets = CreateTets();
+
+    QVector<size_t> cDims(1, 2);
+    Int64ArrayType::Pointer edges = Int64ArrayType::CreateArray(0, cDims, "Edges");
+    GeometryHelpers::Connectivity::FindTetEdges<int64_t>(tets, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 9)
+    // Edges come out sorted with the smaller vertex first
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(1), 1)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(16), 3)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(17), 4)
+
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges<int64_t>(tets, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 6)
+
+    cDims[0] = 3;
+    Int64ArrayType::Pointer faces = Int64ArrayType::CreateArray(0, cDims, "Faces");
+    GeometryHelpers::Connectivity::FindTetFaces<int64_t>(tets, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 7)
+
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces<int64_t>(tets, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 6)
+    for(size_t i = 0; i < faces->getNumberOfTuples(); i++)
+    {
+      int64_t* face = faces->getTuplePointer(i);
+      bool isShared = (face[0] == 1 && face[1] == 2 && face[2] == 3);
+      DREAM3D_REQUIRE_EQUAL(isShared, false)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two hexahedra stacked on top of each other, sharing the face (4, 5, 6, 7)
+  // -----------------------------------------------------------------------------
+  Int64ArrayType::Pointer CreateHexes()
+  {
+    QVector<size_t> cDims(1, 8);
+    Int64ArrayType::Pointer hexes = Int64ArrayType::CreateArray(2, cDims, "Hexes");
+    for(size_t i = 0; i < 16; i++)
+    {
+      hexes->setValue(i, static_cast<int64_t>(i < 8 ? i : i - 4));
+    }
+    return hexes;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindHexEdgesAndFaces()
+  {
+    Int64ArrayType::Pointer hexes = CreateHexes();
+
+    QVector<size_t> cDims(1, 2);
+    Int64ArrayType::Pointer edges = Int64ArrayType::CreateArray(0, cDims, "Edges");
+    GeometryHelpers::Connectivity::FindHexEdges<int64_t>(hexes, edges);
+    // 12 edges each, minus the 4 edges of the shared face
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 20)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(1), 1)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(38), 10)
+    DREAM3D_REQUIRE_EQUAL(edges->getValue(39), 11)
+
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges<int64_t>(hexes, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 16)
+
+    cDims[0] = 4;
+    Int64ArrayType::Pointer faces = Int64ArrayType::CreateArray(0, cDims, "Faces");
+    GeometryHelpers::Connectivity::FindHexFaces<int64_t>(hexes, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 11)
+
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces<int64_t>(hexes, faces);
+    DREAM3D_REQUIRE_EQUAL(faces->getNumberOfTuples(), 10)
+    for(size_t i = 0; i < faces->getNumberOfTuples(); i++)
+    {
+      int64_t* face = faces->getTuplePointer(i);
+      bool isShared = (face[0] == 4 && face[1] == 5 && face[2] == 6 && face[3] == 7);
+      DREAM3D_REQUIRE_EQUAL(isShared, false)
+    }
+
+    Int64Int64DynamicListArray::Pointer elemsContainingVert = Int64Int64DynamicListArray::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<int64_t, int64_t>(hexes, elemsContainingVert, 12);
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getNumberOfElements(5), 2)
+    Int64Int64DynamicListArray::Pointer neighbors = Int64Int64DynamicListArray::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<int64_t, int64_t>(hexes, elemsContainingVert, neighbors, IGeometry::Type::Hexahedral);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(0)[0], 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void Test2DElementEdges()
+  {
+    // Two triangles sharing the edge (1, 2) and two quadrilaterals sharing the edge (1, 4)
+    QVector<size_t> cDims(1, 3);
+    Int64ArrayType::Pointer tris = Int64ArrayType::CreateArray(2, cDims, "Triangles");
+    int64_t triVerts[6] = {0, 1, 2, 1, 3, 2};
+    std::copy(triVerts, triVerts + 6, tris->getPointer(0));
+    cDims[0] = 4;
+    Int64ArrayType::Pointer quads = Int64ArrayType::CreateArray(2, cDims, "Quads");
+    int64_t quadVerts[8] = {0, 1, 4, 3, 1, 2, 5, 4};
+    std::copy(quadVerts, quadVerts + 8, quads->getPointer(0));
+
+    cDims[0] = 2;
+    Int64ArrayType::Pointer edges = Int64ArrayType::CreateArray(0, cDims, "Edges");
+    GeometryHelpers::Connectivity::Find2DElementEdges<int64_t>(tris, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 5)
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(tris, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 4)
+    for(size_t i = 0; i < edges->getNumberOfTuples(); i++)
+    {
+      bool isShared = (edges->getComponent(i, 0) == 1 && edges->getComponent(i, 1) == 2);
+      DREAM3D_REQUIRE_EQUAL(isShared, false)
+    }
+
+    GeometryHelpers::Connectivity::Find2DElementEdges<int64_t>(quads, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 7)
+    // Quadrilateral edges connect consecutive vertices only, never the diagonals
+    for(size_t i = 0; i < edges->getNumberOfTuples(); i++)
+    {
+      bool isDiagonal = (edges->getComponent(i, 0) == 0 && edges->getComponent(i, 1) == 4);
+      DREAM3D_REQUIRE_EQUAL(isDiagonal, false)
+    }
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges<int64_t>(quads, edges);
+    DREAM3D_REQUIRE_EQUAL(edges->getNumberOfTuples(), 6)
+
+    Int64Int64DynamicListArray::Pointer elemsContainingVert = Int64Int64DynamicListArray::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<int64_t, int64_t>(quads, elemsContainingVert, 6);
+    Int64Int64DynamicListArray::Pointer neighbors = Int64Int64DynamicListArray::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<int64_t, int64_t>(quads, elemsContainingVert, neighbors, IGeometry::Type::Quad);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(1), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(1)[0], 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFindElementNeighbors()
+  {
+    Int64ArrayType::Pointer tets = CreateTets();
+
+    Int64Int64DynamicListArray::Pointer elemsContainingVert = Int64Int64DynamicListArray::New();
+    GeometryHelpers::Connectivity::FindElementsContainingVert<int64_t, int64_t>(tets, elemsContainingVert, 5);
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->size(), 5)
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getNumberOfElements(2), 2)
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getElementListPointer(2)[0], 0)
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getElementListPointer(2)[1], 1)
+    DREAM3D_REQUIRE_EQUAL(elemsContainingVert->getTotalNumberOfElements(), 8)
+
+    Int64Int64DynamicListArray::Pointer neighbors = Int64Int64DynamicListArray::New();
+    int err = GeometryHelpers::Connectivity::FindElementNeighbors<int64_t, int64_t>(tets, elemsContainingVert, neighbors, IGeometry::Type::Tetrahedral);
+    DREAM3D_REQUIRE(err >= 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(0)[0], 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(1), 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(1)[0], 0)
+
+    // A list that grows past its allocated size must not disturb its neighbors in the arena
+    Int64Int64DynamicListArray::Pointer copy = neighbors->deepCopy();
+    int64_t grown[3] = {7, 8, 9};
+    copy->setElementList(0, 3, grown);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfElements(0), 3)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(0)[2], 9)
+    DREAM3D_REQUIRE_EQUAL(copy->getElementListPointer(1)[0], 0)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getElementListPointer(0)[0], 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFindTetEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(TestFindHexEdgesAndFaces());
+    DREAM3D_REGISTER_TEST(Test2DElementEdges());
+    DREAM3D_REGISTER_TEST(TestFindElementNeighbors());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
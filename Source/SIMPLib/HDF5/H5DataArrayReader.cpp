@@ -35,8 +35,10 @@
 
 #include "H5DataArrayReader.h"
 
+#include <mutex>
 #include <vector>
 
+#include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -58,10 +60,57 @@ H5DataArrayReader::~H5DataArrayReader() = default;
 
 namespace Detail
 {
+/**
+ * @brief The Hyperslab struct holds a selection in the order HDF5 stores the dimensions (slowest first)
+ */
+struct Hyperslab
+{
+  QVector<hsize_t> start;
+  QVector<hsize_t> stride;
+  QVector<hsize_t> count;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const QVector<size_t>& tDims, const QVector<size_t>& cDims)
+bool createHyperslab(const QVector<size_t>& tDims, const QVector<size_t>& cDims, const QVector<size_t>& start, const QVector<size_t>& stride, const QVector<size_t>& count, Hyperslab& hyperslab)
+{
+  if(start.size() != tDims.size() || stride.size() != tDims.size() || count.size() != tDims.size())
+  {
+    return false;
+  }
+  for(int i = 0; i < tDims.size(); i++)
+  {
+    if(stride[i] == 0 || count[i] == 0 || start[i] + (count[i] - 1) * stride[i] >= tDims[i])
+    {
+      return false;
+    }
+  }
+
+  // The tuple dimensions are stored as ZYX in the file, followed by the reversed component dimensions
+  hyperslab.start.clear();
+  hyperslab.stride.clear();
+  hyperslab.count.clear();
+  for(int i = tDims.size() - 1; i >= 0; i--)
+  {
+    hyperslab.start.push_back(start[i]);
+    hyperslab.stride.push_back(stride[i]);
+    hyperslab.count.push_back(count[i]);
+  }
+  for(int i = cDims.size() - 1; i >= 0; i--)
+  {
+    hyperslab.start.push_back(0);
+    hyperslab.stride.push_back(1);
+    hyperslab.count.push_back(cDims[i]);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const QVector<size_t>& tDims, const QVector<size_t>& cDims, const Hyperslab* hyperslab = nullptr)
 {
   herr_t err = -1;
   IDataArray::Pointer ptr;
@@ -69,7 +118,14 @@ template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QStri
   ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath);
 
   T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  if(nullptr != hyperslab)
+  {
+    err = QH5Lite::readPointerDatasetHyperslab(locId, datasetPath, hyperslab->start, hyperslab->stride, hyperslab->count, data);
+  }
+  else
+  {
+    err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  }
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
@@ -174,12 +230,12 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
   // dimensions does not make sense.
   StringDataArray::Pointer strTemp = StringDataArray::CreateArray(dims[0], name);
 
-  std::vector<std::string> strings;
-  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), strings);
-  // Copy the data into
-  for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;
+  err = H5Lite::readVectorOfStringDataset(gid, name.toStdString(), buffer, offsets);
+  if(err >= 0)
   {
-    strTemp->setValue(i, QString::fromStdString(strings[i]));
+    strTemp->setPackedStrings(std::move(buffer), std::move(offsets));
   }
   if(err < 0)
   {
@@ -196,6 +252,14 @@ IDataArray::Pointer H5DataArrayReader::ReadStringDataArray(hid_t gid, const QStr
 //
 // -----------------------------------------------------------------------------
 IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  return ReadIDataArrayRegion(gid, name, QVector<size_t>(), QVector<size_t>(), QVector<size_t>(), metaDataOnly);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArrayRegion(hid_t gid, const QString& name, const QVector<size_t>& start, const QVector<size_t>& stride, const QVector<size_t>& count, bool metaDataOnly)
 {
 
   herr_t err = -1;
@@ -232,12 +296,27 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       return ptr;
     }
 
+    // Only read a strided box of tuples if a region was requested
+    Detail::Hyperslab hyperslab;
+    const Detail::Hyperslab* region = nullptr;
+    if(!count.isEmpty())
+    {
+      if(!Detail::createHyperslab(tDims, cDims, start, stride, count, hyperslab))
+      {
+        qDebug() << "The requested region does not fit the tuple dimensions of " << name;
+        H5Tclose(typeId);
+        return ptr;
+      }
+      region = &hyperslab;
+      tDims = count;
+    }
+
     // Check to see if we are reading a bool array and if so read it and return
     if(classType.compare("DataArray<bool>") == 0)
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims);
+        ptr = Detail::readH5Dataset<bool>(gid, name, tDims, cDims, region);
       }
       else
       {
@@ -264,7 +343,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint8_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -275,7 +354,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint16_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -286,7 +365,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint32_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -297,7 +376,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<uint64_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -308,7 +387,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int8_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -319,7 +398,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int16_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -330,7 +409,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int32_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -341,7 +420,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<int64_t>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -359,7 +438,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<float>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -370,7 +449,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
       {
         if(!metaDataOnly)
         {
-          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims);
+          ptr = Detail::readH5Dataset<double>(gid, name, tDims, cDims, region);
         }
         else
         {
@@ -551,3 +630,125 @@ IDataArray::Pointer H5DataArrayReader::ReadNeighborListData(hid_t gid, const QSt
   }
   return iDataArray;
 }
+
+namespace Detail
+{
+/**
+ * @brief LazyLoadMutex Serializes the HDF5 calls of the lazy loaders. Arrays may be touched for the
+ * first time from several threads at once and the HDF5 library is not built thread safe.
+ */
+std::mutex& LazyLoadMutex()
+{
+  static std::mutex s_LazyLoadMutex;
+  return s_LazyLoadMutex;
+}
+} // namespace Detail
+
+/**
+ * @brief The H5DataArrayReader::LazyLoadFile class holds the file id shared by the loaders of one file
+ */
+class H5DataArrayReader::LazyLoadFile
+{
+public:
+  explicit LazyLoadFile(const QString& filePath)
+  : m_FilePath(filePath)
+  {
+  }
+
+  ~LazyLoadFile()
+  {
+    if(m_FileId >= 0)
+    {
+      std::lock_guard<std::mutex> lock(Detail::LazyLoadMutex());
+      QH5Utilities::closeFile(m_FileId);
+    }
+  }
+
+  /**
+   * @brief getFileId Opens the file on the first call. The caller must hold Detail::LazyLoadMutex().
+   * @return
+   */
+  hid_t getFileId()
+  {
+    if(m_FileId < 0)
+    {
+      m_FileId = QH5Utilities::openFile(m_FilePath, true);
+    }
+    return m_FileId;
+  }
+
+private:
+  QString m_FilePath;
+  hid_t m_FileId = -1;
+
+public:
+  LazyLoadFile(const LazyLoadFile&) = delete;            // Copy Constructor Not Implemented
+  LazyLoadFile(LazyLoadFile&&) = delete;                 // Move Constructor Not Implemented
+  LazyLoadFile& operator=(const LazyLoadFile&) = delete; // Copy Assignment Not Implemented
+  LazyLoadFile& operator=(LazyLoadFile&&) = delete;      // Move Assignment Not Implemented
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataArrayReader::LazyLoadFilePointer H5DataArrayReader::CreateLazyLoadFile(const QString& filePath)
+{
+  return std::make_shared<LazyLoadFile>(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::LazyLoader H5DataArrayReader::CreateLazyLoader(const LazyLoadFilePointer& file, const QString& groupPath, const QString& name)
+{
+  return [file, groupPath, name](void* buffer, size_t numBytes) -> int32_t {
+    std::lock_guard<std::mutex> lock(Detail::LazyLoadMutex());
+
+    hid_t fileId = file->getFileId();
+    if(fileId < 0)
+    {
+      return -1;
+    }
+
+    hid_t gid = H5Gopen(fileId, groupPath.toLatin1().data(), H5P_DEFAULT);
+    if(gid < 0)
+    {
+      return -2;
+    }
+    H5ScopedGroupSentinel sentinel(&gid, false);
+
+    hid_t datasetId = H5Dopen(gid, name.toLatin1().data(), H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      return -3;
+    }
+    hid_t typeId = H5Dget_type(datasetId);
+    hid_t nativeTypeId = (typeId < 0) ? -1 : H5Tget_native_type(typeId, H5T_DIR_ASCEND);
+    hid_t spaceId = H5Dget_space(datasetId);
+
+    herr_t err = -4;
+    if(nativeTypeId >= 0 && spaceId >= 0)
+    {
+      hssize_t numElements = H5Sget_simple_extent_npoints(spaceId);
+      if(numElements >= 0 && static_cast<size_t>(numElements) * H5Tget_size(nativeTypeId) == numBytes)
+      {
+        err = H5Dread(datasetId, nativeTypeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
+      }
+    }
+
+    if(spaceId >= 0)
+    {
+      H5Sclose(spaceId);
+    }
+    if(nativeTypeId >= 0)
+    {
+      H5Tclose(nativeTypeId);
+    }
+    if(typeId >= 0)
+    {
+      H5Tclose(typeId);
+    }
+    H5Dclose(datasetId);
+    return (err < 0) ? -4 : 0;
+  };
+}
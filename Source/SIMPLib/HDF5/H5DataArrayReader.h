@@ -36,6 +36,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <hdf5.h>
 
 #include <QtCore/QString>
@@ -76,6 +78,21 @@ class SIMPLib_EXPORT H5DataArrayReader
      */
     static IDataArray::Pointer ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+    /**
+     * @brief ReadIDataArrayRegion Reads a strided box of tuples of a DataArray<T> from the HDF5 file
+     * through a hyperslab selection so only the selected tuples are transferred. The returned array
+     * has count as its tuple dimensions. Empty vectors read the whole data set.
+     * @param gid The HDF5 Group to read the data array from
+     * @param name The name of the data set
+     * @param start The first tuple along each tuple dimension (X, Y, Z order)
+     * @param stride The step between selected tuples along each tuple dimension
+     * @param count The number of tuples to read along each tuple dimension
+     * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+     * @return
+     */
+    static IDataArray::Pointer ReadIDataArrayRegion(hid_t gid, const QString& name, const QVector<size_t>& start, const QVector<size_t>& stride, const QVector<size_t>& count,
+                                                    bool metaDataOnly = false);
+
     /**
      * @brief ReadNeighborListData
      * @param gid The HDF5 Group to read the data array from
@@ -94,6 +111,30 @@ class SIMPLib_EXPORT H5DataArrayReader
      */
     static IDataArray::Pointer ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+    /**
+     * @brief The LazyLoadFile class is shared by the loaders created for one file. The file is opened
+     * read-only by the first load and stays open until the last loader referring to it is released,
+     * which happens once every array it was created for has been loaded or discarded.
+     */
+    class LazyLoadFile;
+    using LazyLoadFilePointer = std::shared_ptr<LazyLoadFile>;
+
+    /**
+     * @brief CreateLazyLoadFile Creates the file handle to pass to CreateLazyLoader(). Nothing is opened yet.
+     * @param filePath The HDF5 file that contains the data sets
+     * @return
+     */
+    static LazyLoadFilePointer CreateLazyLoadFile(const QString& filePath);
+
+    /**
+     * @brief CreateLazyLoader Creates a loader that reads the raw payload of a DataArray<T> data set
+     * on demand. The buffer must be exactly the size of the data set converted to its native type.
+     * @param file The file that contains the data set, see CreateLazyLoadFile()
+     * @param groupPath The path of the group that contains the data set
+     * @param name The name of the data set
+     * @return
+     */
+    static IDataArray::LazyLoader CreateLazyLoader(const LazyLoadFilePointer& file, const QString& groupPath, const QString& name);
 
   protected:
     H5DataArrayReader();
@@ -35,10 +35,13 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <hdf5.h>
 
 #include <QtCore/QString>
 
+#include "H5Support/H5DatasetCompression.h"
 #include "H5Support/QH5Lite.h"
 
 #include "SIMPLib/SIMPLib.h"
@@ -113,10 +116,11 @@ class H5DataArrayWriter
      * @param gid
      * @param dataArray
      * @param tDims
+     * @param compression Chunking/compression options applied when the dataset is created
      * @return
      */
     template<class T>
-    static int writeDataArray(hid_t gid, T* dataArray, QVector<size_t> tDims)
+    static int writeDataArray(hid_t gid, T* dataArray, QVector<size_t> tDims, const H5DatasetCompression& compression = H5DatasetCompression())
     {
       int err = 0;
 
@@ -163,9 +167,12 @@ class H5DataArrayWriter
         h5Dims[i + tDims.size()] = cDims[i];
       }
 #endif
+      // Read through the const accessor so that an array sharing its buffer with a copy is not duplicated
+      using ElementType = typename std::remove_const<typename std::remove_pointer<decltype(dataArray->getConstPointer(0))>::type>::type;
+      ElementType* data = const_cast<ElementType*>(dataArray->getConstPointer(0));
       if (QH5Lite::datasetExists(gid, dataArray->getName()) == false)
       {
-        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), data, compression);
         if(err < 0)
         {
           return err;
@@ -173,7 +180,7 @@ class H5DataArrayWriter
       }
       else
       {
-        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), data, compression);
         if(err < 0)
         {
           return err;
@@ -190,21 +197,21 @@ class H5DataArrayWriter
      * @brief writeDataArray
      * @param gid
      * @param dataArray
-     * @param tDims
+     * @param compression The chunking and compression settings for the new dataset
      * @return
      */
     template<class T>
-    static int writeStringDataArray(hid_t gid, T* dataArray)
+    static int writeStringDataArray(hid_t gid, T* dataArray, const H5DatasetCompression& compression = H5DatasetCompression())
     {
       int err = 0;
 
-      std::vector<std::string> data(dataArray->getNumberOfTuples());
-      for(int i = 0; i < data.size(); i++)
+      // The strings are already packed as UTF-8 so they go out in a single write
+      std::vector<const char*> data = dataArray->getCStrings();
+      err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data, compression);
+      if(err < 0)
       {
-        data[i] = dataArray->getValue(i).toStdString();
+        return err;
       }
-
-      err = H5Lite::writeVectorOfStringsDataset(gid, dataArray->getName().toStdString(), data);
       QVector<size_t> tDims(1, dataArray->getNumberOfTuples());
       QVector<size_t> cDims(1, 1);
       err = writeDataArrayAttributes<T>(gid, dataArray, tDims, cDims);
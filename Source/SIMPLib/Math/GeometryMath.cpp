@@ -41,6 +41,7 @@
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Math/TriangleBVH.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 //#include "SIMPLib/Math/SIMPLibRandom.h"
 
@@ -1167,3 +1168,11 @@ LOOP:
 
     return 'o';
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char GeometryMath::PointInPolyhedron(const TriangleBVH& bvh, const float* q)
+{
+  return bvh.pointInPolyhedron(q);
+}
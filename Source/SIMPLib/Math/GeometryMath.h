@@ -43,6 +43,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class TriangleBVH;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -211,6 +212,15 @@ class SIMPLib_EXPORT GeometryMath
                                   float radius,
                                   float& distToBoundary);
 
+    /**
+     * @brief Determines if a point is inside of the closed surface held by a bounding volume hierarchy. Only the
+     * faces whose bounding boxes the ray passes through are tested, see TriangleBVH::pointInPolyhedron().
+     * @param bvh
+     * @param q
+     * @return
+     */
+    static char PointInPolyhedron(const TriangleBVH& bvh, const float* q);
+
     /**
        * @brief Determines if a point is inside of a triangle defined by 3 points
        * @param a
@@ -0,0 +1,171 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/TriangleBVH.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+
+  virtual ~TriangleBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // The unit cube as 12 triangles, the faces at z = 1 are 2 and 3
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateCube()
+  {
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(8);
+    for(int64_t i = 0; i < 8; i++)
+    {
+      float* vert = vertices->getTuplePointer(i);
+      vert[0] = static_cast<float>(i & 1);
+      vert[1] = static_cast<float>((i >> 1) & 1);
+      vert[2] = static_cast<float>((i >> 2) & 1);
+    }
+
+    int64_t tris[36] = {0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4, 2, 3, 7, 2, 7, 6, 0, 2, 6, 0, 6, 4, 1, 3, 7, 1, 7, 5};
+    TriangleGeom::Pointer cube = TriangleGeom::CreateGeometry(12, vertices, "Cube");
+    for(int64_t i = 0; i < 12; i++)
+    {
+      cube->setVertsAtTri(i, tris + 3 * i);
+    }
+    return cube;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointInPolyhedron()
+  {
+    TriangleGeom::Pointer cube = CreateCube();
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(cube.get());
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), 12)
+
+    float ll[3] = {0.0f, 0.0f, 0.0f};
+    float ur[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(ll, ur);
+    DREAM3D_REQUIRE_EQUAL(ll[0], 0.0f)
+    DREAM3D_REQUIRE_EQUAL(ur[2], 1.0f)
+
+    const size_t numPoints = 6;
+    float points[3 * numPoints] = {0.5f, 0.5f, 0.5f, 0.1f, 0.2f, 0.9f, 0.95f, 0.05f, 0.4f, 1.5f, 0.5f, 0.5f, -0.2f, 0.3f, 0.3f, 0.3f, 0.3f, 1.01f};
+    char expected[numPoints] = {'i', 'i', 'i', 'o', 'o', 'o'};
+
+    // The faces' bounding boxes the linear search expects, two vertices per face
+    int32_t faceIds[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    Int32Int32DynamicListArray::ElementList faceList = {12, faceIds};
+    VertexGeom::Pointer faceBBs = VertexGeom::CreateGeometry(24, "FaceBBs");
+    for(int32_t i = 0; i < 12; i++)
+    {
+      GeometryMath::FindBoundingBoxOfFace(cube.get(), i, faceBBs->getVertexPointer(2 * i), faceBBs->getVertexPointer(2 * i + 1));
+    }
+
+    char codes[numPoints];
+    bvh->pointsInPolyhedron(points, numPoints, codes);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* q = points + 3 * i;
+      DREAM3D_REQUIRE_EQUAL(codes[i], expected[i])
+      DREAM3D_REQUIRE_EQUAL(bvh->pointInPolyhedron(q), expected[i])
+      DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, q), GeometryMath::PointInPolyhedron(cube.get(), faceList, faceBBs.get(), q, ll, ur, 10.0f))
+    }
+
+    // A point on a face is reported as such
+    float onFace[3] = {0.3f, 0.6f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(bvh->pointInPolyhedron(onFace), 'F')
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIntersectSegments()
+  {
+    TriangleGeom::Pointer cube = CreateCube();
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(cube.get());
+
+    float starts[6] = {0.25f, 0.6f, 0.5f, 2.0f, 2.0f, 2.0f};
+    float ends[6] = {0.25f, 0.6f, 3.0f, 3.0f, 2.0f, 2.0f};
+    int64_t faceIds[2] = {0, 0};
+    float hitPoints[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    bvh->intersectSegments(starts, ends, 2, faceIds, hitPoints);
+    DREAM3D_REQUIRE(faceIds[0] == 2 || faceIds[0] == 3)
+    DREAM3D_REQUIRE_EQUAL(hitPoints[2], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(faceIds[1], -1)
+
+    // The closest of the two faces along the segment
+    float q[3] = {0.25f, 0.6f, -1.0f};
+    float r[3] = {0.25f, 0.6f, 3.0f};
+    float hitPoint[3] = {0.0f, 0.0f, 0.0f};
+    int64_t faceId = bvh->intersectSegment(q, r, hitPoint);
+    DREAM3D_REQUIRE(faceId == 0 || faceId == 1)
+    DREAM3D_REQUIRE_EQUAL(hitPoint[2], 0.0f)
+
+    // A hierarchy over the top faces only
+    int32_t topFaces[2] = {2, 3};
+    Int32Int32DynamicListArray::ElementList topList = {2, topFaces};
+    TriangleBVH::Pointer top = TriangleBVH::Create(cube.get(), topList);
+    DREAM3D_REQUIRE_EQUAL(top->getNumberOfFaces(), 2)
+    faceId = top->intersectSegment(q, r, hitPoint);
+    DREAM3D_REQUIRE(faceId == 2 || faceId == 3)
+    DREAM3D_REQUIRE_EQUAL(hitPoint[2], 1.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPointInPolyhedron());
+    DREAM3D_REGISTER_TEST(TestIntersectSegments());
+  }
+
+private:
+  TriangleBVHTest(const TriangleBVHTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const TriangleBVHTest&) = delete;  // Move assignment Not Implemented
+};
@@ -0,0 +1,559 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+namespace
+{
+const size_t k_MaxFacesPerLeaf = 4;
+const int k_MaxRayAttempts = 64;
+// A median split halves the faces at every level so the depth stays far below this
+const size_t k_StackSize = 128;
+
+/**
+ * @brief SplitMix64 Returns the next value of a small counter based generator. Every query seeds its own
+ * state so no generator is shared between threads.
+ */
+uint64_t SplitMix64(uint64_t& state)
+{
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+double UniformValue(uint64_t& state)
+{
+  return static_cast<double>(SplitMix64(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint64_t SeedFromPoint(const float* q)
+{
+  uint32_t bits[3] = {0, 0, 0};
+  std::memcpy(bits, q, sizeof(bits));
+  uint64_t state = (static_cast<uint64_t>(bits[0]) << 32) | bits[1];
+  return SplitMix64(state) ^ bits[2];
+}
+
+/**
+ * @brief RandomRay Creates a randomly oriented ray of given length with the same distribution as
+ * GeometryMath::GenerateRandomRay()
+ */
+void RandomRay(uint64_t& state, float length, float ray[3])
+{
+  ray[2] = static_cast<float>(2.0 * UniformValue(state) - 1.0);
+  float t = static_cast<float>(SIMPLib::Constants::k_2Pi * UniformValue(state));
+  float w = sqrtf(1.0f - (ray[2] * ray[2]));
+  ray[0] = w * cosf(t) * length;
+  ray[1] = w * sinf(t) * length;
+  ray[2] *= length;
+}
+
+/**
+ * @brief The PointsInPolyhedronImpl class runs TriangleBVH::pointInPolyhedron() for a range of points
+ */
+class PointsInPolyhedronImpl
+{
+public:
+  PointsInPolyhedronImpl(const TriangleBVH* bvh, const float* points, char* codes)
+  : m_BVH(bvh)
+  , m_Points(points)
+  , m_Codes(codes)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Codes[i] = m_BVH->pointInPolyhedron(m_Points + 3 * i);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Points;
+  char* m_Codes;
+};
+
+/**
+ * @brief The IntersectSegmentsImpl class runs TriangleBVH::intersectSegment() for a range of segments
+ */
+class IntersectSegmentsImpl
+{
+public:
+  IntersectSegmentsImpl(const TriangleBVH* bvh, const float* starts, const float* ends, int64_t* faceIds, float* hitPoints)
+  : m_BVH(bvh)
+  , m_Starts(starts)
+  , m_Ends(ends)
+  , m_FaceIds(faceIds)
+  , m_HitPoints(hitPoints)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    float hitPoint[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = start; i < end; i++)
+    {
+      m_FaceIds[i] = m_BVH->intersectSegment(m_Starts + 3 * i, m_Ends + 3 * i, hitPoint);
+      if(nullptr != m_HitPoints)
+      {
+        std::copy(hitPoint, hitPoint + 3, m_HitPoints + 3 * i);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Starts;
+  const float* m_Ends;
+  int64_t* m_FaceIds;
+  float* m_HitPoints;
+};
+} // namespace
+
+/**
+ * @brief The BuildFace struct holds what the construction needs to know about one face
+ */
+struct TriangleBVH::BuildFace
+{
+  int64_t Id;
+  float Min[3];
+  float Max[3];
+  float Centroid[3];
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH()
+{
+  std::fill(m_Min, m_Min + 3, 0.0f);
+  std::fill(m_Max, m_Max + 3, 0.0f);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(TriangleGeom* faces)
+{
+  std::vector<int64_t> faceIds;
+  if(nullptr != faces)
+  {
+    faceIds.resize(static_cast<size_t>(faces->getNumberOfTris()));
+    for(size_t i = 0; i < faceIds.size(); i++)
+    {
+      faceIds[i] = static_cast<int64_t>(i);
+    }
+  }
+  Pointer bvh(new TriangleBVH);
+  bvh->build(faces, faceIds);
+  return bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds)
+{
+  std::vector<int64_t> ids(faceIds.cells, faceIds.cells + faceIds.ncells);
+  Pointer bvh(new TriangleBVH);
+  bvh->build(faces, ids);
+  return bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::build(TriangleGeom* faces, const std::vector<int64_t>& faceIds)
+{
+  if(nullptr == faces || faceIds.empty())
+  {
+    return;
+  }
+
+  size_t numFaces = faceIds.size();
+  std::vector<BuildFace> buildFaces(numFaces);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    BuildFace& face = buildFaces[i];
+    face.Id = faceIds[i];
+    GeometryMath::FindBoundingBoxOfFace(faces, static_cast<int>(face.Id), face.Min, face.Max);
+    for(size_t d = 0; d < 3; d++)
+    {
+      face.Centroid[d] = 0.5f * (face.Min[d] + face.Max[d]);
+    }
+  }
+
+  m_Nodes.reserve(2 * (numFaces / k_MaxFacesPerLeaf) + 1);
+  buildNode(buildFaces, 0, numFaces);
+
+  // Store the faces in leaf order so a leaf reads one contiguous block
+  m_FaceIds.resize(numFaces);
+  m_Coords.resize(9 * numFaces);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    float* coords = m_Coords.data() + 9 * i;
+    m_FaceIds[i] = buildFaces[i].Id;
+    faces->getVertCoordsAtTri(buildFaces[i].Id, coords, coords + 3, coords + 6);
+  }
+
+  std::copy(m_Nodes[0].Min, m_Nodes[0].Min + 3, m_Min);
+  std::copy(m_Nodes[0].Max, m_Nodes[0].Max + 3, m_Max);
+  float diagonal = sqrtf((m_Max[0] - m_Min[0]) * (m_Max[0] - m_Min[0]) + (m_Max[1] - m_Min[1]) * (m_Max[1] - m_Min[1]) + (m_Max[2] - m_Min[2]) * (m_Max[2] - m_Min[2]));
+  // Any point inside the bounds reaches past them along a ray of this length
+  m_RayLength = (diagonal > 0.0f) ? 2.0f * diagonal : 1.0f;
+  m_Tolerance = 1.0e-5f * m_RayLength;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t TriangleBVH::buildNode(std::vector<BuildFace>& buildFaces, size_t begin, size_t end)
+{
+  int64_t index = static_cast<int64_t>(m_Nodes.size());
+  m_Nodes.push_back(Node());
+
+  Node node;
+  float centroidMin[3];
+  float centroidMax[3];
+  for(size_t d = 0; d < 3; d++)
+  {
+    node.Min[d] = std::numeric_limits<float>::max();
+    node.Max[d] = std::numeric_limits<float>::lowest();
+    centroidMin[d] = std::numeric_limits<float>::max();
+    centroidMax[d] = std::numeric_limits<float>::lowest();
+  }
+  for(size_t i = begin; i < end; i++)
+  {
+    const BuildFace& face = buildFaces[i];
+    for(size_t d = 0; d < 3; d++)
+    {
+      node.Min[d] = std::min(node.Min[d], face.Min[d]);
+      node.Max[d] = std::max(node.Max[d], face.Max[d]);
+      centroidMin[d] = std::min(centroidMin[d], face.Centroid[d]);
+      centroidMax[d] = std::max(centroidMax[d], face.Centroid[d]);
+    }
+  }
+
+  size_t axis = 0;
+  for(size_t d = 1; d < 3; d++)
+  {
+    if(centroidMax[d] - centroidMin[d] > centroidMax[axis] - centroidMin[axis])
+    {
+      axis = d;
+    }
+  }
+
+  size_t count = end - begin;
+  if(count <= k_MaxFacesPerLeaf || centroidMax[axis] <= centroidMin[axis])
+  {
+    node.Offset = static_cast<int64_t>(begin);
+    node.Count = static_cast<int64_t>(count);
+    m_Nodes[index] = node;
+    return index;
+  }
+
+  size_t middle = begin + count / 2;
+  std::nth_element(buildFaces.begin() + begin, buildFaces.begin() + middle, buildFaces.begin() + end,
+                   [axis](const BuildFace& a, const BuildFace& b) { return a.Centroid[axis] < b.Centroid[axis]; });
+
+  buildNode(buildFaces, begin, middle);
+  node.Offset = buildNode(buildFaces, middle, end);
+  node.Count = 0;
+  m_Nodes[index] = node;
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfFaces() const
+{
+  return m_FaceIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float* lowerLeft, float* upperRight) const
+{
+  std::copy(m_Min, m_Min + 3, lowerLeft);
+  std::copy(m_Max, m_Max + 3, upperRight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float TriangleBVH::segmentEntersBox(const float* q, const float* dir, const Node& node) const
+{
+  float tMin = 0.0f;
+  float tMax = 1.0f;
+  for(size_t d = 0; d < 3; d++)
+  {
+    float lo = node.Min[d] - m_Tolerance;
+    float hi = node.Max[d] + m_Tolerance;
+    if(dir[d] == 0.0f)
+    {
+      if(q[d] < lo || q[d] > hi)
+      {
+        return 2.0f;
+      }
+      continue;
+    }
+    float t0 = (lo - q[d]) / dir[d];
+    float t1 = (hi - q[d]) / dir[d];
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tMin = std::max(tMin, t0);
+    tMax = std::min(tMax, t1);
+    if(tMin > tMax)
+    {
+      return 2.0f;
+    }
+  }
+  return tMin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::castRay(const float* q, const float* r, int& crossings) const
+{
+  float dir[3] = {r[0] - q[0], r[1] - q[1], r[2] - q[2]};
+  float p[3] = {0.0f, 0.0f, 0.0f};
+  int64_t stack[k_StackSize];
+  size_t top = 0;
+  stack[top++] = 0;
+  crossings = 0;
+
+  while(top > 0)
+  {
+    int64_t index = stack[--top];
+    const Node& node = m_Nodes[index];
+    if(segmentEntersBox(q, dir, node) > 1.0f)
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      stack[top++] = node.Offset;
+      stack[top++] = index + 1;
+      continue;
+    }
+
+    for(int64_t i = node.Offset; i < node.Offset + node.Count; i++)
+    {
+      const float* a = m_Coords.data() + 9 * i;
+      char code = GeometryMath::RayIntersectsTriangle(a, a + 3, a + 6, q, r, p);
+      /* If ray is degenerate, then another one must be generated. */
+      if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+      {
+        return '?';
+      }
+      /* If ray hits face at interior point, increment crossings. */
+      if(code == 'f')
+      {
+        crossings++;
+      }
+      /* If query endpoint q sits on a V/E/F, return that code. */
+      else if(code == 'V' || code == 'E' || code == 'F')
+      {
+        return code;
+      }
+    }
+  }
+  return '0';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::pointInPolyhedron(const float* q) const
+{
+  /* If query point is outside bounding box, finished. */
+  if(m_Nodes.empty() || !GeometryMath::PointInBox(q, m_Min, m_Max))
+  {
+    return 'o';
+  }
+
+  uint64_t state = SeedFromPoint(q);
+  float ray[3] = {0.0f, 0.0f, 0.0f};
+  float r[3] = {0.0f, 0.0f, 0.0f};
+  int crossings = 0;
+  for(int attempt = 0; attempt < k_MaxRayAttempts; attempt++)
+  {
+    RandomRay(state, m_RayLength, ray);
+    r[0] = q[0] + ray[0];
+    r[1] = q[1] + ray[1];
+    r[2] = q[2] + ray[2];
+
+    char code = castRay(q, r, crossings);
+    if(code == '?')
+    {
+      continue;
+    }
+    if(code != '0')
+    {
+      return code;
+    }
+    /* No degeneracies encountered: ray is generic, so finished. */
+    /* q strictly interior to polyhedron if an odd number of crossings. */
+    return ((crossings % 2) == 1) ? 'i' : 'o';
+  }
+
+  /* Every ray was degenerate, the crossings of the last one can not be trusted. */
+  return '?';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::pointsInPolyhedron(const float* points, size_t numPoints, char* codes) const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), PointsInPolyhedronImpl(this, points, codes), tbb::auto_partitioner());
+#else
+  PointsInPolyhedronImpl serial(this, points, codes);
+  serial.compute(0, numPoints);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t TriangleBVH::intersectSegment(const float* q, const float* r, float* hitPoint) const
+{
+  float dir[3] = {r[0] - q[0], r[1] - q[1], r[2] - q[2]};
+  float lengthSquared = dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2];
+  if(m_Nodes.empty() || lengthSquared == 0.0f)
+  {
+    return -1;
+  }
+
+  float p[3] = {0.0f, 0.0f, 0.0f};
+  float closest = std::numeric_limits<float>::max();
+  int64_t closestFace = -1;
+  int64_t stack[k_StackSize];
+  size_t top = 0;
+  stack[top++] = 0;
+
+  while(top > 0)
+  {
+    int64_t index = stack[--top];
+    const Node& node = m_Nodes[index];
+    float entry = segmentEntersBox(q, dir, node);
+    // Boxes entered behind the closest hit so far can not hold a closer one
+    if(entry > 1.0f || entry > closest)
+    {
+      continue;
+    }
+    if(node.Count == 0)
+    {
+      stack[top++] = node.Offset;
+      stack[top++] = index + 1;
+      continue;
+    }
+
+    for(int64_t i = node.Offset; i < node.Offset + node.Count; i++)
+    {
+      const float* a = m_Coords.data() + 9 * i;
+      char code = GeometryMath::RayIntersectsTriangle(a, a + 3, a + 6, q, r, p);
+      // A segment in the plane of the face does not meet it in a single point
+      if(code == '0' || code == 'p' || code == '?')
+      {
+        continue;
+      }
+      float t = ((p[0] - q[0]) * dir[0] + (p[1] - q[1]) * dir[1] + (p[2] - q[2]) * dir[2]) / lengthSquared;
+      if(t < closest)
+      {
+        closest = t;
+        closestFace = m_FaceIds[i];
+        std::copy(p, p + 3, hitPoint);
+      }
+    }
+  }
+  return closestFace;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::intersectSegments(const float* starts, const float* ends, size_t numSegments, int64_t* faceIds, float* hitPoints) const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, numSegments), IntersectSegmentsImpl(this, starts, ends, faceIds, hitPoints), tbb::auto_partitioner());
+#else
+  IntersectSegmentsImpl serial(this, starts, ends, faceIds, hitPoints);
+  serial.compute(0, numSegments);
+#endif
+}
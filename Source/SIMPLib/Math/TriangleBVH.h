@@ -0,0 +1,178 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+
+class TriangleGeom;
+
+/**
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the faces of a TriangleGeom. It is
+ * built once and then answers point-in-polyhedron and segment intersection queries by only testing the
+ * faces whose bounding boxes the query ray passes through, instead of every face of the surface. The face
+ * coordinates are copied into the hierarchy, so it does not depend on the TriangleGeom after construction
+ * and all queries may be run from several threads at once.
+ *
+ * The point-in-polyhedron query follows GeometryMath::PointInPolyhedron(): it returns 'i' or 'o' for points
+ * strictly inside or outside the surface and 'V', 'E' or 'F' for points that lie on a vertex, edge or face.
+ * The ray directions are derived from the query point, so the batched queries give the same answers no
+ * matter how the work is split between threads.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+  public:
+    SIMPL_SHARED_POINTERS(TriangleBVH)
+    SIMPL_TYPE_MACRO(TriangleBVH)
+
+    /**
+     * @brief Create Builds the hierarchy over all faces of the geometry
+     * @param faces
+     * @return
+     */
+    static Pointer Create(TriangleGeom* faces);
+
+    /**
+     * @brief Create Builds the hierarchy over a subset of the faces of the geometry, i.e. the faces of one feature
+     * @param faces
+     * @param faceIds
+     * @return
+     */
+    static Pointer Create(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds);
+
+    virtual ~TriangleBVH();
+
+    /**
+     * @brief getNumberOfFaces
+     * @return
+     */
+    size_t getNumberOfFaces() const;
+
+    /**
+     * @brief getBounds Returns the lower left and upper right corners of the bounding box of all faces
+     * @param lowerLeft
+     * @param upperRight
+     */
+    void getBounds(float* lowerLeft, float* upperRight) const;
+
+    /**
+     * @brief pointInPolyhedron Determines if a point is inside of the closed surface. Random rays are cast
+     * from the point until one of them is not degenerate.
+     * @param q
+     * @return 'i', 'o', 'V', 'E' or 'F', see GeometryMath::PointInPolyhedron(), or '?' if all of the
+     * k_MaxRayAttempts rays were degenerate and the point could not be classified
+     */
+    char pointInPolyhedron(const float* q) const;
+
+    /**
+     * @brief pointsInPolyhedron Runs pointInPolyhedron() for numPoints points, in parallel if SIMPLib is built with TBB
+     * @param points numPoints x 3 coordinates
+     * @param numPoints
+     * @param codes numPoints results
+     */
+    void pointsInPolyhedron(const float* points, size_t numPoints, char* codes) const;
+
+    /**
+     * @brief intersectSegment Finds the face that the segment from q to r hits closest to q
+     * @param q
+     * @param r
+     * @param hitPoint The intersection point, if any
+     * @return The id of the face or -1 if the segment does not hit the surface
+     */
+    int64_t intersectSegment(const float* q, const float* r, float* hitPoint) const;
+
+    /**
+     * @brief intersectSegments Runs intersectSegment() for numSegments segments, in parallel if SIMPLib is built with TBB
+     * @param starts numSegments x 3 coordinates
+     * @param ends numSegments x 3 coordinates
+     * @param numSegments
+     * @param faceIds numSegments results
+     * @param hitPoints numSegments x 3 intersection points, may be nullptr
+     */
+    void intersectSegments(const float* starts, const float* ends, size_t numSegments, int64_t* faceIds, float* hitPoints) const;
+
+  protected:
+    TriangleBVH();
+
+  private:
+    /**
+     * @brief The Node struct is one box of the hierarchy. A leaf holds Count faces starting at Offset, an
+     * inner node has Count == 0, its first child directly after it and its second child at Offset.
+     */
+    struct Node
+    {
+      float Min[3];
+      float Max[3];
+      int64_t Offset;
+      int64_t Count;
+    };
+
+    struct BuildFace;
+
+    std::vector<Node> m_Nodes;
+    std::vector<int64_t> m_FaceIds;
+    std::vector<float> m_Coords;
+    float m_Min[3];
+    float m_Max[3];
+    float m_RayLength = 0.0f;
+    float m_Tolerance = 0.0f;
+
+    void build(TriangleGeom* faces, const std::vector<int64_t>& faceIds);
+    int64_t buildNode(std::vector<BuildFace>& buildFaces, size_t begin, size_t end);
+
+    /**
+     * @brief segmentEntersBox Returns the segment parameter at which the segment enters the box or a value
+     * greater than 1 if it misses it
+     */
+    float segmentEntersBox(const float* q, const float* dir, const Node& node) const;
+
+    /**
+     * @brief castRay Counts the faces crossed by the segment from q to r
+     * @return '0' if the count is valid, 'V', 'E' or 'F' if q lies on the surface and '?' if the ray
+     * is degenerate and another one must be tried
+     */
+    char castRay(const float* q, const float* r, int& crossings) const;
+
+  public:
+    TriangleBVH(const TriangleBVH&) = delete; // Copy Constructor Not Implemented
+    TriangleBVH(TriangleBVH&&) = delete;      // Move Constructor Not Implemented
+    TriangleBVH& operator=(const TriangleBVH&) = delete; // Copy Assignment Not Implemented
+    TriangleBVH& operator=(TriangleBVH&&) = delete;      // Move Assignment Not Implemented
+};
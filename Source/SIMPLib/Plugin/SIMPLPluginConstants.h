@@ -14,6 +14,17 @@ const QString SessionID("SessionID");
 const QString PipelineErrors("PipelineErrors");
 const QString PipelineWarnings("PipelineWarnings");
 const QString Completed("Completed");
+const QString PipelineProfile("PipelineProfile");
+const QString JobID("JobID");
+const QString JobState("JobState");
+const QString Progress("Progress");
+const QString StatusMessage("StatusMessage");
+const QString SubmittedTime("SubmittedTime");
+const QString StartedTime("StartedTime");
+const QString FinishedTime("FinishedTime");
+const QString CacheHit("CacheHit");
+const QString Shutdown("Shutdown");
+const QString WorkingDirectory("WorkingDirectory");
 
 const QString ErrorLog("ErrorLog");
 const QString WarningLog("WarningLog");
@@ -41,14 +41,180 @@
 
 // Qt Includes
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
 #include <QtCore/QStringList>
 #include <QtCore/QtDebug>
 
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/PluginManager.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+const int k_ManifestVersion = 1;
+
+namespace ManifestKeys
+{
+const QString ManifestVersion("ManifestVersion");
+const QString FileSize("FileSize");
+const QString LastModified("LastModified");
+const QString FileHash("FileHash");
+} // namespace ManifestKeys
+
+/**
+ * @brief HashPluginFile Returns the SHA-1 of the plugin file as a hex string or an empty string if it can not be read
+ */
+QString HashPluginFile(const QString& path)
+{
+  QFile file(path);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return QString();
+  }
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(&file);
+  return QString::fromLatin1(hash.result().toHex());
+}
+
+/**
+ * @brief MatchesFileStamp Returns true if the size and modification time in the manifest entry match the file
+ */
+bool MatchesFileStamp(const QJsonObject& entry, const QFileInfo& fi)
+{
+  return static_cast<qint64>(entry[ManifestKeys::FileSize].toDouble()) == fi.size() &&
+         static_cast<qint64>(entry[ManifestKeys::LastModified].toDouble()) == fi.lastModified().toMSecsSinceEpoch();
+}
+
+/**
+ * @brief SetFileStamp Stores the current size and modification time of the file in the manifest entry
+ */
+void SetFileStamp(QJsonObject& entry, const QFileInfo& fi)
+{
+  entry[ManifestKeys::FileSize] = static_cast<double>(fi.size());
+  entry[ManifestKeys::LastModified] = static_cast<double>(fi.lastModified().toMSecsSinceEpoch());
+}
+
+/**
+ * @brief CreateManifestEntry Describes one plugin file and the filters it provides. The hash of the
+ * previous entry is reused while the file is unchanged so a full plugin load does not read every file.
+ */
+QJsonObject CreateManifestEntry(const QString& path, ISIMPLibPlugin* plugin, FilterManager* filterManager, const QJsonObject& previousEntry)
+{
+  QFileInfo fi(path);
+  QJsonObject entry;
+  entry[SIMPL::JSON::PluginFileName] = path;
+  SetFileStamp(entry, fi);
+  if(MatchesFileStamp(previousEntry, fi) && !previousEntry[ManifestKeys::FileHash].toString().isEmpty())
+  {
+    entry[ManifestKeys::FileHash] = previousEntry[ManifestKeys::FileHash];
+  }
+  else
+  {
+    entry[ManifestKeys::FileHash] = HashPluginFile(path);
+  }
+
+  QJsonArray filters;
+  if(nullptr != plugin)
+  {
+    for(const QString& className : plugin->getFilters())
+    {
+      IFilterFactory::Pointer factory = filterManager->getFactoryFromClassName(className);
+      if(nullptr == factory.get())
+      {
+        continue;
+      }
+      QJsonObject filter;
+      filter[SIMPL::JSON::ClassName] = className;
+      filter[SIMPL::JSON::Uuid] = factory->getUuid().toString();
+      filters.append(filter);
+    }
+  }
+  entry[SIMPL::JSON::Filters] = filters;
+  return entry;
+}
+
+/**
+ * @brief IsManifestEntryCurrent Returns true if the plugin file still matches the manifest entry. A
+ * changed size or time stamp falls back to comparing the file hash. If only the stamp changed it is
+ * updated in the entry and stampUpdated is set so the file is not hashed again on the next start.
+ */
+bool IsManifestEntryCurrent(QJsonObject& entry, bool& stampUpdated)
+{
+  QString path = entry[SIMPL::JSON::PluginFileName].toString();
+  QFileInfo fi(path);
+  if(!fi.exists())
+  {
+    return false;
+  }
+  if(MatchesFileStamp(entry, fi))
+  {
+    return true;
+  }
+  QString hash = entry[ManifestKeys::FileHash].toString();
+  if(hash.isEmpty() || hash != HashPluginFile(path))
+  {
+    return false;
+  }
+  SetFileStamp(entry, fi);
+  stampUpdated = true;
+  return true;
+}
+
+/**
+ * @brief ReadManifest Returns the manifest stored at the path or an empty object
+ */
+QJsonObject ReadManifest(const QString& filePath)
+{
+  QFile manifestFile(filePath);
+  if(!manifestFile.open(QIODevice::ReadOnly))
+  {
+    return QJsonObject();
+  }
+  return QJsonDocument::fromJson(manifestFile.readAll()).object();
+}
+
+/**
+ * @brief WriteManifest Stores the manifest entries at the path unless the file already holds them
+ */
+void WriteManifest(const QString& filePath, const QJsonArray& manifestEntries, bool quiet)
+{
+  QJsonObject manifest;
+  manifest[ManifestKeys::ManifestVersion] = k_ManifestVersion;
+  manifest[SIMPL::JSON::Version] = SIMPLib::Version::Complete();
+  manifest[SIMPL::JSON::Plugins] = manifestEntries;
+  QByteArray manifestData = QJsonDocument(manifest).toJson();
+
+  QFile existing(filePath);
+  if(existing.open(QIODevice::ReadOnly) && existing.readAll() == manifestData)
+  {
+    return;
+  }
+  existing.close();
+
+  QDir().mkpath(QFileInfo(filePath).absolutePath());
+  QSaveFile manifestFile(filePath);
+  if(!manifestFile.open(QIODevice::WriteOnly) || manifestFile.write(manifestData) != manifestData.size() || !manifestFile.commit())
+  {
+    if(!quiet)
+    {
+      qDebug() << "Could not write the plugin manifest" << filePath;
+    }
+  }
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -63,7 +229,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+QStringList SIMPLibPluginLoader::FindPluginFilePaths(bool quiet)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -208,51 +374,148 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
     }
   }
 
+  return pluginFilePaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ISIMPLibPlugin* SIMPLibPluginLoader::LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet)
+{
+  if(!quiet)
+  {
+    qDebug() << "Plugin Being Loaded:" << path;
+  }
+  QPluginLoader loader(path);
+  QObject* plugin = loader.instance();
+  if(!quiet)
+  {
+    qDebug() << "    Pointer: " << plugin << "\n";
+  }
+  if(plugin == nullptr)
+  {
+    if(!quiet)
+    {
+      QString message("The plugin did not load with the following error\n");
+      message.append(loader.errorString());
+      message.append("\n\n");
+      message.append("Possible causes include missing libraries that plugin depends on.");
+      qDebug() << message;
+    }
+    return nullptr;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin != nullptr)
+  {
+    ipPlugin->registerFilters(filterManager);
+    ipPlugin->setDidLoad(true);
+    ipPlugin->setLocation(path);
+    PluginManager::Instance()->addPlugin(ipPlugin);
+  }
+  return ipPlugin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
   FilterManager::RegisterKnownFilters(filterManager);
 
-  PluginManager* pluginManager = PluginManager::Instance();
+  QString manifestFilePath = GetPluginManifestFilePath();
+  QMap<QString, QJsonObject> previousEntries;
+  for(const QJsonValue& value : ReadManifest(manifestFilePath)[SIMPL::JSON::Plugins].toArray())
+  {
+    previousEntries[value.toObject()[SIMPL::JSON::PluginFileName].toString()] = value.toObject();
+  }
+
   QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
+  QJsonArray manifestEntries;
 
-  // Now that we have a sorted list of plugins, go ahead and load them all from the
-  // file system and add each to the toolbar and menu
+  // Now that we have a list of plugins, go ahead and load them all from the file system
   foreach(QString path, pluginFilePaths)
   {
-    if(!quiet)
-    {
-      qDebug() << "Plugin Being Loaded:" << path;
-    }
-    QPluginLoader loader(path);
     QFileInfo fi(path);
     QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet)
-    {
-      qDebug() << "    Pointer: " << plugin << "\n";
-    }
-    if((plugin != nullptr) && !pluginFileNames.contains(fileName, Qt::CaseSensitive))
+    ISIMPLibPlugin* ipPlugin = nullptr;
+    if(!pluginFileNames.contains(fileName, Qt::CaseSensitive))
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin != nullptr)
+      ipPlugin = LoadPlugin(path, filterManager, quiet);
+      if(nullptr != ipPlugin)
       {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
+        pluginFileNames += fileName;
       }
-      pluginFileNames += fileName;
     }
-    else
+    // Plugins that did not load are recorded as well so the manifest covers every file that was found
+    manifestEntries.append(CreateManifestEntry(path, ipPlugin, filterManager, previousEntries.value(path)));
+  }
+
+  WriteManifest(manifestFilePath, manifestEntries, quiet);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFiltersLazily(FilterManager* filterManager, bool quiet)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
+  QString manifestFilePath = GetPluginManifestFilePath();
+  QJsonObject manifest = ReadManifest(manifestFilePath);
+  QJsonArray manifestEntries = manifest[SIMPL::JSON::Plugins].toArray();
+  bool isCurrent = manifest[ManifestKeys::ManifestVersion].toInt() == k_ManifestVersion && manifest[SIMPL::JSON::Version].toString() == SIMPLib::Version::Complete() &&
+                   manifestEntries.size() == pluginFilePaths.size();
+
+  bool stampUpdated = false;
+  for(int i = 0; isCurrent && i < manifestEntries.size(); i++)
+  {
+    QJsonObject entry = manifestEntries[i].toObject();
+    isCurrent = pluginFilePaths.contains(entry[SIMPL::JSON::PluginFileName].toString()) && IsManifestEntryCurrent(entry, stampUpdated);
+    manifestEntries[i] = entry;
+  }
+
+  if(!isCurrent)
+  {
+    if(!quiet)
     {
-      if(!quiet) 
-      {
-        QString message("The plugin did not load with the following error\n");
-        message.append(loader.errorString());
-        message.append("\n\n");
-        message.append("Possible causes include missing libraries that plugin depends on.");
-        qDebug() << message;
-      }
+      qDebug() << "The plugin manifest is missing or out of date. Loading all plugins.";
     }
+    LoadPluginFilters(filterManager, quiet);
+    return;
+  }
+
+  // A plugin that was only touched keeps its hash; remember the new stamp so it is not hashed again
+  if(stampUpdated)
+  {
+    WriteManifest(manifestFilePath, manifestEntries, quiet);
+  }
+
+  FilterManager::RegisterKnownFilters(filterManager);
+  filterManager->setDeferredPluginLoader([filterManager, quiet](const QString& path) { LoadPlugin(path, filterManager, quiet); });
+  for(const QJsonValue& value : manifestEntries)
+  {
+    QJsonObject entry = value.toObject();
+    QString path = entry[SIMPL::JSON::PluginFileName].toString();
+    for(const QJsonValue& filterValue : entry[SIMPL::JSON::Filters].toArray())
+    {
+      QJsonObject filter = filterValue.toObject();
+      filterManager->addDeferredFilter(filter[SIMPL::JSON::ClassName].toString(), QUuid(filter[SIMPL::JSON::Uuid].toString()), path);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SIMPLibPluginLoader::GetPluginManifestFilePath()
+{
+  QString filePath = QString::fromLocal8Bit(qgetenv("SIMPL_PLUGIN_MANIFEST"));
+  if(filePath.isEmpty())
+  {
+    filePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/SIMPLPluginManifest.json";
   }
+  return filePath;
 }
@@ -37,9 +37,12 @@
 
 
 
+#include <QtCore/QStringList>
+
 #include "SIMPLib/SIMPLib.h"
 
 class FilterManager;
+class ISIMPLibPlugin;
 
 
 
@@ -54,13 +57,47 @@ class SIMPLib_EXPORT SIMPLibPluginLoader
     virtual ~SIMPLibPluginLoader();
 
     /**
-     * @brief LoadPluginFilters
+     * @brief LoadPluginFilters Loads every plugin and updates the plugin manifest
      * @param filterManager The FilterManager object to load the filters into when
      * a plugin is loaded
      * @param quiet Dump progress to std::cout
      */
     static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
 
+    /**
+     * @brief LoadPluginFiltersLazily Registers the filters of every plugin from the plugin manifest
+     * that LoadPluginFilters() writes, without loading any plugin. A plugin is loaded the first time
+     * one of its filters is looked up through the FilterManager, so a pipeline only pays for the
+     * plugins it references. If the manifest is missing or does not match the plugin files on disk
+     * this falls back to LoadPluginFilters(), which also rewrites the manifest.
+     * @param filterManager
+     * @param quiet
+     */
+    static void LoadPluginFiltersLazily(FilterManager* filterManager, bool quiet = false);
+
+    /**
+     * @brief FindPluginFilePaths Returns the paths of all the plugin files in the plugin search directories
+     * @param quiet
+     * @return
+     */
+    static QStringList FindPluginFilePaths(bool quiet = false);
+
+    /**
+     * @brief LoadPlugin Loads a single plugin file and registers its filters
+     * @param path
+     * @param filterManager
+     * @param quiet
+     * @return The plugin or nullptr if the file could not be loaded
+     */
+    static ISIMPLibPlugin* LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet = false);
+
+    /**
+     * @brief GetPluginManifestFilePath Returns the location of the plugin manifest. The
+     * SIMPL_PLUGIN_MANIFEST environment variable overrides the default in the user's cache directory.
+     * @return
+     */
+    static QString GetPluginManifestFilePath();
+
 
   protected:
     SIMPLibPluginLoader();
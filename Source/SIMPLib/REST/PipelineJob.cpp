@@ -0,0 +1,351 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineJob.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QJsonArray>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+/**
+ * @brief MessagesToJson Converts error or warning messages into the array format used by the ExecutePipeline end point
+ */
+QJsonArray MessagesToJson(const std::vector<PipelineMessage>& messages, bool errors)
+{
+  QJsonArray array;
+  for(const PipelineMessage& pm : messages)
+  {
+    QJsonObject obj;
+    obj[SIMPL::JSON::Code] = errors ? pm.generateErrorString() : pm.generateWarningString();
+    obj[SIMPL::JSON::Message] = pm.getText();
+    obj[SIMPL::JSON::FilterHumanLabel] = pm.getFilterHumanLabel();
+    obj[SIMPL::JSON::FilterIndex] = pm.getPipelineIndex();
+    array.push_back(obj);
+  }
+  return array;
+}
+
+/**
+ * @brief MoveToThread Moves the pipeline and its filters to the thread. Passing nullptr detaches them from
+ * the calling thread so that another thread can adopt them.
+ */
+void MoveToThread(const FilterPipeline::Pointer& pipeline, QThread* thread)
+{
+  pipeline->moveToThread(thread);
+  for(const AbstractFilter::Pointer& filter : pipeline->getFilterContainer())
+  {
+    filter->moveToThread(thread);
+  }
+}
+
+QString TimeToString(qint64 msecs)
+{
+  if(msecs == 0)
+  {
+    return QString();
+  }
+  return QDateTime::fromMSecsSinceEpoch(msecs).toString(Qt::ISODateWithMs);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::PipelineJob(const FilterPipeline::Pointer& pipeline)
+: m_Id(QUuid::createUuid())
+, m_Pipeline(pipeline)
+, m_SubmittedTime(QDateTime::currentMSecsSinceEpoch())
+{
+  if(nullptr != m_Pipeline.get())
+  {
+    m_PipelineName = m_Pipeline->getName();
+    // The pipeline was parsed in the thread of the HTTP connection. Detaching it lets the worker thread
+    // adopt it in execute() so that pipelineFinished() -> cleanupFilter() is called directly in the worker
+    // thread instead of being queued for the connection thread.
+    MoveToThread(m_Pipeline, nullptr);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::~PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineJob::StateToString(State state)
+{
+  switch(state)
+  {
+  case State::Queued:
+    return QString("Queued");
+  case State::Running:
+    return QString("Running");
+  case State::Completed:
+    return QString("Completed");
+  case State::Failed:
+    return QString("Failed");
+  case State::Canceled:
+    return QString("Canceled");
+  }
+  return QString("Unknown");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid PipelineJob::getId() const
+{
+  return m_Id;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::State PipelineJob::getState() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_State;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::isFinished() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_State != State::Queued && m_State != State::Running;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineJob::getFinishedTime() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_FinishedTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::setFinished(State state)
+{
+  m_State = state;
+  m_FinishedTime = QDateTime::currentMSecsSinceEpoch();
+  // The DataContainerArray of the finished pipeline is no longer needed
+  m_Pipeline = FilterPipeline::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::execute()
+{
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_State != State::Queued)
+    {
+      return;
+    }
+    m_State = State::Running;
+    m_StartedTime = QDateTime::currentMSecsSinceEpoch();
+    pipeline = m_Pipeline;
+  }
+
+  MoveToThread(pipeline, QThread::currentThread());
+
+  // The listener lives on this thread so the messages of the serial execution are delivered directly.
+  PipelineJobListener listener(this);
+  pipeline->addMessageReceiver(&listener);
+
+  pipeline->preflightPipeline();
+
+  bool runPipeline = false;
+  {
+    QMutexLocker locker(&m_Mutex);
+    runPipeline = m_ErrorMessages.empty() && !m_CancelRequested;
+  }
+  if(runPipeline)
+  {
+    pipeline->execute();
+  }
+
+  // Messages posted from the worker threads of a parallel execution are queued for this thread
+  QCoreApplication::sendPostedEvents(&listener);
+
+  QMutexLocker locker(&m_Mutex);
+  if(nullptr != pipeline->getProfile().get())
+  {
+    m_Profile = pipeline->getProfile()->toJson();
+  }
+  if(m_CancelRequested)
+  {
+    setFinished(State::Canceled);
+  }
+  else if(!m_ErrorMessages.empty() || pipeline->getErrorCondition() < 0)
+  {
+    setFinished(State::Failed);
+  }
+  else
+  {
+    m_Progress = 100;
+    setFinished(State::Completed);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::requestCancel()
+{
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(m_State == State::Queued)
+    {
+      m_CancelRequested = true;
+      setFinished(State::Canceled);
+      return true;
+    }
+    if(m_State != State::Running)
+    {
+      return false;
+    }
+    m_CancelRequested = true;
+    pipeline = m_Pipeline;
+  }
+
+  pipeline->cancelPipeline();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::processPipelineMessage(const PipelineMessage& pm)
+{
+  QMutexLocker locker(&m_Mutex);
+  switch(pm.getType())
+  {
+  case PipelineMessage::MessageType::Error:
+    m_ErrorMessages.push_back(pm);
+    break;
+  case PipelineMessage::MessageType::Warning:
+    m_WarningMessages.push_back(pm);
+    break;
+  case PipelineMessage::MessageType::StatusMessage:
+    m_StatusMessage = pm.generateStatusString();
+    break;
+  case PipelineMessage::MessageType::ProgressValue:
+    m_Progress = pm.getProgressValue();
+    break;
+  case PipelineMessage::MessageType::StatusMessageAndProgressValue:
+    m_StatusMessage = pm.generateStatusString();
+    m_Progress = pm.getProgressValue();
+    break;
+  default:
+    break;
+  }
+
+  // FilterPipeline::execute() clears the cancel flag when it starts, so a cancel that arrived while the
+  // pipeline was being set up is applied again on the first message of the execution.
+  if(m_CancelRequested && nullptr != m_Pipeline.get() && !m_Pipeline->getCancel())
+  {
+    m_Pipeline->setCancel(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::toProgressJson() const
+{
+  QMutexLocker locker(&m_Mutex);
+  QJsonObject obj;
+  obj[SIMPL::JSON::JobID] = m_Id.toString();
+  obj[SIMPL::JSON::JobState] = StateToString(m_State);
+  obj[SIMPL::JSON::Progress] = m_Progress;
+  obj[SIMPL::JSON::StatusMessage] = m_StatusMessage;
+  return obj;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJob::toJson() const
+{
+  QJsonObject obj = toProgressJson();
+
+  QMutexLocker locker(&m_Mutex);
+  obj[SIMPL::JSON::Name] = m_PipelineName;
+  obj[SIMPL::JSON::SubmittedTime] = TimeToString(m_SubmittedTime);
+  obj[SIMPL::JSON::StartedTime] = TimeToString(m_StartedTime);
+  obj[SIMPL::JSON::FinishedTime] = TimeToString(m_FinishedTime);
+  obj[SIMPL::JSON::PipelineErrors] = MessagesToJson(m_ErrorMessages, true);
+  obj[SIMPL::JSON::PipelineWarnings] = MessagesToJson(m_WarningMessages, false);
+  obj[SIMPL::JSON::Completed] = (m_State == State::Completed);
+  if(!m_Profile.isEmpty())
+  {
+    obj[SIMPL::JSON::PipelineProfile] = m_Profile;
+  }
+  return obj;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobListener::PipelineJobListener(PipelineJob* job, QObject* parent)
+: QObject(parent)
+, m_Job(job)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobListener::~PipelineJobListener() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobListener::processPipelineMessage(const PipelineMessage& pm)
+{
+  m_Job->processPipelineMessage(pm);
+}
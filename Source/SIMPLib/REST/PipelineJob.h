@@ -0,0 +1,193 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineJob class is one pipeline submitted to the PipelineJobQueue. The job is created by
+ * the HTTP thread that handles the submit request, executed later by one of the queue's worker threads
+ * and polled by any number of other HTTP threads, so every accessor is guarded by the job's mutex.
+ *
+ * A job moves from Queued to Running and then to exactly one of Completed, Failed or Canceled.
+ */
+class SIMPLib_EXPORT PipelineJob
+{
+public:
+  SIMPL_SHARED_POINTERS(PipelineJob)
+  SIMPL_TYPE_MACRO(PipelineJob)
+
+  enum class State : int
+  {
+    Queued = 0,
+    Running = 1,
+    Completed = 2,
+    Failed = 3,
+    Canceled = 4
+  };
+
+  static Pointer New(const FilterPipeline::Pointer& pipeline)
+  {
+    Pointer sharedPtr(new PipelineJob(pipeline));
+    return sharedPtr;
+  }
+
+  virtual ~PipelineJob();
+
+  /**
+   * @brief StateToString Returns the name of the state as it appears in the REST responses
+   * @param state
+   * @return
+   */
+  static QString StateToString(State state);
+
+  /**
+   * @brief getId Returns the identifier the client uses to poll and cancel the job
+   * @return
+   */
+  QUuid getId() const;
+
+  /**
+   * @brief getState
+   * @return
+   */
+  State getState() const;
+
+  /**
+   * @brief isFinished Returns true once the job is Completed, Failed or Canceled
+   * @return
+   */
+  bool isFinished() const;
+
+  /**
+   * @brief getFinishedTime Returns the time the job finished in milliseconds since the epoch or 0
+   * if the job has not finished yet.
+   * @return
+   */
+  qint64 getFinishedTime() const;
+
+  /**
+   * @brief execute Preflights and then executes the pipeline in the calling thread, which becomes the
+   * thread of the pipeline and its filters. Does nothing if the job was canceled while it was waiting
+   * in the queue.
+   */
+  void execute();
+
+  /**
+   * @brief requestCancel Cancels a queued job immediately or asks a running pipeline to stop through
+   * FilterPipeline::cancelPipeline().
+   * @return false if the job had already finished
+   */
+  bool requestCancel();
+
+  /**
+   * @brief processPipelineMessage Records the errors, warnings, status and progress that the pipeline reports
+   * @param pm
+   */
+  void processPipelineMessage(const PipelineMessage& pm);
+
+  /**
+   * @brief toJson Returns the complete status of the job including errors, warnings and, once it has
+   * run, the pipeline profile.
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief toProgressJson Returns only the state, progress and latest status message of the job. This
+   * is cheap enough to be polled frequently.
+   * @return
+   */
+  QJsonObject toProgressJson() const;
+
+protected:
+  PipelineJob(const FilterPipeline::Pointer& pipeline);
+
+private:
+  mutable QMutex m_Mutex;
+  QUuid m_Id;
+  State m_State = State::Queued;
+  FilterPipeline::Pointer m_Pipeline;
+  QString m_PipelineName;
+  bool m_CancelRequested = false;
+  int m_Progress = 0;
+  QString m_StatusMessage;
+  std::vector<PipelineMessage> m_ErrorMessages;
+  std::vector<PipelineMessage> m_WarningMessages;
+  QJsonObject m_Profile;
+  qint64 m_SubmittedTime = 0;
+  qint64 m_StartedTime = 0;
+  qint64 m_FinishedTime = 0;
+
+  void setFinished(State state);
+
+public:
+  PipelineJob(const PipelineJob&) = delete;            // Copy Constructor Not Implemented
+  PipelineJob(PipelineJob&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJob& operator=(const PipelineJob&) = delete; // Copy Assignment Not Implemented
+  PipelineJob& operator=(PipelineJob&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The PipelineJobListener class receives the messages of the pipeline a PipelineJob executes and
+ * forwards them to the job. It is created on the worker thread that runs the job.
+ */
+class SIMPLib_EXPORT PipelineJobListener : public QObject
+{
+  Q_OBJECT
+public:
+  PipelineJobListener(PipelineJob* job, QObject* parent = nullptr);
+  ~PipelineJobListener() override;
+
+public slots:
+  void processPipelineMessage(const PipelineMessage& pm);
+
+private:
+  PipelineJob* m_Job = nullptr;
+
+public:
+  PipelineJobListener(const PipelineJobListener&) = delete;            // Copy Constructor Not Implemented
+  PipelineJobListener(PipelineJobListener&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJobListener& operator=(const PipelineJobListener&) = delete; // Copy Assignment Not Implemented
+  PipelineJobListener& operator=(PipelineJobListener&&) = delete;      // Move Assignment Not Implemented
+};
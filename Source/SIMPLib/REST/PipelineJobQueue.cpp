@@ -0,0 +1,235 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "PipelineJobQueue.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+
+#include "QtWebApp/httpserver/ServerSettings.h"
+
+PipelineJobQueue* PipelineJobQueue::m_Instance = nullptr;
+
+/**
+ * @brief The JobRunnable class runs one job on a worker of the thread pool
+ */
+class PipelineJobQueue::JobRunnable : public QRunnable
+{
+public:
+  JobRunnable(PipelineJobQueue* queue, const PipelineJob::Pointer& job)
+  : m_Queue(queue)
+  , m_Job(job)
+  {
+  }
+
+  void run() override
+  {
+    m_Queue->jobStarted(m_Job->getId());
+    m_Job->execute();
+  }
+
+private:
+  PipelineJobQueue* m_Queue = nullptr;
+  PipelineJob::Pointer m_Job;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::PipelineJobQueue(ServerSettings* settings)
+{
+  int workerThreads = settings->jobWorkerThreads;
+  if(workerThreads <= 0)
+  {
+    workerThreads = QThread::idealThreadCount();
+  }
+  m_ThreadPool.setMaxThreadCount(workerThreads);
+  m_ThreadPool.setExpiryTimeout(-1);
+  m_MaxQueuedJobs = settings->maxQueuedJobs;
+  m_RetentionTime = settings->jobRetentionTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::~PipelineJobQueue()
+{
+  {
+    QMutexLocker locker(&m_Mutex);
+    for(const PipelineJob::Pointer& job : m_Jobs)
+    {
+      cancelJob(job);
+    }
+  }
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue* PipelineJobQueue::Instance()
+{
+  return m_Instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::CreateInstance(ServerSettings* settings)
+{
+  delete m_Instance;
+  m_Instance = new PipelineJobQueue(settings);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobQueue::submit(const FilterPipeline::Pointer& pipeline)
+{
+  QMutexLocker locker(&m_Mutex);
+  purgeExpiredJobs();
+
+  if(countQueuedJobs() >= m_MaxQueuedJobs)
+  {
+    return PipelineJob::NullPointer();
+  }
+
+  PipelineJob::Pointer job = PipelineJob::New(pipeline);
+  JobRunnable* runnable = new JobRunnable(this, job);
+  m_Jobs.insert(job->getId(), job);
+  m_Runnables.insert(job->getId(), runnable);
+  m_ThreadPool.start(runnable);
+  return job;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobQueue::getJob(const QUuid& id)
+{
+  QMutexLocker locker(&m_Mutex);
+  purgeExpiredJobs();
+  return m_Jobs.value(id, PipelineJob::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::cancel(const PipelineJob::Pointer& job)
+{
+  QMutexLocker locker(&m_Mutex);
+  return cancelJob(job);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::cancelJob(const PipelineJob::Pointer& job)
+{
+  QRunnable* runnable = m_Runnables.take(job->getId());
+  // A runnable that a worker already dequeued is not found and runs into the canceled job instead
+  if(nullptr != runnable && m_ThreadPool.tryTake(runnable))
+  {
+    delete runnable;
+  }
+  return job->requestCancel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::jobStarted(const QUuid& id)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Runnables.remove(id);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getWorkerCount() const
+{
+  return m_ThreadPool.maxThreadCount();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getMaxQueuedJobs() const
+{
+  return m_MaxQueuedJobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::getQueuedJobCount()
+{
+  QMutexLocker locker(&m_Mutex);
+  return countQueuedJobs();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::waitForDone(int msecs)
+{
+  return m_ThreadPool.waitForDone(msecs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineJobQueue::countQueuedJobs() const
+{
+  return m_Runnables.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::purgeExpiredJobs()
+{
+  qint64 expired = QDateTime::currentMSecsSinceEpoch() - m_RetentionTime;
+  for(auto iter = m_Jobs.begin(); iter != m_Jobs.end();)
+  {
+    qint64 finishedTime = iter.value()->getFinishedTime();
+    if(finishedTime != 0 && finishedTime < expired)
+    {
+      iter = m_Jobs.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
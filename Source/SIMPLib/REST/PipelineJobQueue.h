@@ -0,0 +1,158 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/REST/PipelineJob.h"
+#include "SIMPLib/SIMPLib.h"
+
+class ServerSettings;
+
+/**
+ * @brief The PipelineJobQueue class executes the pipelines submitted to the REST server on a fixed size
+ * pool of worker threads so that the HTTP listener threads return as soon as a job is queued. The number
+ * of workers is the server side limit on concurrently executing pipelines and the number of jobs waiting
+ * for a worker is bounded; submissions beyond that bound are rejected so clients can back off.
+ *
+ * Finished jobs stay available for polling for the configured retention time.
+ *
+ * Create one instance during start-up with CreateInstance() and use Instance() from the controllers.
+ */
+class SIMPLib_EXPORT PipelineJobQueue
+{
+public:
+  static PipelineJobQueue* Instance();
+  static void CreateInstance(ServerSettings* settings);
+
+  virtual ~PipelineJobQueue();
+
+  /**
+   * @brief submit Queues the pipeline for execution.
+   * @param pipeline
+   * @return The new job or a null pointer if the queue is full
+   */
+  PipelineJob::Pointer submit(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief getJob
+   * @param id
+   * @return The job or a null pointer if no job with this id exists or it has expired
+   */
+  PipelineJob::Pointer getJob(const QUuid& id);
+
+  /**
+   * @brief cancel Cancels the job. A job that is still waiting for a worker is taken out of the thread
+   * pool; a running job is asked to stop through PipelineJob::requestCancel().
+   * @param job
+   * @return false if the job had already finished
+   */
+  bool cancel(const PipelineJob::Pointer& job);
+
+  /**
+   * @brief getWorkerCount Returns the maximum number of pipelines that execute at the same time
+   * @return
+   */
+  int getWorkerCount() const;
+
+  /**
+   * @brief getMaxQueuedJobs Returns the maximum number of jobs that wait for a worker
+   * @return
+   */
+  int getMaxQueuedJobs() const;
+
+  /**
+   * @brief getQueuedJobCount Returns the number of jobs whose runnables are still waiting in the thread pool
+   * @return
+   */
+  int getQueuedJobCount();
+
+  /**
+   * @brief waitForDone Waits until every submitted job has finished
+   * @param msecs Timeout or -1 to wait forever
+   * @return false on timeout
+   */
+  bool waitForDone(int msecs = -1);
+
+private:
+  class JobRunnable;
+
+  static PipelineJobQueue* m_Instance;
+
+  PipelineJobQueue(ServerSettings* settings);
+
+  QThreadPool m_ThreadPool;
+  QMutex m_Mutex;
+  QHash<QUuid, PipelineJob::Pointer> m_Jobs;
+  QHash<QUuid, QRunnable*> m_Runnables;
+  int m_MaxQueuedJobs = 100;
+  qint64 m_RetentionTime = 3600000;
+
+  /**
+   * @brief purgeExpiredJobs Removes the jobs that finished longer than the retention time ago. The
+   * caller must hold m_Mutex.
+   */
+  void purgeExpiredJobs();
+
+  /**
+   * @brief countQueuedJobs Returns the number of jobs waiting for a worker. The caller must hold m_Mutex.
+   * @return
+   */
+  int countQueuedJobs() const;
+
+  /**
+   * @brief cancelJob Takes the runnable of a queued job back out of the thread pool and cancels the job.
+   * The caller must hold m_Mutex.
+   * @param job
+   * @return false if the job had already finished
+   */
+  bool cancelJob(const PipelineJob::Pointer& job);
+
+  /**
+   * @brief jobStarted Forgets the runnable of the job once a worker has picked it up so that it is never
+   * handed to QThreadPool::tryTake() after the pool has deleted it.
+   * @param id
+   */
+  void jobStarted(const QUuid& id);
+
+public:
+  PipelineJobQueue(const PipelineJobQueue&) = delete;            // Copy Constructor Not Implemented
+  PipelineJobQueue(PipelineJobQueue&&) = delete;                 // Move Constructor Not Implemented
+  PipelineJobQueue& operator=(const PipelineJobQueue&) = delete; // Copy Assignment Not Implemented
+  PipelineJobQueue& operator=(PipelineJobQueue&&) = delete;      // Move Assignment Not Implemented
+};
@@ -8,6 +8,7 @@ set(SIMPLib_${SUBDIR_NAME}_Moc_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLRequestMapper.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListener.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDirectoryListing.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJob.h
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/V1RequestMapper.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ExecutePipelineController.h      
@@ -20,6 +21,10 @@ set(SIMPLib_${SUBDIR_NAME}_Moc_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SubmitPipelineController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobStatusController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobProgressController.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/CancelPipelineJobController.h
 )
 
 # --------------------------------------------------------------------
@@ -29,7 +34,7 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPERTIES HEADER_FILE_ONLY TRUE)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
-
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobQueue.h
 )
 
 
@@ -37,6 +42,8 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLRequestMapper.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineListener.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLDirectoryListing.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJob.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineJobQueue.cpp
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/NumFiltersController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/V1RequestMapper.cpp
@@ -50,6 +57,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/ApiNotFoundController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLStaticFileController.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SIMPLibVersionController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/SubmitPipelineController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobStatusController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/PipelineJobProgressController.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/V1Controllers/CancelPipelineJobController.cpp
 
 )
 
@@ -38,7 +38,10 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonParseError>
 #include <QtCore/QMimeDatabase>
+#include <QtCore/QSettings>
+#include <QtCore/QThread>
 #include <QtCore/QUrl>
+#include <QtCore/QUuid>
 
 #include <QtNetwork/QHostAddress>
 #include <QtNetwork/QHttpMultiPart>
@@ -53,6 +56,7 @@
 #include "QtWebApp/httpserver/httpsessionstore.h"
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/CoreFilters/Breakpoint.h"
 #include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -62,6 +66,7 @@
 #include "SIMPLib/Plugin/PluginManager.h"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
 #include "SIMPLib/REST/PipelineListener.h"
 #include "SIMPLib/REST/SIMPLRequestMapper.h"
 #include "SIMPLib/REST/V1Controllers/SIMPLStaticFileController.h"
@@ -310,7 +315,6 @@ public:
       DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
 
       QJsonObject responseObject = doc.object();
-      DREAM3D_REQUIRE_EQUAL(responseObject.size(), 4);
       DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::Completed), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].isBool(), true);
       DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), true);
@@ -325,6 +329,16 @@ public:
       QJsonArray responseWarningsArray = responseObject[SIMPL::JSON::PipelineWarnings].toArray();
       DREAM3D_REQUIRE_EQUAL(responseWarningsArray.size(), 0);
 
+      // The PipelineProfile of the execution is the only key added to the original four
+      DREAM3D_REQUIRE_EQUAL(responseObject.contains(SIMPL::JSON::PipelineProfile), true);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineProfile].isObject(), true);
+      QJsonObject profileObject = responseObject[SIMPL::JSON::PipelineProfile].toObject();
+      DREAM3D_REQUIRE_EQUAL(profileObject["Filters"].isArray(), true);
+      DREAM3D_REQUIRE(profileObject["Filters"].toArray().size() > 0);
+      QJsonObject responseWithoutProfile = responseObject;
+      responseWithoutProfile.remove(SIMPL::JSON::PipelineProfile);
+      DREAM3D_REQUIRE_EQUAL(responseWithoutProfile.size(), 4);
+
       JsonFilterParametersReader::Pointer reader = JsonFilterParametersReader::New();
       FilterPipeline::Pointer pipeline = reader->readPipelineFromFile(UnitTest::RestUnitTest::RESTPipelineFilePath);
 
@@ -822,6 +836,182 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject sendJobRequest(const QString& endPoint, const QString& jobId, QNetworkReply::NetworkError expectedError)
+  {
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/" + endPoint);
+
+    QJsonObject requestObj;
+    requestObj[SIMPL::JSON::JobID] = jobId;
+    QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(requestObj).toJson());
+    DREAM3D_REQUIRE_EQUAL(reply->error(), expectedError);
+
+    QJsonParseError jsonParseError;
+    QJsonDocument doc = QJsonDocument::fromJson(reply->readAll(), &jsonParseError);
+    DREAM3D_REQUIRE_EQUAL(jsonParseError.error, QJsonParseError::ParseError::NoError);
+    return doc.object();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSubmitPipeline()
+  {
+    QUrl url = getConnectionURL();
+
+    url.setPath("/api/v1/SubmitPipeline");
+
+    // Test 'Pipeline Could Not Be Created'
+    {
+      QJsonObject rootObj;
+      rootObj[SIMPL::JSON::Pipeline] = 2;
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", QJsonDocument(rootObj).toJson());
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ProtocolInvalidOperationError);
+
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -50);
+    }
+
+    // Test 'Unknown Job'
+    {
+      QJsonObject responseObject = sendJobRequest("PipelineJobProgress", QUuid::createUuid().toString(), QNetworkReply::ContentNotFoundError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -71);
+    }
+
+    // Test Pipeline Submission, Polling and Cancel
+    {
+      QFile file(UnitTest::RestUnitTest::RESTPipelineFilePath);
+      DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true);
+      QByteArray jsonByteArray = file.readAll();
+
+      QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", jsonByteArray);
+      DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+      DREAM3D_REQUIRE_EQUAL(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), 202);
+
+      QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), 0);
+      QString jobId = responseObject[SIMPL::JSON::JobID].toString();
+      DREAM3D_REQUIRE_EQUAL(QUuid(jobId).isNull(), false);
+
+      QString state;
+      for(int i = 0; i < 600; i++)
+      {
+        responseObject = sendJobRequest("PipelineJobProgress", jobId, QNetworkReply::NoError);
+        state = responseObject[SIMPL::JSON::JobState].toString();
+        if(state != "Queued" && state != "Running")
+        {
+          break;
+        }
+        QThread::msleep(100);
+      }
+      DREAM3D_REQUIRE_EQUAL(state, QString("Completed"));
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Progress].toInt(), 100);
+
+      responseObject = sendJobRequest("PipelineJobStatus", jobId, QNetworkReply::NoError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::Completed].toBool(), true);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineErrors].toArray().size(), 0);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::PipelineProfile].isObject(), true);
+
+      // A finished job can not be canceled any more
+      responseObject = sendJobRequest("CancelPipelineJob", jobId, QNetworkReply::ContentConflictError);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -72);
+      DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobState].toString(), QString("Completed"));
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString waitForJobState(const QString& jobId, const QString& state, const Breakpoint::Pointer& breakpoint = Breakpoint::NullPointer())
+  {
+    QString jobState;
+    for(int i = 0; i < 600; i++)
+    {
+      QJsonObject responseObject = sendJobRequest("PipelineJobProgress", jobId, QNetworkReply::NoError);
+      jobState = responseObject[SIMPL::JSON::JobState].toString();
+      if(jobState == state)
+      {
+        break;
+      }
+      // A resume that arrives before the breakpoint waits is lost, so keep resuming
+      if(nullptr != breakpoint.get())
+      {
+        breakpoint->resumePipeline();
+      }
+      QThread::msleep(100);
+    }
+    return jobState;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCancelPipelineJob()
+  {
+    // One worker and room for a single waiting job make the states of the queue predictable
+    QSettings settings(UnitTest::RestUnitTest::RestServerConfigFilePath, QSettings::IniFormat);
+    ServerSettings jobSettings(settings);
+    jobSettings.jobWorkerThreads = 1;
+    jobSettings.maxQueuedJobs = 1;
+    PipelineJobQueue::CreateInstance(&jobSettings);
+    PipelineJobQueue* jobQueue = PipelineJobQueue::Instance();
+
+    // Keep the only worker busy with a pipeline that waits at a breakpoint
+    FilterPipeline::Pointer blockingPipeline = FilterPipeline::New();
+    Breakpoint::Pointer breakpoint = Breakpoint::New();
+    blockingPipeline->pushBack(breakpoint);
+    PipelineJob::Pointer runningJob = jobQueue->submit(blockingPipeline);
+    DREAM3D_REQUIRE_VALID_POINTER(runningJob.get());
+    QString runningJobId = runningJob->getId().toString();
+    DREAM3D_REQUIRE_EQUAL(waitForJobState(runningJobId, "Running"), QString("Running"));
+
+    QFile file(UnitTest::RestUnitTest::RESTPipelineFilePath);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly), true);
+    QByteArray jsonByteArray = file.readAll();
+
+    QUrl url = getConnectionURL();
+    url.setPath("/api/v1/SubmitPipeline");
+
+    QSharedPointer<QNetworkReply> reply = sendRequest(url, "application/json", jsonByteArray);
+    DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::NoError);
+    QJsonObject responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+    QString queuedJobId = responseObject[SIMPL::JSON::JobID].toString();
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobState].toString(), QString("Queued"));
+    DREAM3D_REQUIRE_EQUAL(jobQueue->getQueuedJobCount(), 1);
+
+    // Test 'Queue Full'
+    reply = sendRequest(url, "application/json", jsonByteArray);
+    DREAM3D_REQUIRE_EQUAL(reply->error(), QNetworkReply::ServiceUnavailableError);
+    DREAM3D_REQUIRE_EQUAL(reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt(), 503);
+    DREAM3D_REQUIRE_EQUAL(reply->hasRawHeader("Retry-After"), true);
+    responseObject = QJsonDocument::fromJson(reply->readAll()).object();
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), -61);
+
+    // Canceling the queued job takes it back out of the thread pool
+    responseObject = sendJobRequest("CancelPipelineJob", queuedJobId, QNetworkReply::NoError);
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobState].toString(), QString("Canceled"));
+    DREAM3D_REQUIRE_EQUAL(jobQueue->getQueuedJobCount(), 0);
+
+    // Canceling the running job stops it once the breakpoint is resumed
+    responseObject = sendJobRequest("CancelPipelineJob", runningJobId, QNetworkReply::NoError);
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::ErrorCode].toInt(), 0);
+    DREAM3D_REQUIRE_EQUAL(waitForJobState(runningJobId, "Canceled", breakpoint), QString("Canceled"));
+    DREAM3D_REQUIRE_EQUAL(jobQueue->waitForDone(60000), true);
+
+    // The canceled job never started
+    responseObject = sendJobRequest("PipelineJobStatus", queuedJobId, QNetworkReply::NoError);
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::JobState].toString(), QString("Canceled"));
+    DREAM3D_REQUIRE_EQUAL(responseObject[SIMPL::JSON::StartedTime].toString().isEmpty(), true);
+
+    // Put the queue from the configuration file back for the remaining tests
+    ServerSettings defaultSettings(settings);
+    PipelineJobQueue::CreateInstance(&defaultSettings);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1677,6 +1867,9 @@ public:
     // Configure static file controller
     SIMPLStaticFileController::CreateInstance(sessionSettings);
 
+    // Configure the pipeline job queue
+    PipelineJobQueue::CreateInstance(sessionSettings);
+
     // Configure and start the TCP listener
     for(const QHostAddress& address : QNetworkInterface::allAddresses())
     {
@@ -1726,6 +1919,8 @@ public:
 
     DREAM3D_REGISTER_TEST(TestExecutePipelineWithFiles());
     DREAM3D_REGISTER_TEST(TestExecutePipeline());
+    DREAM3D_REGISTER_TEST(TestSubmitPipeline());
+    DREAM3D_REGISTER_TEST(TestCancelPipelineJob());
 
     DREAM3D_REGISTER_TEST(TestListFilterParameters());
     DREAM3D_REGISTER_TEST(TestLoadedPlugins());
@@ -0,0 +1,131 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "CancelPipelineJobController.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CancelPipelineJobController::CancelPipelineJobController(const QHostAddress& hostAddress, const int hostPort)
+{
+  setListenHost(hostAddress, hostPort);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CancelPipelineJobController::service(HttpRequest& request, HttpResponse& response)
+{
+  QString content_type = request.getHeader(QByteArray("content-type"));
+
+  QJsonObject rootObj;
+
+  response.setHeader("Content-Type", "application/json");
+
+  if(content_type.compare("application/json") != 0)
+  {
+    // Form Error response
+    rootObj[SIMPL::JSON::ErrorMessage] = EndPoint() + ": Content Type is not application/json";
+    rootObj[SIMPL::JSON::ErrorCode] = -20;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  // The JobID is either part of the JSON body or a request parameter
+  QString jobId = QString::fromUtf8(request.getParameter(SIMPL::JSON::JobID.toUtf8()));
+  QJsonDocument requestDoc = QJsonDocument::fromJson(request.getBody());
+  if(requestDoc.isObject() && requestDoc.object().contains(SIMPL::JSON::JobID))
+  {
+    jobId = requestDoc.object()[SIMPL::JSON::JobID].toString();
+  }
+  QUuid uuid(jobId);
+  if(uuid.isNull())
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: A valid '%2' is required.").arg(EndPoint()).arg(SIMPL::JSON::JobID);
+    rootObj[SIMPL::JSON::ErrorCode] = -70;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  PipelineJobQueue* jobQueue = PipelineJobQueue::Instance();
+  PipelineJob::Pointer job = (nullptr != jobQueue) ? jobQueue->getJob(uuid) : PipelineJob::NullPointer();
+  if(job.get() == nullptr)
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: No job with id %2 exists. Finished jobs expire after a while.").arg(EndPoint()).arg(jobId);
+    rootObj[SIMPL::JSON::ErrorCode] = -71;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::NotFound);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  if(!jobQueue->cancel(job))
+  {
+    rootObj = job->toProgressJson();
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: The job has already finished.").arg(EndPoint());
+    rootObj[SIMPL::JSON::ErrorCode] = -72;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::Conflict);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  rootObj = job->toProgressJson();
+  rootObj[SIMPL::JSON::ErrorMessage] = "";
+  rootObj[SIMPL::JSON::ErrorCode] = 0;
+  QJsonDocument jdoc(rootObj);
+
+  response.setStatusCode(HttpResponse::HttpStatusCode::OK);
+  response.write(jdoc.toJson(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString CancelPipelineJobController::EndPoint()
+{
+  return QString("CancelPipelineJob");
+}
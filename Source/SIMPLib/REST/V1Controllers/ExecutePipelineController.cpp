@@ -234,6 +234,12 @@ void ExecutePipelineController::serviceJSON(QJsonObject pipelineObj)
   m_ResponseObj[SIMPL::JSON::PipelineWarnings] = warnings;
   m_ResponseObj[SIMPL::JSON::Completed] = completed;
 
+  // Per filter timing and memory use of the execution
+  if(nullptr != pipeline->getProfile().get())
+  {
+    m_ResponseObj[SIMPL::JSON::PipelineProfile] = pipeline->getProfile()->toJson();
+  }
+
   //  // **************************************************************************
   //  // This section archives the working directory for this session
   //  QProcess tar;
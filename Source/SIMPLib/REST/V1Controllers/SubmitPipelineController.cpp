@@ -0,0 +1,137 @@
+/* ============================================================================
+ * Copyright (c) 2017-2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#include "SubmitPipelineController.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/REST/PipelineJobQueue.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SubmitPipelineController::SubmitPipelineController(const QHostAddress& hostAddress, const int hostPort)
+{
+  setListenHost(hostAddress, hostPort);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SubmitPipelineController::service(HttpRequest& request, HttpResponse& response)
+{
+  QString content_type = request.getHeader(QByteArray("content-type"));
+
+  QJsonObject rootObj;
+
+  response.setHeader("Content-Type", "application/json");
+
+  if(content_type.compare("application/json") != 0)
+  {
+    // Form Error response
+    rootObj[SIMPL::JSON::ErrorMessage] = EndPoint() + ": Content Type is not application/json";
+    rootObj[SIMPL::JSON::ErrorCode] = -20;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  QJsonParseError jsonParseError;
+  QJsonDocument requestDoc = QJsonDocument::fromJson(request.getBody(), &jsonParseError);
+  if(jsonParseError.error != QJsonParseError::ParseError::NoError)
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: Error Parsing JSON Request Body - %2").arg(EndPoint()).arg(jsonParseError.errorString());
+    rootObj[SIMPL::JSON::ErrorCode] = -40;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  FilterPipeline::Pointer pipeline = FilterPipeline::FromJson(requestDoc.object());
+  if(pipeline.get() == nullptr)
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: Pipeline object could not be created from the provided JSON pipeline data.").arg(EndPoint());
+    rootObj[SIMPL::JSON::ErrorCode] = -50;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::BadRequest);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  PipelineJobQueue* jobQueue = PipelineJobQueue::Instance();
+  if(nullptr == jobQueue)
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: The pipeline job queue has not been created.").arg(EndPoint());
+    rootObj[SIMPL::JSON::ErrorCode] = -60;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::ServiceUnavailable);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  PipelineJob::Pointer job = jobQueue->submit(pipeline);
+  if(job.get() == nullptr)
+  {
+    rootObj[SIMPL::JSON::ErrorMessage] = tr("%1: The job queue is full (%2 jobs waiting). Submit the pipeline again later.").arg(EndPoint()).arg(jobQueue->getMaxQueuedJobs());
+    rootObj[SIMPL::JSON::ErrorCode] = -61;
+    QJsonDocument jdoc(rootObj);
+
+    response.setStatusCode(HttpResponse::HttpStatusCode::ServiceUnavailable);
+    response.setHeader("Retry-After", 30);
+    response.write(jdoc.toJson(), true);
+    return;
+  }
+
+  rootObj = job->toProgressJson();
+  rootObj[SIMPL::JSON::ErrorMessage] = "";
+  rootObj[SIMPL::JSON::ErrorCode] = 0;
+  QJsonDocument jdoc(rootObj);
+
+  response.setStatusCode(HttpResponse::HttpStatusCode::Accepted);
+  response.write(jdoc.toJson(), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SubmitPipelineController::EndPoint()
+{
+  return QString("SubmitPipeline");
+}
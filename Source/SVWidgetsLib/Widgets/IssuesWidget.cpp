@@ -183,6 +183,7 @@ void IssuesWidget::displayCachedMessages()
     case PipelineMessage::MessageType::ProgressValue:
     case PipelineMessage::MessageType::StatusMessageAndProgressValue:
     case PipelineMessage::MessageType::UnknownMessageType:
+    case PipelineMessage::MessageType::FilterProfile:
       break;
     }
   }
@@ -225,6 +226,7 @@ void IssuesWidget::displayCachedMessages()
     case PipelineMessage::MessageType::ProgressValue:
     case PipelineMessage::MessageType::StatusMessageAndProgressValue:
     case PipelineMessage::MessageType::UnknownMessageType:
+    case PipelineMessage::MessageType::FilterProfile:
       break;
     }
 
@@ -332,6 +332,8 @@ void SVPipelineView::preflightPipeline()
 
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
+  // Only the filters from the first edited one onward are preflighted again
+  pipeline->setPreflightCache(m_PreflightCache);
 
   //qDebug() << "Prepping Filters for preflight... ";
 
@@ -423,6 +425,9 @@ void SVPipelineView::executePipeline()
 
   emit stdOutMessage(SVStyle::Instance()->WrapTextWithHtmlStyle("Preflight Pipeline.....", true));
 
+  // Executing changes the state of the filters, so the next preflight starts from scratch
+  m_PreflightCache->clear();
+
   // Give the pipeline one last chance to preflight and get all the latest values from the GUI
   int err = m_PipelineInFlight->preflightPipeline();
   if(err < 0)
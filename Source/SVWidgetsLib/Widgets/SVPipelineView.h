@@ -422,6 +422,7 @@ private:
   QThread* m_WorkerThread = nullptr;
   FilterPipeline::Pointer m_PipelineInFlight;
   QVector<DataContainerArray::Pointer> m_PreflightDataContainerArrays;
+  PreflightCache::Pointer m_PreflightCache = PreflightCache::New();
   QList<QObject*> m_PipelineMessageObservers;
 
   QUndoCommand* m_MoveCommand = nullptr;
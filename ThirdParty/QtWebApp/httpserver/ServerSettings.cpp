@@ -44,6 +44,12 @@ ServerSettings::ServerSettings(QSettings& settings)
   maxCachedFileSize = settings.value("maxCachedFileSize", 65536).toInt();
   settings.endGroup();
 
+  settings.beginGroup("jobs");
+  jobWorkerThreads = settings.value("workerThreads", 2).toInt();
+  maxQueuedJobs = settings.value("maxQueuedJobs", 100).toInt();
+  jobRetentionTime = settings.value("retentionTime", 3600000).toLongLong();
+  settings.endGroup();
+
   settings.beginGroup("sessions");
   expirationTime = settings.value("expirationTime", 3600000).toInt();
   cookieName = settings.value("cookieName", "sessionid").toByteArray();
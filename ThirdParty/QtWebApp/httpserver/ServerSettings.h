@@ -46,6 +46,11 @@ public:
   //    int32_t  cacheTime=60000;
   uint32_t maxCachedFileSize = 65536;
 
+  //   [jobs]
+  int32_t jobWorkerThreads = 2;
+  int32_t maxQueuedJobs = 100;
+  int64_t jobRetentionTime = 3600000;
+
   //   [sessions]
   int32_t expirationTime = 3600000;
   QByteArray cookieName = "sessionid";